@@ -0,0 +1,38 @@
+#include <array>
+#include <vector>
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kArrays = 1000000;
+constexpr int kRounds = 20;
+
+// Копирование и обмен вектора маленьких массивов: для тривиально
+// копируемых массивов это memmove, иначе - поэлементные циклы
+template <typename Array>
+void run(const char *name) {
+  std::vector<Array> source(kArrays);
+  for (int i = 0; i < kArrays; ++i) {
+    for (auto &value : source[i]) value = i;
+  }
+  std::vector<Array> copy(kArrays);
+  double ms = s21_bench::measure([&] {
+    for (int round = 0; round < kRounds; ++round) copy = source;
+  });
+  s21_bench::report("copy 1M x4", name, ms, copy[kArrays - 1][3]);
+
+  ms = s21_bench::measure([&] {
+    for (int round = 0; round < kRounds; ++round) {
+      for (int i = 0; i < kArrays; ++i) source[i].swap(copy[i]);
+    }
+  });
+  s21_bench::report("swap 1M x4", name, ms, source[kArrays / 2][0]);
+}
+}  // namespace
+
+int main() {
+  run<std::array<int, 4>>("std::array");
+  run<s21::array<int, 4>>("s21::array");
+  return 0;
+}
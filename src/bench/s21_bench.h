@@ -0,0 +1,39 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_BENCH_S21_BENCH_H_
+#define CPP2_S21_CONTAINERS_SRC_BENCH_S21_BENCH_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace s21_bench {
+
+// Время выполнения fn в миллисекундах
+template <typename F>
+double measure(F &&fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+// Печатает строку результата. checksum выводится, чтобы компилятор не
+// выбросил измеряемую работу
+inline void report(const char *workload, const char *container, double ms,
+                   long long checksum) {
+  std::printf("%-14s %-28s %10.2f ms  (checksum %lld)\n", workload, container,
+              ms, checksum);
+}
+
+// n различных ключей в случайном порядке
+inline std::vector<int> shuffledKeys(int n, unsigned seed = 21) {
+  std::vector<int> keys(n);
+  for (int i = 0; i < n; ++i) keys[i] = i * 2;
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(seed));
+  return keys;
+}
+
+}  // namespace s21_bench
+
+#endif  // CPP2_S21_CONTAINERS_SRC_BENCH_S21_BENCH_H_
@@ -0,0 +1,176 @@
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kMessages = 1000000;
+constexpr size_t kCapacity = 1024;
+constexpr size_t kBatch = 256;
+// Сколько потребитель ждёт неполного пакета
+constexpr std::chrono::milliseconds kLatency{1};
+
+// Обычная очередь под мьютексом: notify_one на каждый элемент, потребитель
+// забирает по одному. Считает, сколько раз потребители просыпались
+class per_element_queue {
+ public:
+  explicit per_element_queue(size_t capacity) : capacity_(capacity) {}
+
+  void push(int value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] { return items_.size() < capacity_; });
+    items_.push(value);
+    lock.unlock();
+    not_empty_.notify_one();
+  }
+
+  bool pop(int &out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (items_.empty() && !closed_) {
+      not_empty_.wait(lock);
+      ++wakeups_;
+    }
+    if (items_.empty()) return false;
+    out = items_.front();
+    items_.pop();
+    lock.unlock();
+    not_full_.notify_one();
+    return true;
+  }
+
+  void close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+    }
+    not_empty_.notify_all();
+  }
+
+  size_t wakeups() const { return wakeups_; }
+
+ private:
+  size_t capacity_;
+  bool closed_ = false;
+  size_t wakeups_ = 0;
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  s21::queue<int> items_;
+};
+
+long contextSwitches() {
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_nvcsw + usage.ru_nivcsw;
+}
+
+void print(const char *workload, const char *name, double ms,
+           long long checksum, size_t wakeups, long switches) {
+  s21_bench::report(workload, name, ms, checksum);
+  std::printf("%-14s %-28s %10zu wakeups  %8ld context switches\n", "", "",
+              wakeups, switches);
+}
+
+// producers потоков делят kMessages сообщений, consumers потоков забирают
+// их до закрытия очереди
+template <typename Produce, typename Consume>
+double run(int producers, int consumers, Produce produce, Consume consume,
+           std::atomic<long long> &checksum) {
+  return s21_bench::measure([&] {
+    std::vector<std::thread> writers;
+    std::vector<std::thread> readers;
+    for (int c = 0; c < consumers; ++c) {
+      readers.emplace_back([&] { checksum += consume(); });
+    }
+    for (int p = 0; p < producers; ++p) {
+      writers.emplace_back([&, p] {
+        for (int i = p; i < kMessages; i += producers) produce(i);
+      });
+    }
+    for (auto &thread : writers) thread.join();
+    produce(-1);
+    for (auto &thread : readers) thread.join();
+  });
+}
+
+void batched(const char *workload, const char *name, int producers,
+             int consumers, size_t wake_batch) {
+  s21::blocking_queue<int> q(kCapacity, wake_batch);
+  std::atomic<long long> checksum{0};
+  long before = contextSwitches();
+  double ms = run(
+      producers, consumers,
+      [&](int value) {
+        if (value < 0) {
+          q.close();
+        } else {
+          q.push(value);
+        }
+      },
+      [&] {
+        std::vector<int> out(kBatch);
+        long long local = 0;
+        size_t got;
+        while ((got = q.pop_batch(out.begin(), out.size(), kLatency)) != 0 ||
+               !q.closed()) {
+          for (size_t i = 0; i < got; ++i) local += out[i];
+        }
+        return local;
+      },
+      checksum);
+  print(workload, name, ms, checksum.load(), q.statistics().consumer_waits,
+        contextSwitches() - before);
+}
+
+void perElement(const char *workload, int producers, int consumers) {
+  per_element_queue q(kCapacity);
+  std::atomic<long long> checksum{0};
+  long before = contextSwitches();
+  double ms = run(
+      producers, consumers,
+      [&](int value) {
+        if (value < 0) {
+          q.close();
+        } else {
+          q.push(value);
+        }
+      },
+      [&] {
+        long long local = 0;
+        int value;
+        while (q.pop(value)) local += value;
+        return local;
+      },
+      checksum);
+  print(workload, "queue + cv per element", ms, checksum.load(), q.wakeups(),
+        contextSwitches() - before);
+}
+
+void compare(int producers, int consumers) {
+  char workload[32];
+  std::snprintf(workload, sizeof(workload), "%dP x %dC", producers,
+                consumers);
+  batched(workload, "blocking_queue", producers, consumers, 1);
+  batched(workload, "blocking_queue wake_batch", producers, consumers,
+          kBatch);
+  perElement(workload, producers, consumers);
+}
+}  // namespace
+
+int main() {
+  int max_threads = static_cast<int>(
+      std::max(2u, std::thread::hardware_concurrency()) / 2);
+  compare(1, 1);
+  compare(max_threads, 1);
+  compare(max_threads, max_threads);
+  return 0;
+}
@@ -0,0 +1,53 @@
+#include <map>
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kKeys = 200000;
+constexpr int kRounds = 5;
+
+void insertKey(s21::map<long long, long long> &m, long long key) {
+  m.insert(key, key);
+}
+void insertKey(s21::btree_map<long long, long long> &m, long long key) {
+  m.insert(key, key);
+}
+void insertKey(std::map<long long, long long> &m, long long key) {
+  m.emplace(key, key);
+}
+
+// Вставка случайных 64-битных ключей и поиск каждого из них kRounds раз
+template <typename Map>
+void run(const char *name, const std::vector<int> &keys) {
+  Map m;
+  double ms = s21_bench::measure([&] {
+    for (int key : keys) insertKey(m, key);
+  });
+  s21_bench::report("insert", name, ms, m.size());
+
+  long long checksum = 0;
+  ms = s21_bench::measure([&] {
+    for (int round = 0; round < kRounds; ++round) {
+      for (int key : keys) checksum += m.find(key)->second;
+    }
+  });
+  s21_bench::report("lookup", name, ms, checksum);
+
+  checksum = 0;
+  ms = s21_bench::measure([&] {
+    for (int round = 0; round < kRounds; ++round) {
+      for (const auto &item : m) checksum += item.second;
+    }
+  });
+  s21_bench::report("scan", name, ms, checksum);
+}
+}  // namespace
+
+int main() {
+  std::vector<int> keys = s21_bench::shuffledKeys(kKeys);
+  run<s21::map<long long, long long>>("s21::map", keys);
+  run<std::map<long long, long long>>("std::map", keys);
+  run<s21::btree_map<long long, long long>>("s21::btree_map", keys);
+  return 0;
+}
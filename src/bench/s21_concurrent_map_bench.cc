@@ -0,0 +1,76 @@
+#include <mutex>
+#include <thread>
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kKeys = 100000;
+constexpr int kOpsPerThread = 200000;
+
+// Один s21::map под общим мьютексом - то, что заменяет concurrent_map
+class locked_map {
+ public:
+  bool find(int key) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return items_.search(key) != nullptr;
+  }
+  void insert_or_assign(int key, int value) {
+    std::lock_guard<std::mutex> guard(lock_);
+    items_.insert_or_assign(key, value);
+  }
+
+ private:
+  mutable std::mutex lock_;
+  s21::map<int, int> items_;
+};
+
+bool lookup(const locked_map &m, int key) { return m.find(key); }
+bool lookup(const s21::concurrent_map<int, int> &m, int key) {
+  return m.find(key).has_value();
+}
+
+// 90% поисков и 10% записей по случайным ключам
+template <typename Map>
+void run(const char *name, Map &m, const std::vector<int> &keys,
+         int threads) {
+  std::vector<long long> hits(threads);
+  double ms = s21_bench::measure([&] {
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+      workers.emplace_back([&, t] {
+        size_t pos = t * 7919;
+        for (int i = 0; i < kOpsPerThread; ++i) {
+          int key = keys[(pos + i * 31) % keys.size()];
+          if (i % 10 == 0) {
+            m.insert_or_assign(key, i);
+          } else {
+            hits[t] += lookup(m, key);
+          }
+        }
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+  long long checksum = 0;
+  for (long long h : hits) checksum += h;
+  char workload[32];
+  std::snprintf(workload, sizeof(workload), "%d threads", threads);
+  s21_bench::report(workload, name, ms, checksum);
+}
+}  // namespace
+
+int main() {
+  std::vector<int> keys = s21_bench::shuffledKeys(kKeys);
+  for (int threads = 1; threads <= 64; threads *= 2) {
+    locked_map global;
+    s21::concurrent_map<int, int> sharded;
+    for (int i = 0; i < kKeys; i += 2) {
+      global.insert_or_assign(keys[i], i);
+      sharded.insert_or_assign(keys[i], i);
+    }
+    run("s21::map + std::mutex", global, keys, threads);
+    run("s21::concurrent_map", sharded, keys, threads);
+  }
+  return 0;
+}
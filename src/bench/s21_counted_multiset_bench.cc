@@ -0,0 +1,32 @@
+#include <set>
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kCopies = 20000;
+constexpr int kDistinct = 16;
+
+// Много копий немногих ключей: вставка всех копий и подсчёт каждого ключа
+template <typename Set>
+void run(const char *name) {
+  Set s;
+  double ms = s21_bench::measure([&] {
+    for (int i = 0; i < kCopies; ++i) s.insert(i % kDistinct);
+  });
+  s21_bench::report("insert", name, ms, s.size());
+
+  long long checksum = 0;
+  ms = s21_bench::measure([&] {
+    for (int key = 0; key < kDistinct; ++key) checksum += s.count(key);
+  });
+  s21_bench::report("count", name, ms, checksum);
+}
+}  // namespace
+
+int main() {
+  run<s21::multiset<int>>("s21::multiset");
+  run<std::multiset<int>>("std::multiset");
+  run<s21::counted_multiset<int>>("s21::counted_multiset");
+  return 0;
+}
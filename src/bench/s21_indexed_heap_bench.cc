@@ -0,0 +1,118 @@
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kVertices = 300000;
+constexpr int kDegree = 8;
+constexpr int kQueries = 3;
+constexpr long long kUnreached = -1;
+
+// Граф в виде смежных массивов: рёбра вершины v - [first[v], first[v + 1])
+struct graph {
+  std::vector<int> first;
+  std::vector<int> to;
+  std::vector<int> weight;
+};
+
+graph randomGraph() {
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> vertex(0, kVertices - 1);
+  std::uniform_int_distribution<int> weight(1, 1000);
+  graph g;
+  g.first.reserve(kVertices + 1);
+  for (int v = 0; v < kVertices; ++v) {
+    g.first.push_back(static_cast<int>(g.to.size()));
+    // Ребро к соседу по кольцу держит граф связным
+    g.to.push_back((v + 1) % kVertices);
+    g.weight.push_back(weight(gen));
+    for (int e = 1; e < kDegree; ++e) {
+      g.to.push_back(vertex(gen));
+      g.weight.push_back(weight(gen));
+    }
+  }
+  g.first.push_back(static_cast<int>(g.to.size()));
+  return g;
+}
+
+// Дейкстра с decrease_key: каждая вершина в куче не больше одного раза
+long long indexedDijkstra(const graph &g, int source) {
+  std::vector<long long> dist(kVertices, kUnreached);
+  s21::indexed_heap<int, long long> frontier(kVertices);
+  frontier.push(source, 0);
+  long long total = 0;
+  while (!frontier.empty()) {
+    auto [v, d] = frontier.top();
+    frontier.pop();
+    dist[v] = d;
+    total += d;
+    for (int e = g.first[v]; e < g.first[v + 1]; ++e) {
+      int u = g.to[e];
+      if (dist[u] != kUnreached) continue;
+      long long candidate = d + g.weight[e];
+      if (!frontier.push(u, candidate) && candidate < frontier.priority(u)) {
+        frontier.decrease_key(u, candidate);
+      }
+    }
+  }
+  return total;
+}
+
+// Дейкстра с дубликатами: улучшение кладёт новую пару, устаревшие пары
+// пропускаются при снятии
+template <typename Heap>
+long long lazyDijkstra(const graph &g, int source) {
+  std::vector<long long> dist(kVertices, kUnreached);
+  std::vector<long long> best(kVertices, kUnreached);
+  Heap frontier;
+  frontier.push({0, source});
+  best[source] = 0;
+  long long total = 0;
+  while (!frontier.empty()) {
+    auto [d, v] = frontier.top();
+    frontier.pop();
+    if (dist[v] != kUnreached) continue;
+    dist[v] = d;
+    total += d;
+    for (int e = g.first[v]; e < g.first[v + 1]; ++e) {
+      int u = g.to[e];
+      long long candidate = d + g.weight[e];
+      if (dist[u] == kUnreached &&
+          (best[u] == kUnreached || candidate < best[u])) {
+        best[u] = candidate;
+        frontier.push({candidate, u});
+      }
+    }
+  }
+  return total;
+}
+
+using entry = std::pair<long long, int>;
+
+template <typename Run>
+void shortestPaths(const graph &g, const char *name, Run run) {
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    for (int q = 0; q < kQueries; ++q) checksum += run(g, q * 1000);
+  });
+  s21_bench::report("dijkstra", name, ms, checksum);
+}
+}  // namespace
+
+int main() {
+  graph g = randomGraph();
+  shortestPaths(g, "s21::indexed_heap", indexedDijkstra);
+  shortestPaths(
+      g, "s21::priority_queue (lazy)",
+      lazyDijkstra<s21::priority_queue<entry, s21::vector<entry>,
+                                       std::greater<entry>>>);
+  shortestPaths(g, "std::priority_queue (lazy)",
+                lazyDijkstra<std::priority_queue<entry, std::vector<entry>,
+                                                 std::greater<entry>>>);
+  return 0;
+}
@@ -0,0 +1,74 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kOperations = 1000000;
+constexpr int kBuffers = 64;
+
+// s21::stack под мьютексом - то, что заменяет lockfree_stack
+class locked_stack {
+ public:
+  void push(int value) {
+    std::lock_guard<std::mutex> guard(lock_);
+    items_.push(value);
+  }
+
+  std::optional<int> pop() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (items_.empty()) return std::nullopt;
+    int value = items_.top();
+    items_.pop();
+    return value;
+  }
+
+ private:
+  std::mutex lock_;
+  s21::stack<int> items_;
+};
+
+// Общий список свободных буферов: threads потоков делят kOperations
+// циклов "взять буфер - вернуть буфер"
+template <typename Stack>
+void freeList(const char *name, int threads) {
+  Stack pool;
+  for (int i = 0; i < kBuffers; ++i) pool.push(i);
+  std::atomic<long long> checksum{0};
+  double ms = s21_bench::measure([&] {
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+      workers.emplace_back([&] {
+        long long local = 0;
+        for (int i = 0; i < kOperations / threads; ++i) {
+          if (auto buffer = pool.pop()) {
+            local += *buffer;
+            pool.push(*buffer);
+          }
+        }
+        checksum += local;
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+  char workload[32];
+  std::snprintf(workload, sizeof(workload), "free list x%d", threads);
+  s21_bench::report(workload, name, ms, checksum.load());
+}
+}  // namespace
+
+int main() {
+  int max_threads =
+      static_cast<int>(std::max(2u, std::thread::hardware_concurrency()));
+  for (int n = 1; n <= max_threads; n *= 2) {
+    freeList<s21::lockfree_stack<int>>("lockfree_stack", n);
+    freeList<locked_stack>("s21::stack + mutex", n);
+  }
+  return 0;
+}
@@ -0,0 +1,110 @@
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kCapacity = 50000;
+constexpr int kKeys = 200000;
+constexpr int kRequests = 2000000;
+constexpr size_t kValueBytes = 256;
+
+// LRU, какой его обычно пишут вручную: продвижение копирует запись в
+// новый узел в начале списка и удаляет старый
+class hand_rolled_lru {
+ public:
+  using entry = std::pair<int, std::string>;
+
+  const std::string *get(int key) {
+    auto found = index_.find(key);
+    if (found == index_.end()) return nullptr;
+    entry copy = *found->second;
+    entries_.erase(found->second);
+    entries_.push_front(copy);
+    found->second = entries_.begin();
+    return &(*entries_.begin()).second;
+  }
+
+  void put(int key, const std::string &value) {
+    if (entries_.size() == kCapacity) {
+      index_.erase((*entries_.end().prev()).first);
+      entries_.pop_back();
+    }
+    entries_.push_front(entry(key, value));
+    index_.insert(key, entries_.begin());
+  }
+
+ private:
+  s21::list<entry> entries_;
+  s21::map<int, s21::list<entry>::iterator> index_;
+};
+
+// Запросы с перекосом: 80% обращений к 20% ключей. Каждые 100000 запросов
+// идёт проход по 20000 ключей, которые больше не встретятся
+std::vector<int> requests(bool scans) {
+  std::mt19937 gen(21);
+  std::vector<int> keys;
+  keys.reserve(kRequests);
+  int scan_key = kKeys;
+  for (int i = 0; i < kRequests; ++i) {
+    if (scans && i % 100000 < 20000) {
+      keys.push_back(scan_key++);
+    } else if (gen() % 5 != 0) {
+      keys.push_back(static_cast<int>(gen() % (kKeys / 5)));
+    } else {
+      keys.push_back(static_cast<int>(gen() % kKeys));
+    }
+  }
+  return keys;
+}
+
+template <typename Cache>
+void run(const char *workload, const char *name, Cache &cache,
+         const std::vector<int> &keys) {
+  const std::string value(kValueBytes, 'v');
+  long long hits = 0;
+  double ms = s21_bench::measure([&] {
+    for (int key : keys) {
+      if (cache.get(key)) {
+        ++hits;
+      } else {
+        cache.put(key, value);
+      }
+    }
+  });
+  s21_bench::report(workload, name, ms, hits);
+}
+
+template <s21::cache_policy Policy>
+void runPolicy(const char *name, const std::vector<int> &keys) {
+  s21::lru_cache<int, std::string, Policy> cache(kCapacity);
+  run("hits w/ scans", name, cache, keys);
+}
+}  // namespace
+
+int main() {
+  std::vector<int> skewed = requests(false);
+  {
+    hand_rolled_lru cache;
+    run("skewed 256B", "s21::map + s21::list", cache, skewed);
+  }
+  {
+    s21::lru_cache<int, std::string, s21::cache_policy::lru, s21::map> cache(
+        kCapacity);
+    run("skewed 256B", "lru_cache<s21::map>", cache, skewed);
+  }
+  {
+    s21::lru_cache<int, std::string> cache(kCapacity);
+    run("skewed 256B", "lru_cache<unordered_map>", cache, skewed);
+  }
+
+  // Чексумма - число попаданий
+  std::vector<int> scanned = requests(true);
+  runPolicy<s21::cache_policy::lru>("lru", scanned);
+  runPolicy<s21::cache_policy::slru>("slru", scanned);
+  runPolicy<s21::cache_policy::lfu>("lfu", scanned);
+  return 0;
+}
@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kMessages = 2000000;
+constexpr size_t kCapacity = 1024;
+
+// s21::queue под мьютексом - то, что заменяет mpmc_queue
+class locked_queue {
+ public:
+  explicit locked_queue(size_t capacity) : capacity_(capacity) {}
+
+  bool try_push(int value) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (items_.size() == capacity_) return false;
+    items_.push(value);
+    return true;
+  }
+
+  bool try_pop(int &out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (items_.empty()) return false;
+    out = items_.front();
+    items_.pop();
+    return true;
+  }
+
+ private:
+  size_t capacity_;
+  std::mutex lock_;
+  s21::queue<int> items_;
+};
+
+// producers потоков делят kMessages сообщений, consumers потоков забирают
+// их, пока не получат все
+template <typename Queue>
+void fan(const char *name, int producers, int consumers) {
+  Queue q(kCapacity);
+  std::atomic<int> received{0};
+  std::atomic<long long> checksum{0};
+  double ms = s21_bench::measure([&] {
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+      threads.emplace_back([&, p] {
+        s21::backoff wait;
+        for (int i = p; i < kMessages; i += producers) {
+          while (!q.try_push(i)) wait.wait();
+          wait.reset();
+        }
+      });
+    }
+    for (int c = 0; c < consumers; ++c) {
+      threads.emplace_back([&] {
+        s21::backoff wait;
+        long long local = 0;
+        int value;
+        while (received.load(std::memory_order_relaxed) < kMessages) {
+          if (q.try_pop(value)) {
+            local += value;
+            received.fetch_add(1, std::memory_order_relaxed);
+            wait.reset();
+          } else {
+            wait.wait();
+          }
+        }
+        checksum += local;
+      });
+    }
+    for (auto &thread : threads) thread.join();
+  });
+  char workload[32];
+  std::snprintf(workload, sizeof(workload), "%dP x %dC", producers,
+                consumers);
+  s21_bench::report(workload, name, ms, checksum.load());
+}
+}  // namespace
+
+int main() {
+  int max_threads = static_cast<int>(
+      std::max(2u, std::thread::hardware_concurrency()) / 2);
+  for (int n = 1; n <= max_threads; n *= 2) {
+    fan<s21::mpmc_queue<int>>("mpmc_queue", n, n);
+    fan<locked_queue>("s21::queue + mutex", n, n);
+  }
+  fan<s21::mpmc_queue<int>>("mpmc_queue", max_threads, 1);
+  fan<locked_queue>("s21::queue + mutex", max_threads, 1);
+  fan<s21::mpmc_queue<int>>("mpmc_queue", 1, max_threads);
+  fan<locked_queue>("s21::queue + mutex", 1, max_threads);
+  return 0;
+}
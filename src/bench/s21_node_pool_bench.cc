@@ -0,0 +1,74 @@
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kBacklog = 1000;
+constexpr int kOps = 2000000;
+
+// Очереди и стеки поверх s21::list, чтобы сравнить только аллокаторы узлов.
+// Очередь держит kBacklog сообщений, каждая итерация - push и pop
+template <typename Queue>
+void queueChurn(const char *name) {
+  Queue q;
+  for (int i = 0; i < kBacklog; ++i) q.push(i);
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    for (int i = 0; i < kOps; ++i) {
+      q.push(i);
+      checksum += q.front();
+      q.pop();
+    }
+  });
+  s21_bench::report("queue churn", name, ms, checksum);
+}
+
+// Стек растёт до kBacklog и опустошается целиком
+template <typename Stack>
+void stackChurn(const char *name) {
+  Stack s;
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    for (int round = 0; round < kOps / kBacklog; ++round) {
+      for (int i = 0; i < kBacklog; ++i) s.push(i);
+      while (!s.empty()) {
+        checksum += s.top();
+        s.pop();
+      }
+    }
+  });
+  s21_bench::report("stack churn", name, ms, checksum);
+}
+
+template <typename List>
+void listChurn(const char *name) {
+  List l;
+  for (int i = 0; i < kBacklog; ++i) l.push_back(i);
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    for (int i = 0; i < kOps; ++i) {
+      l.push_back(i);
+      checksum += l.front();
+      l.pop_front();
+    }
+  });
+  s21_bench::report("list churn", name, ms, checksum);
+}
+
+template <template <typename> class Alloc>
+using list_of = s21::list<int, Alloc<int>>;
+
+template <template <typename> class Alloc>
+void runAll(const char *name) {
+  queueChurn<s21::queue<int, list_of<Alloc>>>(name);
+  stackChurn<s21::stack<int, list_of<Alloc>>>(name);
+  listChurn<list_of<Alloc>>(name);
+}
+}  // namespace
+
+int main() {
+  runAll<std::allocator>("std::allocator");
+  runAll<s21::shared_pool_allocator>("s21::shared_pool_allocator");
+  runAll<s21::pool_allocator>("s21::pool_allocator");
+  runAll<s21::thread_pool_allocator>("s21::thread_pool_allocator");
+  return 0;
+}
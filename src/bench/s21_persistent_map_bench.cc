@@ -0,0 +1,43 @@
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kKeys = 1000;
+constexpr int kUpdates = 10;
+
+// Каждое обновление публикует снимок: полная копия s21::map против новой
+// версии persistent_map, разделяющей с прежней всё, кроме пути к ключу
+void snapshots(const std::vector<int> &keys) {
+  s21::map<int, int> table;
+  s21::persistent_map<int, int> version;
+  for (int key : keys) {
+    table.insert(key, key);
+    version = version.insert(key, key);
+  }
+
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    for (int i = 0; i < kUpdates; ++i) {
+      table.insert_or_assign(keys[i], i);
+      s21::map<int, int> snapshot(table);
+      checksum += snapshot.size();
+    }
+  });
+  s21_bench::report("snapshot", "s21::map copy", ms, checksum);
+
+  checksum = 0;
+  ms = s21_bench::measure([&] {
+    for (int i = 0; i < kUpdates; ++i) {
+      version = version.insert_or_assign(keys[i], i);
+      s21::persistent_map<int, int> snapshot = version;
+      checksum += snapshot.size();
+    }
+  });
+  s21_bench::report("snapshot", "s21::persistent_map", ms, checksum);
+}
+}  // namespace
+
+int main() {
+  snapshots(s21_bench::shuffledKeys(kKeys));
+  return 0;
+}
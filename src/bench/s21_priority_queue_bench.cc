@@ -0,0 +1,85 @@
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kOps = 2000000;
+
+template <size_t Arity>
+using deadline_heap =
+    s21::priority_queue<long long, s21::vector<long long>,
+                        std::greater<long long>, Arity>;
+
+// Очередь сроков планировщика на s21::multiset: взять минимум - begin и
+// erase, каждая вставка выделяет узел
+class multiset_deadlines {
+ public:
+  void push(long long deadline) { items_.insert(deadline); }
+  long long top() { return *items_.begin(); }
+  void pop() { items_.erase(items_.begin()); }
+
+ private:
+  s21::multiset<long long> items_;
+};
+
+// В очереди pending сроков. Каждая из ops итераций снимает ближайший и
+// ставит следующий срок той же задачи
+template <typename Queue>
+void scheduler(const char *workload, const char *name, int pending,
+               int ops) {
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<long long> period(1, 1000000);
+  Queue q;
+  for (int i = 0; i < pending; ++i) q.push(period(gen));
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    for (int i = 0; i < ops; ++i) {
+      long long now = q.top();
+      q.pop();
+      checksum += now;
+      q.push(now + period(gen));
+    }
+  });
+  s21_bench::report(workload, name, ms, checksum);
+}
+
+// Построение очереди из готового массива сроков
+template <typename Queue>
+void build(const char *name) {
+  std::vector<long long> deadlines(kOps);
+  std::mt19937 gen(21);
+  for (auto &deadline : deadlines) deadline = gen();
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    Queue q(deadlines.begin(), deadlines.end());
+    checksum += q.top();
+  });
+  s21_bench::report("heapify", name, ms, checksum);
+}
+
+using std_heap = std::priority_queue<long long, std::vector<long long>,
+                                     std::greater<long long>>;
+
+// Все очереди на 5000 сроках и без multiset на 100000
+template <typename Queue>
+void schedulers(const char *name) {
+  scheduler<Queue>("scheduler 5k", name, 5000, 100000);
+  scheduler<Queue>("scheduler 100k", name, 100000, kOps);
+}
+}  // namespace
+
+int main() {
+  scheduler<multiset_deadlines>("scheduler 5k", "s21::multiset", 5000,
+                                100000);
+  schedulers<deadline_heap<2>>("s21::priority_queue (d=2)");
+  schedulers<deadline_heap<4>>("s21::priority_queue (d=4)");
+  schedulers<std_heap>("std::priority_queue");
+  build<deadline_heap<2>>("s21::priority_queue (d=2)");
+  build<deadline_heap<4>>("s21::priority_queue (d=4)");
+  build<std_heap>("std::priority_queue");
+  return 0;
+}
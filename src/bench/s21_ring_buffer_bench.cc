@@ -0,0 +1,56 @@
+#include <vector>
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kSamples = 20000000;
+constexpr int kWindow = 1024;
+
+// Хранение последних kWindow отсчётов метрики; раз в kWindow отсчётов
+// окно целиком копируется наружу
+template <typename Window>
+void lastSamples(const char *name, Window window) {
+  std::vector<double> out(kWindow);
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    for (int i = 0; i < kSamples; ++i) {
+      window.push_back(i * 0.5);
+      if (i % kWindow == 0) {
+        window.copy_to(out.begin());
+        checksum += static_cast<long long>(out[0]);
+      }
+    }
+  });
+  s21_bench::report("last samples", name, ms, checksum);
+}
+
+// Та же нагрузка на s21::queue с ручным вытеснением
+void queueSamples() {
+  s21::queue<double> window;
+  std::vector<double> out(kWindow);
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    for (int i = 0; i < kSamples; ++i) {
+      window.push(i * 0.5);
+      if (window.size() > kWindow) window.pop();
+      if (i % kWindow == 0) {
+        s21::queue<double> copy(window);
+        for (size_t j = 0; !copy.empty(); ++j, copy.pop()) {
+          out[j] = copy.front();
+        }
+        checksum += static_cast<long long>(out[0]);
+      }
+    }
+  });
+  s21_bench::report("last samples", "s21::queue", ms, checksum);
+}
+}  // namespace
+
+int main() {
+  lastSamples("ring_buffer<T, 1024>", s21::ring_buffer<double, kWindow>());
+  lastSamples("ring_buffer(1024), mask", s21::ring_buffer<double>(kWindow));
+  lastSamples("ring_buffer(1000)", s21::ring_buffer<double>(1000));
+  queueSamples();
+  return 0;
+}
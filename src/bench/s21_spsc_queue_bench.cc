@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kMessages = 5000000;
+constexpr int kRoundTrips = 200000;
+constexpr size_t kCapacity = 4096;
+
+// Закрепляет текущий поток за ядром cpu (по модулю числа ядер)
+void pinThread(unsigned cpu) {
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu % std::max(1u, std::thread::hardware_concurrency()), &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void)cpu;
+#endif
+}
+
+// s21::queue под мьютексом и условной переменной - то, что заменяет
+// spsc_queue
+class locked_queue {
+ public:
+  explicit locked_queue(size_t) {}
+
+  bool try_push(int value) {
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      items_.push(value);
+    }
+    ready_.notify_one();
+    return true;
+  }
+
+  bool try_pop(int &out) {
+    std::unique_lock<std::mutex> guard(lock_);
+    ready_.wait(guard, [this] { return !items_.empty(); });
+    out = items_.front();
+    items_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex lock_;
+  std::condition_variable ready_;
+  s21::queue<int> items_;
+};
+
+template <typename Queue>
+void push(Queue &q, int value) {
+  while (!q.try_push(value)) std::this_thread::yield();
+}
+
+template <typename Queue>
+int pop(Queue &q) {
+  int value;
+  while (!q.try_pop(value)) std::this_thread::yield();
+  return value;
+}
+
+// Производитель и потребитель на разных ядрах, по одному сообщению
+template <typename Queue>
+void throughput(const char *name) {
+  Queue q(kCapacity);
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    std::thread producer([&q] {
+      pinThread(0);
+      for (int i = 0; i < kMessages; ++i) push(q, i);
+    });
+    pinThread(1);
+    for (int i = 0; i < kMessages; ++i) checksum += pop(q);
+    producer.join();
+  });
+  s21_bench::report("throughput", name, ms, checksum);
+}
+
+// То же, пакетами по 64 сообщения
+void batchThroughput() {
+  s21::spsc_queue<int> q(kCapacity);
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    std::thread producer([&q] {
+      pinThread(0);
+      std::vector<int> batch(64);
+      for (int sent = 0; sent < kMessages;) {
+        int count = std::min(64, kMessages - sent);
+        for (int i = 0; i < count; ++i) batch[i] = sent + i;
+        size_t done = q.try_push_batch(batch.begin(), batch.begin() + count);
+        if (done == 0) std::this_thread::yield();
+        sent += static_cast<int>(done);
+      }
+    });
+    pinThread(1);
+    std::vector<int> out(64);
+    for (int received = 0; received < kMessages;) {
+      size_t got = q.try_pop_batch(out.begin(), out.size());
+      if (got == 0) std::this_thread::yield();
+      for (size_t i = 0; i < got; ++i) checksum += out[i];
+      received += static_cast<int>(got);
+    }
+    producer.join();
+  });
+  s21_bench::report("throughput", "spsc_queue, batch 64", ms, checksum);
+}
+
+// Пинг-понг через две очереди; печатается среднее время одного круга
+template <typename Queue>
+void latency(const char *name) {
+  Queue ping(kCapacity);
+  Queue pong(kCapacity);
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    std::thread echo([&] {
+      pinThread(0);
+      for (int i = 0; i < kRoundTrips; ++i) push(pong, pop(ping) + 1);
+    });
+    pinThread(1);
+    for (int i = 0; i < kRoundTrips; ++i) {
+      push(ping, i);
+      checksum += pop(pong);
+    }
+    echo.join();
+  });
+  std::printf("%-14s %-28s %10.0f ns  (checksum %lld)\n", "round trip", name,
+              ms * 1e6 / kRoundTrips, checksum);
+}
+}  // namespace
+
+int main() {
+  throughput<s21::spsc_queue<int>>("spsc_queue");
+  batchThroughput();
+  throughput<locked_queue>("s21::queue + mutex");
+  latency<s21::spsc_queue<int>>("spsc_queue");
+  latency<locked_queue>("s21::queue + mutex");
+  return 0;
+}
@@ -0,0 +1,75 @@
+#include <deque>
+#include <queue>
+#include <stack>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kDepth = 64;
+constexpr int kOps = 20000000;
+
+// Стек операндов разбора: глубина колеблется около kDepth, каждая итерация -
+// push и pop
+template <typename Stack>
+void operandStack(const char *name) {
+  Stack s;
+  for (int i = 0; i < kDepth; ++i) s.push(i);
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    for (int i = 0; i < kOps; ++i) {
+      s.push(i);
+      if (i % 3 != 0) s.push(i + 1);
+      checksum += s.top();
+      s.pop();
+      if (i % 3 != 0) s.pop();
+    }
+  });
+  s21_bench::report("operand stack", name, ms, checksum);
+}
+
+// Очередь держит kDepth сообщений, каждая итерация - push и pop
+template <typename Queue>
+void messageQueue(const char *name) {
+  Queue q;
+  for (int i = 0; i < kDepth; ++i) q.push(i);
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    for (int i = 0; i < kOps; ++i) {
+      q.push(i);
+      checksum += q.front();
+      q.pop();
+    }
+  });
+  s21_bench::report("message queue", name, ms, checksum);
+}
+
+// Копирование стека из 100000 элементов
+template <typename Stack>
+void copyStack(const char *name) {
+  Stack s;
+  for (int i = 0; i < 100000; ++i) s.push(i);
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    for (int round = 0; round < 100; ++round) {
+      Stack copy(s);
+      checksum += copy.top();
+    }
+  });
+  s21_bench::report("stack copy", name, ms, checksum);
+}
+}  // namespace
+
+int main() {
+  operandStack<s21::stack<int>>("s21::stack (vector)");
+  operandStack<s21::stack<int, s21::list<int>>>("s21::stack (list)");
+  operandStack<std::stack<int, std::vector<int>>>("std::stack (vector)");
+  messageQueue<s21::queue<int>>("s21::queue (deque)");
+  messageQueue<s21::queue<int, s21::list<int>>>("s21::queue (list)");
+  messageQueue<std::queue<int>>("std::queue (deque)");
+  copyStack<s21::stack<int>>("s21::stack (vector)");
+  copyStack<s21::stack<int, s21::list<int>>>("s21::stack (list)");
+  copyStack<std::stack<int, std::vector<int>>>("std::stack (vector)");
+  return 0;
+}
@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kFib = 38;
+constexpr int kFibCutoff = 18;
+constexpr int kSortItems = 10000000;
+constexpr int kSortCutoff = 4096;
+
+long fibSerial(int n) {
+  return n < 2 ? n : fibSerial(n - 1) + fibSerial(n - 2);
+}
+
+long fib(s21::task_pool &pool, int n) {
+  if (n < kFibCutoff) return fibSerial(n);
+  long a = 0;
+  long b = 0;
+  pool.parallel_invoke([&] { a = fib(pool, n - 1); },
+                       [&] { b = fib(pool, n - 2); });
+  return a + b;
+}
+
+// Трёхчастное разбиение: равные опорному элементы сразу встают на место
+void quickSort(s21::task_pool &pool, int *first, int *last) {
+  if (last - first < kSortCutoff) {
+    std::sort(first, last);
+    return;
+  }
+  int pivot = first[(last - first) / 2];
+  int *lower =
+      std::partition(first, last, [pivot](int x) { return x < pivot; });
+  int *upper =
+      std::partition(lower, last, [pivot](int x) { return x == pivot; });
+  pool.parallel_invoke([&] { quickSort(pool, first, lower); },
+                       [&] { quickSort(pool, upper, last); });
+}
+
+std::vector<int> randomItems() {
+  std::vector<int> items(kSortItems);
+  std::mt19937 gen(21);
+  for (auto &item : items) item = static_cast<int>(gen());
+  return items;
+}
+
+void report(const char *workload, int workers, double ms, long long checksum) {
+  char name[32];
+  if (workers == 0) {
+    std::snprintf(name, sizeof(name), "serial");
+  } else {
+    std::snprintf(name, sizeof(name), "task_pool x%d", workers);
+  }
+  s21_bench::report(workload, name, ms, checksum);
+}
+}  // namespace
+
+int main() {
+  int max_workers =
+      static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  long serial = 0;
+  double ms = s21_bench::measure([&] { serial = fibSerial(kFib); });
+  report("fib", 0, ms, serial);
+  for (int workers = 1; workers <= max_workers; workers *= 2) {
+    s21::task_pool pool(workers);
+    long result = 0;
+    ms = s21_bench::measure([&] { result = fib(pool, kFib); });
+    report("fib", workers, ms, result);
+  }
+
+  std::vector<int> source = randomItems();
+  std::vector<int> items = source;
+  ms = s21_bench::measure([&] { std::sort(items.begin(), items.end()); });
+  report("quick sort", 0, ms, items[kSortItems / 2]);
+  for (int workers = 1; workers <= max_workers; workers *= 2) {
+    s21::task_pool pool(workers);
+    items = source;
+    ms = s21_bench::measure(
+        [&] { quickSort(pool, items.data(), items.data() + items.size()); });
+    report("quick sort", workers, ms,
+           std::is_sorted(items.begin(), items.end()) ? items[kSortItems / 2]
+                                                      : -1);
+  }
+  return 0;
+}
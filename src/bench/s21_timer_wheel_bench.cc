@@ -0,0 +1,108 @@
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr uint64_t kTimeout = 30000;
+constexpr int kTicks = 200;
+// Доля таймеров, которые перевзводятся за тик: активность на соединении
+// отменяет старый таймаут и ставит новый
+constexpr uint32_t kRearmDivisor = 100;
+
+struct on_timeout {
+  void operator()() const { ++*fired; }
+  long long *fired = nullptr;
+};
+
+class wheel_timers {
+ public:
+  explicit wheel_timers(uint32_t count) : handles_(count) {}
+
+  void arm(uint32_t id, uint64_t when) {
+    handles_[id] = timers_.schedule(when, on_timeout{&fired_});
+  }
+  void rearm(uint32_t id, uint64_t when) {
+    timers_.cancel(handles_[id]);
+    arm(id, when);
+  }
+  void advance(uint64_t now) { timers_.advance(now); }
+  long long checksum() const {
+    return fired_ * 1000003 + static_cast<long long>(timers_.size());
+  }
+
+ private:
+  s21::timer_wheel<on_timeout> timers_;
+  std::vector<s21::timer_wheel<on_timeout>::handle> handles_;
+  long long fired_ = 0;
+};
+
+// Очередь таймеров на упорядоченном множестве пар (срок, id): ручка
+// таймера - сам ключ, отмена - удаление по ключу за O(log n)
+template <typename Set>
+class tree_timers {
+ public:
+  using key = std::pair<uint64_t, uint32_t>;
+
+  explicit tree_timers(uint32_t count) : keys_(count) {}
+
+  void arm(uint32_t id, uint64_t when) {
+    keys_[id] = key(when, id);
+    timers_.insert(keys_[id]);
+  }
+  void rearm(uint32_t id, uint64_t when) {
+    auto it = timers_.find(keys_[id]);
+    if (it != timers_.end()) timers_.erase(it);
+    arm(id, when);
+  }
+  void advance(uint64_t now) {
+    while (!timers_.empty() && (*timers_.begin()).first <= now) {
+      on_timeout{&fired_}();
+      timers_.erase(timers_.begin());
+    }
+  }
+  long long checksum() const {
+    return fired_ * 1000003 + static_cast<long long>(timers_.size());
+  }
+
+ private:
+  Set timers_;
+  std::vector<key> keys_;
+  long long fired_ = 0;
+};
+
+// count таймеров со случайными сроками до kTimeout, затем kTicks тиков,
+// на каждом count / kRearmDivisor случайных таймеров перевзводится
+template <typename Timers>
+void run(const char *workload, const char *name, uint32_t count) {
+  Timers timers(count);
+  std::mt19937 gen(21);
+  double ms = s21_bench::measure([&] {
+    for (uint32_t id = 0; id < count; ++id) {
+      timers.arm(id, 1 + gen() % kTimeout);
+    }
+    for (uint64_t now = 1; now <= kTicks; ++now) {
+      for (uint32_t i = 0; i < count / kRearmDivisor; ++i) {
+        timers.rearm(gen() % count, now + kTimeout);
+      }
+      timers.advance(now);
+    }
+  });
+  s21_bench::report(workload, name, ms, timers.checksum());
+}
+
+using key = std::pair<uint64_t, uint32_t>;
+}  // namespace
+
+int main() {
+  // s21::multiset - несбалансированное дерево: сроки почти всегда растут, и
+  // оно вырождается в список, поэтому сравнение с ним - на малом размере
+  run<wheel_timers>("2k timers", "timer_wheel", 2000);
+  run<tree_timers<s21::multiset<key>>>("2k timers", "s21::multiset", 2000);
+  run<wheel_timers>("1M timers", "timer_wheel", 1000000);
+  run<tree_timers<s21::btree_set<key>>>("1M timers", "s21::btree_set", 1000000);
+  return 0;
+}
@@ -0,0 +1,74 @@
+#include <map>
+#include <unordered_map>
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kKeys = 200000;
+constexpr int kRounds = 5;
+
+// Вставка всех ключей и поиск каждого по kRounds раз
+template <typename Map>
+void hitHeavy(const char *name, const std::vector<int> &keys) {
+  Map m;
+  for (int key : keys) m[key] = key;
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    for (int round = 0; round < kRounds; ++round) {
+      for (int key : keys) checksum += m.find(key)->second;
+    }
+  });
+  s21_bench::report("hit-heavy", name, ms, checksum);
+}
+
+// Поиск ключей, которых нет в таблице (все нечётные)
+template <typename Map>
+void missHeavy(const char *name, const std::vector<int> &keys) {
+  Map m;
+  for (int key : keys) m[key] = key;
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    for (int round = 0; round < kRounds; ++round) {
+      for (int key : keys) checksum += m.find(key + 1) == m.end();
+    }
+  });
+  s21_bench::report("miss-heavy", name, ms, checksum);
+}
+
+// Скользящее окно: каждая вставка сопровождается удалением старого ключа
+template <typename Map>
+void eraseHeavy(const char *name, const std::vector<int> &keys) {
+  Map m;
+  const size_t window = keys.size() / 10;
+  long long checksum = 0;
+  double ms = s21_bench::measure([&] {
+    for (int round = 0; round < kRounds; ++round) {
+      for (size_t i = 0; i < keys.size(); ++i) {
+        m[keys[i]] = round;
+        if (i >= window) {
+          m.erase(keys[i - window]);
+          ++checksum;
+        }
+      }
+      m.clear();
+    }
+  });
+  s21_bench::report("erase-heavy", name, ms, checksum);
+}
+
+template <typename Map>
+void runAll(const char *name, const std::vector<int> &keys) {
+  hitHeavy<Map>(name, keys);
+  missHeavy<Map>(name, keys);
+  eraseHeavy<Map>(name, keys);
+}
+}  // namespace
+
+int main() {
+  std::vector<int> keys = s21_bench::shuffledKeys(kKeys);
+  runAll<s21::unordered_map<int, int>>("s21::unordered_map", keys);
+  runAll<std::unordered_map<int, int>>("std::unordered_map", keys);
+  runAll<s21::map<int, int>>("s21::map", keys);
+  return 0;
+}
@@ -0,0 +1,36 @@
+#include <list>
+#include <vector>
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kItems = 1000000;
+constexpr int kRounds = 10;
+
+// Построение push_back и kRounds полных проходов с суммированием
+template <typename Sequence>
+void run(const char *name) {
+  Sequence items;
+  double ms = s21_bench::measure([&] {
+    for (int i = 0; i < kItems; ++i) items.push_back(i);
+  });
+  s21_bench::report("push_back", name, ms, items.size());
+
+  long long checksum = 0;
+  ms = s21_bench::measure([&] {
+    for (int round = 0; round < kRounds; ++round) {
+      for (auto it = items.begin(); it != items.end(); ++it) checksum += *it;
+    }
+  });
+  s21_bench::report("scan", name, ms, checksum);
+}
+}  // namespace
+
+int main() {
+  run<s21::list<int>>("s21::list");
+  run<std::list<int>>("std::list");
+  run<s21::unrolled_list<int>>("s21::unrolled_list");
+  run<std::vector<int>>("std::vector");
+  return 0;
+}
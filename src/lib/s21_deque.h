@@ -0,0 +1,360 @@
+#ifndef S21_DEQUE_H_
+#define S21_DEQUE_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// CONTENTS
+
+// - MEMBER_TYPE
+// - CONSTRUCTORS_DESTRUCTORS_AND_OPERATORS
+// - ELEMENT_ACCESS
+// - CAPACITY
+// - MODIFIERS
+// - ITERATORS
+
+namespace s21 {
+// Двусторонняя очередь на кольцевом буфере. Ёмкость - степень двойки,
+// поэтому логический индекс переводится в позицию буфера маской. Буфер
+// растёт вдвое, элементы при этом переносятся в начало нового буфера.
+// Вставка и удаление с обоих концов - амортизированно O(1) без выделения
+// памяти на элемент
+template <typename T>
+class deque {
+ public:
+  template <typename Value>
+  class DequeIterator;
+
+  // MEMBER_TYPE
+  using value_type = T;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = DequeIterator<value_type>;
+  using const_iterator = DequeIterator<const value_type>;
+  using size_type = size_t;
+
+ private:
+  static constexpr size_type kMinCapacity = 8;
+
+  value_type* _buffer;
+  size_type _capacity;
+  size_type _head;
+  size_type _size;
+
+  // CONSTRUCTORS_DESTRUCTORS_AND_OPERATORS
+
+ public:
+  deque() : _buffer(nullptr), _capacity(0), _head(0), _size(0) {}
+
+  deque(std::initializer_list<value_type> const& items) : deque() {
+    reserve(items.size());
+    for (auto it = items.begin(); it != items.end(); ++it) {
+      push_back(*it);
+    }
+  }
+
+  // Копия получает буфер по размеру источника, элементы копируются подряд
+  deque(const deque& d) : deque() {
+    reserve(d._size);
+    for (size_type i = 0; i < d._size; i++) {
+      new (_buffer + i) value_type(d[i]);
+      _size++;
+    }
+  }
+
+  deque(deque&& d) noexcept : deque() { swap(d); }
+
+  deque& operator=(const deque& d) {
+    if (this != &d) {
+      deque copy(d);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  deque& operator=(deque&& d) noexcept {
+    if (this != &d) {
+      clear();
+      swap(d);
+    }
+    return *this;
+  }
+
+  ~deque() {
+    clear();
+    ::operator delete(_buffer, std::align_val_t(alignof(value_type)));
+  }
+
+  // ELEMENT_ACCESS
+
+  reference at(size_type pos) {
+    if (pos >= _size) {
+      throw std::out_of_range("Deque index out of range");
+    }
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= _size) {
+      throw std::out_of_range("Deque index out of range");
+    }
+    return (*this)[pos];
+  }
+
+  reference operator[](size_type pos) { return _buffer[slot(pos)]; }
+
+  const_reference operator[](size_type pos) const {
+    return _buffer[slot(pos)];
+  }
+
+  reference front() {
+    check_not_empty();
+    return _buffer[_head];
+  }
+
+  const_reference front() const {
+    check_not_empty();
+    return _buffer[_head];
+  }
+
+  reference back() {
+    check_not_empty();
+    return (*this)[_size - 1];
+  }
+
+  const_reference back() const {
+    check_not_empty();
+    return (*this)[_size - 1];
+  }
+
+  // CAPACITY
+
+  bool empty() const { return _size == 0; }
+
+  size_type size() const { return _size; }
+
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+
+  size_type capacity() const { return _capacity; }
+
+  // Ёмкость округляется вверх до степени двойки
+  void reserve(size_type size) {
+    if (size > max_size()) {
+      throw std::length_error("Deque reserve exceeds max_size()");
+    }
+    if (size > _capacity) {
+      size_type capacity = kMinCapacity;
+      while (capacity < size) {
+        capacity *= 2;
+      }
+      reallocate(capacity);
+    }
+  }
+
+  // MODIFIERS
+
+  void clear() {
+    for (size_type i = 0; i < _size; i++) {
+      _buffer[slot(i)].~value_type();
+    }
+    _head = 0;
+    _size = 0;
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+  void push_front(const_reference value) { emplace_front(value); }
+
+  void push_front(value_type&& value) { emplace_front(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    grow_if_full();
+    value_type* place = _buffer + slot(_size);
+    new (place) value_type(std::forward<Args>(args)...);
+    _size++;
+    return *place;
+  }
+
+  template <typename... Args>
+  reference emplace_front(Args&&... args) {
+    grow_if_full();
+    size_type head = (_head - 1) & (_capacity - 1);
+    new (_buffer + head) value_type(std::forward<Args>(args)...);
+    _head = head;
+    _size++;
+    return _buffer[head];
+  }
+
+  void pop_back() {
+    check_not_empty();
+    _size--;
+    _buffer[slot(_size)].~value_type();
+  }
+
+  void pop_front() {
+    check_not_empty();
+    _buffer[_head].~value_type();
+    _head = (_head + 1) & (_capacity - 1);
+    _size--;
+  }
+
+  void swap(deque& other) noexcept {
+    std::swap(_buffer, other._buffer);
+    std::swap(_capacity, other._capacity);
+    std::swap(_head, other._head);
+    std::swap(_size, other._size);
+  }
+
+  // ITERATORS
+
+  iterator begin() { return iterator(this, 0); }
+
+  iterator end() { return iterator(this, _size); }
+
+  const_iterator begin() const { return const_iterator(this, 0); }
+
+  const_iterator end() const { return const_iterator(this, _size); }
+
+ private:
+  size_type slot(size_type pos) const {
+    return (_head + pos) & (_capacity - 1);
+  }
+
+  void check_not_empty() const {
+    if (_size == 0) {
+      throw std::out_of_range("Deque is empty");
+    }
+  }
+
+  void grow_if_full() {
+    if (_size == _capacity) {
+      reallocate(_capacity == 0 ? kMinCapacity : _capacity * 2);
+    }
+  }
+
+  // Переносит элементы в начало нового буфера ёмкостью capacity. Старые
+  // элементы разрушаются только после того, как построены все новые: если
+  // копирование бросит, новый буфер освобождается, а деку это не затронет
+  void reallocate(size_type capacity) {
+    value_type* buffer = static_cast<value_type*>(::operator new(
+        capacity * sizeof(value_type), std::align_val_t(alignof(value_type))));
+    size_type built = 0;
+    try {
+      for (; built < _size; built++) {
+        new (buffer + built)
+            value_type(std::move_if_noexcept(_buffer[slot(built)]));
+      }
+    } catch (...) {
+      for (size_type i = 0; i < built; i++) buffer[i].~value_type();
+      ::operator delete(buffer, std::align_val_t(alignof(value_type)));
+      throw;
+    }
+    for (size_type i = 0; i < _size; i++) _buffer[slot(i)].~value_type();
+    ::operator delete(_buffer, std::align_val_t(alignof(value_type)));
+    _buffer = buffer;
+    _capacity = capacity;
+    _head = 0;
+  }
+
+ public:
+  // Итератор хранит логический индекс, поэтому остаётся валидным при росте
+  // буфера, но сдвигается при вставке и удалении в начале
+  template <typename Value>
+  class DequeIterator {
+    friend class deque;
+
+    using owner_type =
+        std::conditional_t<std::is_const_v<Value>, const deque, deque>;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    DequeIterator() : _owner(nullptr), _pos(0) {}
+
+    template <typename Other, typename = std::enable_if_t<
+                                  std::is_same_v<const Other, Value>>>
+    DequeIterator(const DequeIterator<Other>& other)
+        : _owner(other._owner), _pos(other._pos) {}
+
+    reference operator*() const { return (*_owner)[_pos]; }
+    pointer operator->() const { return &(*_owner)[_pos]; }
+    reference operator[](difference_type n) const {
+      return (*_owner)[_pos + n];
+    }
+
+    DequeIterator& operator++() {
+      _pos++;
+      return *this;
+    }
+    DequeIterator operator++(int) {
+      DequeIterator old(*this);
+      _pos++;
+      return old;
+    }
+    DequeIterator& operator--() {
+      _pos--;
+      return *this;
+    }
+    DequeIterator operator--(int) {
+      DequeIterator old(*this);
+      _pos--;
+      return old;
+    }
+
+    DequeIterator& operator+=(difference_type n) {
+      _pos += n;
+      return *this;
+    }
+    DequeIterator& operator-=(difference_type n) {
+      _pos -= n;
+      return *this;
+    }
+    DequeIterator operator+(difference_type n) const {
+      return DequeIterator(_owner, _pos + n);
+    }
+    DequeIterator operator-(difference_type n) const {
+      return DequeIterator(_owner, _pos - n);
+    }
+    difference_type operator-(const DequeIterator& other) const {
+      return static_cast<difference_type>(_pos) -
+             static_cast<difference_type>(other._pos);
+    }
+
+    bool operator==(const DequeIterator& other) const {
+      return _pos == other._pos && _owner == other._owner;
+    }
+    bool operator!=(const DequeIterator& other) const {
+      return !(*this == other);
+    }
+    bool operator<(const DequeIterator& other) const {
+      return _pos < other._pos;
+    }
+
+   private:
+    template <typename Other>
+    friend class DequeIterator;
+
+    DequeIterator(owner_type* owner, size_type pos)
+        : _owner(owner), _pos(pos) {}
+
+    owner_type* _owner;
+    size_type _pos;
+  };  // DequeIterator
+};  // class deque
+}  // namespace s21
+
+#endif  // S21_DEQUE_H_
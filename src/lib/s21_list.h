@@ -1,6 +1,10 @@
 #ifndef S21_LIST_H_
 #define S21_LIST_H_
 
+#include <memory>
+
+#include "s21_node_pool.h"
+
 // CONTENTS
 
 // - MEMBER_TYPE
@@ -12,13 +16,14 @@
 // - NODE_STRUCT
 
 namespace s21 {
-template <typename T>
+template <typename T, typename Alloc = shared_pool_allocator<T>>
 class list {
  public:
   class ListIterator;
   class ListConstIterator;
 
  private:
+  struct _link;
   struct _node;
 
  public:
@@ -30,19 +35,26 @@ class list {
   using const_iterator = ListConstIterator;
   using size_type = size_t;
   using pointer = struct _node*;
+  using allocator_type = Alloc;
 
  private:
-  pointer _first;
-  pointer _last;
+  using link_pointer = struct _link*;
+  using node_allocator = typename std::allocator_traits<
+      allocator_type>::template rebind_alloc<_node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  // Фиктивный узел _end хранится в самом списке и не содержит значения:
+  // пустой список ничего не выделяет. У первого узла _prev пустой, у _end
+  // пустой _next; _end._prev указывает на последний элемент
+  link_pointer _first;
+  struct _link _end;
   size_type _size;
+  node_allocator _alloc;
 
   // CONSTRUCTORS_DESTRUCTORS_AND_OPERATORS
 
  public:
-  list() : _first(nullptr), _last(nullptr), _size(0) {
-    _last = new _node({}, nullptr, nullptr);
-    _first = _last;
-  }
+  list() : _first(&_end), _size(0) {}
 
   list(size_type n) : list() {
     for (size_type i = 0; i < n; i++) {
@@ -62,17 +74,18 @@ class list {
     }
   }
 
+  // Узлы забираются целиком, перемещённый список остаётся пустым и
+  // пригодным для работы
   list(list&& l) : list() { *this = std::move(l); }
 
   list& operator=(list&& l) {
+    if (this == &l) {
+      return *this;
+    }
     clear();
-    delete _last;
-    _first = l._first;
-    _last = l._last;
-    _size = l._size;
-    l._first = nullptr;
-    l._last = nullptr;
-    l._size = 0;
+    _alloc = std::move(l._alloc);
+    attach(l._first, l._end._prev, l._size);
+    l.attach(nullptr, nullptr, 0);
     return *this;
   }
 
@@ -105,10 +118,7 @@ class list {
 
   bool operator!=(const list& other) { return !((*this) == other); }
 
-  ~list() {
-    clear();
-    delete _last;
-  }
+  ~list() { clear(); }
 
   // ELEMENT_ACCESS
 
@@ -116,114 +126,72 @@ class list {
     if (size() == 0) {
       throw std::out_of_range("List is empty");
     }
-    return _first->_value;
+    return value_of(_first);
   }
 
   const_reference back() {
     if (size() == 0) {
       throw std::out_of_range("List is empty");
     }
-    return _last->_prev->_value;
+    return value_of(_end._prev);
   }
 
   // MODIFIERS
 
   void clear() {
-    while (empty() == false) {
-      pop_front();
+    link_pointer node = _first;
+    while (node != &_end) {
+      link_pointer next = node->_next;
+      destroy_node(static_cast<pointer>(node));
+      node = next;
     }
+    attach(nullptr, nullptr, 0);
   }
 
   void pop_front() {
     if (empty() == false) {
-      _size--;
-      if (empty() == true) {
-        delete _first;
-        _first = nullptr;
-        _last->_prev = nullptr;
-      } else {
-        _first = _first->_next;
-        delete _first->_prev;
-        _first->_prev = nullptr;
-      }
+      link_pointer node = _first;
+      unlink(node, node, 1);
+      destroy_node(static_cast<pointer>(node));
     }
   }
 
   void pop_back() {
     if (empty() == false) {
-      _size--;
-      if (empty() == true) {
-        delete _first;
-        _first = nullptr;
-        _last->_prev = nullptr;
-      } else {
-        pointer to_remove = _last->_prev;
-        to_remove->_prev->_next = _last;
-        _last->_prev = to_remove->_prev;
-        delete to_remove;
-      }
+      link_pointer node = _end._prev;
+      unlink(node, node, 1);
+      destroy_node(static_cast<pointer>(node));
     }
   }
 
   void push_front(value_type value) {
-    if (empty() == true) {
-      _first = new _node(value, nullptr, _last);
-      _last->_prev = _first;
-    } else {
-      _first->_prev = new _node(value, nullptr, _first);
-      _first = _first->_prev;
-    }
+    pointer node = create_node(std::move(value));
+    link_before(_first, node, node);
     _size++;
   }
 
   void push_back(value_type value) {
-    if (empty() == true) {
-      _first = new _node(value, nullptr, _last);
-      _last->_prev = _first;
-    } else {
-      pointer lastValid = _last->_prev;
-      lastValid->_next = new _node(value, lastValid, _last);
-      _last->_prev = lastValid->_next;
-    }
+    pointer node = create_node(std::move(value));
+    link_before(&_end, node, node);
     _size++;
   }
 
   void erase(iterator pos) {
-    pointer _tmp = pos._current;
-    if (_tmp == _first) {
-      pop_front();
-    } else if (_tmp == _last->_prev) {
-      pop_back();
-    } else {
-      --_size;
-      _tmp->_prev->_next = _tmp->_next;
-      _tmp->_next->_prev = _tmp->_prev;
-      delete _tmp;
-    }
+    link_pointer node = pos._current;
+    unlink(node, node, 1);
+    destroy_node(static_cast<pointer>(node));
   }
 
   iterator insert(iterator pos, const_reference value) {
-    iterator new_it = iterator();
-    if (pos._current->_prev == nullptr) {
-      push_front(value);
-      new_it = begin();
-    } else if (pos == end()) {
-      push_back(value);
-      new_it = end();
-      --new_it;
-    } else {
-      pointer new_node = new _node(value, pos._current->_prev, pos._current);
-      pos._current->_prev->_next = new_node;
-      pos._current->_prev = new_node;
-      new_it = iterator(new_node);
-      _size++;
-    }
-    return new_it;
+    pointer node = create_node(value);
+    link_before(pos._current, node, node);
+    _size++;
+    return iterator(node);
   }
 
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args&&... args) {
-    list<value_type> temp = list();
+    list temp;
     (temp.push_front(args), ...);
     iterator new_pos = iterator();
     new_pos._current = pos._current;
@@ -240,52 +208,109 @@ class list {
 
   template <typename... Args>
   void insert_many_front(Args&&... args) {
-    list<value_type> temp = list();
+    list temp;
     (temp.push_back(args), ...);
     splice(begin(), temp);
   }
 
+  // Цепочки узлов меняются местами и перецепляются к фиктивным узлам
+  // списков. Итераторы end() после обмена недействительны
   void swap(list& other) {
-    list temp = other;
-    other = *this;
-    *this = temp;
+    if (this == &other) {
+      return;
+    }
+    link_pointer first = _first;
+    link_pointer last = _end._prev;
+    size_type size = _size;
+    attach(other._first, other._end._prev, other._size);
+    other.attach(first, last, size);
+    std::swap(_alloc, other._alloc);
   }
 
   void merge(list& other) {
-    if (this != &other) {
-      list<value_type> temp = list();
-      auto it_this = begin();
-      auto it_other = other.begin();
-      while (it_this != end() && it_other != other.end()) {
-        if (*it_this < *it_other) {
-          temp.push_back(*it_this);
-          it_this++;
-        } else {
-          temp.push_back(*it_other);
-          it_other++;
-        }
-      }
-      while (it_this != end()) {
-        temp.push_back(*it_this);
-        it_this++;
-      }
-      while (it_other != other.end()) {
-        temp.push_back(*it_other);
-        it_other++;
+    merge(other, [](const_reference a, const_reference b) { return a < b; });
+  }
+
+  // Слияние в один проход: узлы other перевешиваются в этот список, значения
+  // не копируются. При равенстве первым остаётся элемент этого списка
+  template <typename Compare>
+  void merge(list& other, Compare comp) {
+    if (this == &other || other.empty()) {
+      return;
+    }
+    link_pointer cur = _first;
+    while (other.empty() == false) {
+      if (cur == &_end) {
+        splice(end(), other);
+      } else if (comp(value_of(other._first), value_of(cur))) {
+        pointer node = take_node(other, other._first);
+        link_before(cur, node, node);
+        _size++;
+      } else {
+        cur = cur->_next;
       }
-      swap(temp);
-      other.clear();
     }
   }
 
-  void splice(iterator pos, list& other) {
-    other.reverse();
-    for (auto it = other.begin(); it != other.end(); ++it) {
-      pos = insert(pos, *it);
+  // Переносит все элементы other перед pos за O(1), если у списков общий
+  // пул узлов
+  void splice(const_iterator pos, list& other) {
+    if (this == &other || other.empty()) {
+      return;
+    }
+    if (_alloc != other._alloc) {
+      splice(pos, other, other.begin(), other.end());
+      return;
+    }
+    size_type count = other._size;
+    link_pointer first = other._first;
+    link_pointer last = other._end._prev;
+    other.unlink(first, last, count);
+    link_before(pos._current, first, last);
+    _size += count;
+  }
+
+  // Переносит элемент it из other перед pos за O(1)
+  void splice(const_iterator pos, list& other, const_iterator it) {
+    link_pointer node = it._current;
+    if (pos._current == node || pos._current == node->_next) {
+      return;
     }
-    other.clear();
+    node = take_node(other, node);
+    link_before(pos._current, node, node);
+    _size++;
   }
 
+  // Переносит [first, last) из other перед pos. Узлы перевешиваются за O(1),
+  // но для другого списка элементы диапазона нужно посчитать, чтобы
+  // поправить размеры
+  void splice(const_iterator pos, list& other, const_iterator first,
+              const_iterator last) {
+    if (first == last) {
+      return;
+    }
+    if (_alloc != other._alloc) {
+      for (link_pointer node = first._current; node != last._current;) {
+        link_pointer next = node->_next;
+        node = take_node(other, node);
+        link_before(pos._current, node, node);
+        _size++;
+        node = next;
+      }
+      return;
+    }
+    size_type count = 0;
+    if (this != &other) {
+      for (auto it = first; it != last; ++it) {
+        count++;
+      }
+    }
+    link_pointer from = first._current;
+    link_pointer to = last._current->_prev;
+    other.unlink(from, to, count);
+    link_before(pos._current, from, to);
+    _size += count;
+  }
   void reverse() {
     if (size() > 1) {
       auto forward = begin();
@@ -316,21 +341,42 @@ class list {
   }
 
   void sort() {
-    if (_size > 1) {
-      iterator begin = (*this).begin();
-      iterator middle = (*this).begin();
-      iterator end = --(*this).end();
-      for (int i = 0; i < ((int)_size - 1) / 2; i++) {
-        middle++;
+    sort([](const_reference a, const_reference b) { return a < b; });
+  }
+
+  // Восходящая сортировка слиянием: узлы только перевешиваются, значения не
+  // копируются и память не выделяется, итераторы остаются валидными.
+  // Сортировка устойчивая. bins[i] - отсортированная серия из 2^i узлов,
+  // собранных раньше серий из младших ячеек
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (_size < 2) {
+      return;
+    }
+    link_pointer bins[64] = {};
+    int used = 0;
+    _end._prev->_next = nullptr;
+    for (link_pointer node = _first; node != nullptr;) {
+      link_pointer carry = node;
+      node = node->_next;
+      carry->_next = nullptr;
+      int i = 0;
+      for (; i < used && bins[i] != nullptr; i++) {
+        carry = merge_runs(bins[i], carry, comp);
+        bins[i] = nullptr;
+      }
+      bins[i] = carry;
+      if (i == used) {
+        used++;
       }
-      iterator middle2 = middle;
-      middle2++;
-      list<value_type> left = split(begin, middle);
-      left.sort();
-      list<value_type> right = split(middle2, end);
-      right.sort();
-      *this = merge_sort(left, right);
     }
+    link_pointer result = nullptr;
+    for (int i = 0; i < used; i++) {
+      if (bins[i] != nullptr) {
+        result = result ? merge_runs(bins[i], result, comp) : bins[i];
+      }
+    }
+    relink(result);
   }
 
   // CAPACITY
@@ -347,45 +393,118 @@ class list {
 
   iterator begin() { return iterator(_first); }
 
-  iterator end() { return iterator(_last); }
+  iterator end() { return iterator(&_end); }
 
   const_iterator begin() const { return const_iterator(_first); }
 
-  const_iterator end() const { return iterator(_last); }
+  const_iterator end() const {
+    return const_iterator(const_cast<link_pointer>(&_end));
+  }
 
  private:
-  list<value_type> merge_sort(list<value_type>& left, list<value_type>& right) {
-    list<value_type> result;
-    while (left.empty() == false && right.empty() == false) {
-      if (left.front() < right.front()) {
-        result.push_back(left.front());
-        left.pop_front();
-      } else {
-        result.push_back(right.front());
-        right.pop_front();
-      }
+  static reference value_of(link_pointer node) {
+    return static_cast<pointer>(node)->_value;
+  }
+
+  template <typename... Args>
+  pointer create_node(Args&&... args) {
+    pointer node = node_traits::allocate(_alloc, 1);
+    try {
+      node_traits::construct(_alloc, node, std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(_alloc, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void destroy_node(pointer node) {
+    node_traits::destroy(_alloc, node);
+    node_traits::deallocate(_alloc, node, 1);
+  }
+
+  // Вынимает узел из other. Узел из чужого пула нельзя оставить этому
+  // списку: значение переносится в новый узел из своего пула
+  pointer take_node(list& other, link_pointer link) {
+    pointer node = static_cast<pointer>(link);
+    other.unlink(node, node, 1);
+    if (_alloc == other._alloc) {
+      return node;
+    }
+    pointer moved = create_node(std::move(node->_value));
+    other.destroy_node(node);
+    return moved;
+  }
+
+  // Делает список цепочкой first..last из size узлов; при size == 0 список
+  // становится пустым. Последний узел перецепляется к своему _end
+  void attach(link_pointer first, link_pointer last, size_type size) {
+    _size = size;
+    if (size == 0) {
+      _first = &_end;
+      _end._prev = nullptr;
+    } else {
+      _first = first;
+      _end._prev = last;
+      last->_next = &_end;
     }
-    while (left.empty() == false) {
-      result.push_back(left.front());
-      left.pop_front();
+  }
+
+  // Вставляет цепочку узлов from..to (включительно) перед pos
+  void link_before(link_pointer pos, link_pointer from, link_pointer to) {
+    from->_prev = pos->_prev;
+    to->_next = pos;
+    if (pos->_prev != nullptr) {
+      pos->_prev->_next = from;
+    } else {
+      _first = from;
     }
-    while (right.empty() == false) {
-      result.push_back(right.front());
-      right.pop_front();
+    pos->_prev = to;
+  }
+
+  // Вынимает из списка узлы from..to (включительно), count штук. После
+  // to всегда есть хотя бы фиктивный узел _end
+  void unlink(link_pointer from, link_pointer to, size_type count) {
+    if (from->_prev != nullptr) {
+      from->_prev->_next = to->_next;
+    } else {
+      _first = to->_next;
     }
-    return result;
+    to->_next->_prev = from->_prev;
+    _size -= count;
   }
 
-  list<value_type> split(iterator from, iterator to) {
-    list<value_type> result = list();
-    while (from != to && from != end()) {
-      result.push_back(*from);
-      ++from;
+  // Сливает две отсортированные цепочки по _next. При равенстве первым
+  // идёт узел из left, поэтому left должна быть более ранней серией
+  template <typename Compare>
+  static link_pointer merge_runs(link_pointer left, link_pointer right,
+                                 Compare& comp) {
+    link_pointer head = nullptr;
+    link_pointer* tail = &head;
+    while (left != nullptr && right != nullptr) {
+      if (comp(value_of(right), value_of(left))) {
+        *tail = right;
+        right = right->_next;
+      } else {
+        *tail = left;
+        left = left->_next;
+      }
+      tail = &(*tail)->_next;
     }
-    if (from != end()) {
-      result.push_back(*from);
+    *tail = left ? left : right;
+    return head;
+  }
+
+  // Восстанавливает _prev и концы списка по непустой цепочке _next
+  void relink(link_pointer head) {
+    _first = head;
+    head->_prev = nullptr;
+    while (head->_next != nullptr) {
+      head->_next->_prev = head;
+      head = head->_next;
     }
-    return result;
+    head->_next = &_end;
+    _end._prev = head;
   }
 
  public:
@@ -394,12 +513,12 @@ class list {
     friend class ListConstIterator;
 
    private:
-    pointer _current;
+    link_pointer _current;
 
    public:
     ListIterator() : _current(nullptr) {}
 
-    ListIterator(pointer node) : ListIterator() {
+    ListIterator(link_pointer node) : ListIterator() {
       if (node != nullptr) {
         _current = node;
       }
@@ -453,7 +572,11 @@ class list {
       if (_current == nullptr) {
         throw std::out_of_range("Attempt to dereference a nullptr.");
       }
-      return _current->_value;
+      if (_current->_next == nullptr) {
+        throw std::out_of_range(
+            "Attempt to dereference a past-the-end iterator.");
+      }
+      return value_of(_current);
     }
 
     bool operator==(const iterator& other) {
@@ -494,12 +617,12 @@ class list {
     friend class list;
 
    private:
-    pointer _current;
+    link_pointer _current;
 
    public:
     ListConstIterator() : _current(nullptr) {}
 
-    ListConstIterator(pointer node) : ListConstIterator() {
+    ListConstIterator(link_pointer node) : ListConstIterator() {
       if (node != nullptr) {
         _current = node;
       }
@@ -576,7 +699,11 @@ class list {
       if (_current == nullptr) {
         throw std::out_of_range("Attempt to dereference a nullptr.");
       }
-      return _current->_value;
+      if (_current->_next == nullptr) {
+        throw std::out_of_range(
+            "Attempt to dereference a past-the-end iterator.");
+      }
+      return value_of(_current);
     }
 
     const_iterator next() {
@@ -608,32 +735,19 @@ class list {
   // NODE_STRUCT
 
  private:
-  struct _node {
-    value_type _value;
-    _node* _next;
-    _node* _prev;
+  struct _link {
+    _link* _next;
+    _link* _prev;
 
-    _node() : _value(value_type()), _prev(nullptr), _next(nullptr) {}
-
-    _node(value_type _value, _node* _prev_pointer = nullptr,
-          _node* _next_pointer = nullptr) {
-      this->_next = _next_pointer;
-      this->_prev = _prev_pointer;
-      this->_value = _value;
-    }
+    _link() : _next(nullptr), _prev(nullptr) {}
+  };  // struct _link
 
-    _node& operator=(const _node& other) {
-      this->_value = other._value;
-      this->_next = other._next;
-      this->_prev = other._prev;
-      return *this;
-    }
-
-    bool operator==(const _node& other) { return _value == other._value; }
+  struct _node : _link {
+    value_type _value;
 
-    bool operator!=(const _node& other) { return !(*this == other); }
+    _node(const value_type& value) : _value(value) {}
 
-    ~_node() {}
+    _node(value_type&& value) : _value(std::move(value)) {}
   };  // struct _node
 
 };  // class list
@@ -7,41 +7,44 @@
 
 namespace s21 {
 
-template <typename K, typename V>
-class map : public tree<K, V> {
+template <typename K, typename V, typename Compare = std::less<K>>
+class map : public tree<K, V, Compare> {
  public:
   // CONSTRUCTORS
-  map() : tree<K, V>(){};
-  map(std::initializer_list<typename tree<K, V>::value_type> const &items)
-      : tree<K, V>(items){};
-  map(const map &m) : tree<K, V>(m){};
-  map(const std::pair<const K, V> &elem) : tree<K, V>(elem){};
-  map(map &&m) noexcept : tree<K, V>(std::move(m)){};
+  map() : tree<K, V, Compare>(){};
+  explicit map(const Compare &comp) : tree<K, V, Compare>(comp){};
+  map(std::initializer_list<typename tree<K, V, Compare>::value_type> const
+          &items)
+      : tree<K, V, Compare>(items){};
+  map(const map &m) : tree<K, V, Compare>(m){};
+  map(const std::pair<const K, V> &elem) : tree<K, V, Compare>(elem){};
+  map(map &&m) noexcept : tree<K, V, Compare>(std::move(m)){};
 
   // DESTRUCTOR
   ~map() = default;
 
   map &operator=(map &&m) noexcept {
-    tree<K, V>::operator=(std::move(m));
+    tree<K, V, Compare>::operator=(std::move(m));
     return *this;
   }
 
-  std::pair<typename map<K, V>::iterator, bool> insert(
-      const typename tree<K, V>::value_type &value) {
-    return tree<K, V>::add(value);
+  std::pair<typename map<K, V, Compare>::iterator, bool> insert(
+      const typename tree<K, V, Compare>::value_type &value) {
+    return tree<K, V, Compare>::add(value);
   }
 
-  std::pair<typename map<K, V>::iterator, bool> insert(const K &key,
-                                                       const V &obj) {
-    return tree<K, V>::add(key, obj);
+  std::pair<typename map<K, V, Compare>::iterator, bool> insert(
+      const K &key, const V &obj) {
+    return tree<K, V, Compare>::add(key, obj);
   }
 
-  std::pair<typename tree<K, V>::iterator, bool> insert_or_assign(
+  std::pair<typename tree<K, V, Compare>::iterator, bool> insert_or_assign(
       const K &key, const V &obj) {
-    return tree<K, V>::add_or_assign(key, obj);
+    return tree<K, V, Compare>::add_or_assign(key, obj);
   }
   V &operator[](const K &key) {
-    typename tree<K, V>::node *tmp = tree<K, V>::search(key);
+    typename tree<K, V, Compare>::node *tmp =
+        tree<K, V, Compare>::search(key);
 
     if (!tmp) {
       tmp = insert(key, V()).first.GetNode();
@@ -51,7 +54,8 @@ class map : public tree<K, V> {
   };
 
   V &at(const K &key) const {
-    typename tree<K, V>::node *tmp = tree<K, V>::search(key);
+    typename tree<K, V, Compare>::node *tmp =
+        tree<K, V, Compare>::search(key);
 
     if (!tmp) {
       throw std::out_of_range("Key not found");
@@ -60,12 +64,52 @@ class map : public tree<K, V> {
     return tmp->element_->second;
   };
 
+  typename tree<K, V, Compare>::iterator find(const K &key) {
+    typename tree<K, V, Compare>::node *tmp =
+        tree<K, V, Compare>::search(key);
+    return tmp ? typename tree<K, V, Compare>::iterator(tmp) : this->end();
+  }
+
+  // Поиск по ключу, сравнимому с K через прозрачный компаратор (std::less<>),
+  // например std::string_view для map<std::string, V, std::less<>>
+  template <typename Key, typename C = Compare,
+            typename = typename C::is_transparent>
+  typename tree<K, V, Compare>::iterator find(const Key &key) {
+    typename tree<K, V, Compare>::node *tmp =
+        tree<K, V, Compare>::findNode(key, this->root);
+    return tmp ? typename tree<K, V, Compare>::iterator(tmp) : this->end();
+  }
+
+  typename tree<K, V, Compare>::size_type count(const K &key) {
+    return tree<K, V, Compare>::search(key) ? 1 : 0;
+  }
+
+  template <typename Key, typename C = Compare,
+            typename = typename C::is_transparent>
+  typename tree<K, V, Compare>::size_type count(const Key &key) {
+    return tree<K, V, Compare>::findNode(key, this->root) ? 1 : 0;
+  }
+
+  typename tree<K, V, Compare>::iterator lower_bound(const K &key) {
+    typename tree<K, V, Compare>::node *tmp =
+        tree<K, V, Compare>::lowerNode(key, this->root);
+    return tmp ? typename tree<K, V, Compare>::iterator(tmp) : this->end();
+  }
+
+  template <typename Key, typename C = Compare,
+            typename = typename C::is_transparent>
+  typename tree<K, V, Compare>::iterator lower_bound(const Key &key) {
+    typename tree<K, V, Compare>::node *tmp =
+        tree<K, V, Compare>::lowerNode(key, this->root);
+    return tmp ? typename tree<K, V, Compare>::iterator(tmp) : this->end();
+  }
+
   template <class... Args>
-  std::vector<std::pair<typename map<K, V>::iterator, bool>> insert_many(
-      Args &&...args) {
-    std::vector<std::pair<typename map<K, V>::iterator, bool>> vec;
+  std::vector<std::pair<typename map<K, V, Compare>::iterator, bool>>
+  insert_many(Args &&...args) {
+    std::vector<std::pair<typename map<K, V, Compare>::iterator, bool>> vec;
     for (const auto &arg : {args...}) {
-      vec.push_back(tree<K, V>::add(arg));
+      vec.push_back(tree<K, V, Compare>::add(arg));
     }
     return vec;
   }
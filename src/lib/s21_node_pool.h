@@ -0,0 +1,368 @@
+#ifndef S21_NODE_POOL_H_
+#define S21_NODE_POOL_H_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+// CONTENTS
+
+// - NODE_POOL
+// - SHARED_POOL_ALLOCATOR
+// - POOL_ALLOCATOR
+// - THREAD_POOL_ALLOCATOR
+
+namespace s21 {
+
+// NODE_POOL
+
+// Пул блоков одного размера. Блоки нарезаются из slab'ов, которые растут
+// вдвое от kFirstSlab до kMaxSlab блоков; освобождённый блок кладётся в
+// free list и отдаётся следующему allocate. Память slab'ов возвращается
+// системе только в деструкторе пула
+class node_pool {
+ public:
+  static constexpr size_t kFirstSlab = 8;
+  static constexpr size_t kMaxSlab = 1024;
+
+  node_pool(size_t block_size, size_t block_align)
+      : _align(block_align < alignof(slab) ? alignof(slab) : block_align),
+        _block_size(round_up(
+            block_size < sizeof(free_block) ? sizeof(free_block) : block_size,
+            _align)),
+        _free(nullptr),
+        _slabs(nullptr),
+        _cursor(nullptr),
+        _remaining(0),
+        _next_slab(kFirstSlab) {}
+
+  node_pool(const node_pool&) = delete;
+  node_pool& operator=(const node_pool&) = delete;
+
+  ~node_pool() {
+    while (_slabs != nullptr) {
+      slab* next = _slabs->next;
+      ::operator delete(_slabs, std::align_val_t(_align));
+      _slabs = next;
+    }
+  }
+
+  void* allocate() {
+    if (_free != nullptr) {
+      free_block* block = _free;
+      _free = block->next;
+      return block;
+    }
+    if (_remaining == 0) {
+      add_slab();
+    }
+    void* block = _cursor;
+    _cursor += _block_size;
+    _remaining--;
+    return block;
+  }
+
+  void deallocate(void* p) noexcept {
+    free_block* block = static_cast<free_block*>(p);
+    block->next = _free;
+    _free = block;
+  }
+
+ private:
+  struct free_block {
+    free_block* next;
+  };
+
+  // Заголовок slab'а, блоки идут следом с отступом до _align
+  struct slab {
+    slab* next;
+  };
+
+  static size_t round_up(size_t n, size_t align) {
+    return (n + align - 1) / align * align;
+  }
+
+  void add_slab() {
+    size_t header = round_up(sizeof(slab), _align);
+    void* memory = ::operator new(header + _next_slab * _block_size,
+                                  std::align_val_t(_align));
+    slab* added = static_cast<slab*>(memory);
+    added->next = _slabs;
+    _slabs = added;
+    _cursor = static_cast<char*>(memory) + header;
+    _remaining = _next_slab;
+    if (_next_slab < kMaxSlab) {
+      _next_slab *= 2;
+    }
+  }
+
+  size_t _align;
+  size_t _block_size;
+  free_block* _free;
+  slab* _slabs;
+  char* _cursor;
+  size_t _remaining;
+  size_t _next_slab;
+};
+
+// SHARED_POOL_ALLOCATOR
+
+// Аллокатор по умолчанию для list: один node_pool на тип узла на весь
+// процесс. Все экземпляры равны, поэтому splice и merge между любыми
+// списками перевешивают узлы за O(1) и не портят итераторы, а узел можно
+// освободить в любом потоке. Поток держит свой кэш свободных блоков и
+// обращается к общему пулу под мьютексом только пачками по kBatch блоков;
+// при завершении потока кэш возвращается в общий пул. Общий пул никогда
+// не разрушается: узлы статических контейнеров освобождаются и после
+// выхода из main. Запросы больше одного элемента обслуживает
+// std::allocator
+template <typename T>
+class shared_pool_allocator {
+ public:
+  using value_type = T;
+  using is_always_equal = std::true_type;
+
+  static constexpr size_t kBatch = 32;
+
+  shared_pool_allocator() noexcept = default;
+
+  template <typename U>
+  shared_pool_allocator(const shared_pool_allocator<U>&) noexcept {}
+
+  T* allocate(size_t n) {
+    if (n != 1) {
+      return std::allocator<T>().allocate(n);
+    }
+    local_cache& cache = local();
+    if (cache.head == nullptr) {
+      if (cache.closed) {
+        return static_cast<T*>(global().allocate());
+      }
+      open(cache);
+      refill(cache);
+    }
+    free_block* block = cache.head;
+    cache.head = block->next;
+    cache.count--;
+    return reinterpret_cast<T*>(block);
+  }
+
+  void deallocate(T* p, size_t n) noexcept {
+    if (n != 1) {
+      std::allocator<T>().deallocate(p, n);
+      return;
+    }
+    local_cache& cache = local();
+    if (cache.head == nullptr) {
+      if (cache.closed) {
+        global().deallocate(p);
+        return;
+      }
+      open(cache);
+    }
+    free_block* block = reinterpret_cast<free_block*>(p);
+    block->next = cache.head;
+    cache.head = block;
+    if (++cache.count > 2 * kBatch) {
+      release(cache, kBatch);
+    }
+  }
+
+  friend bool operator==(const shared_pool_allocator&,
+                         const shared_pool_allocator&) {
+    return true;
+  }
+  friend bool operator!=(const shared_pool_allocator&,
+                         const shared_pool_allocator&) {
+    return false;
+  }
+
+ private:
+  struct free_block {
+    free_block* next;
+  };
+
+  struct shared_pool {
+    shared_pool() : blocks(sizeof(T), alignof(T)) {}
+
+    void* allocate() {
+      std::lock_guard<std::mutex> guard(lock);
+      return blocks.allocate();
+    }
+    void deallocate(void* p) noexcept {
+      std::lock_guard<std::mutex> guard(lock);
+      blocks.deallocate(p);
+    }
+
+    std::mutex lock;
+    node_pool blocks;
+  };
+
+  // Тривиально разрушаемый, поэтому доступен и после закрытия потока
+  struct local_cache {
+    free_block* head;
+    size_t count;
+    bool closed;
+  };
+
+  // Возвращает кэш потока в общий пул при завершении потока. После этого
+  // блоки идут прямо в общий пул
+  struct cache_closer {
+    ~cache_closer() {
+      release(*cache, cache->count);
+      cache->closed = true;
+    }
+    local_cache* cache;
+  };
+
+  static shared_pool& global() {
+    static shared_pool* pool = new shared_pool();
+    return *pool;
+  }
+
+  static local_cache& local() {
+    static thread_local local_cache cache = {nullptr, 0, false};
+    return cache;
+  }
+
+  // Заводит closer при первом блоке в кэше; дальше быстрый путь не
+  // проверяет инициализацию thread_local с деструктором
+  static void open(local_cache& cache) {
+    static thread_local cache_closer closer = {&cache};
+    (void)closer;
+  }
+
+  static void refill(local_cache& cache) {
+    shared_pool& pool = global();
+    std::lock_guard<std::mutex> guard(pool.lock);
+    for (size_t i = 0; i < kBatch; i++) {
+      free_block* block = static_cast<free_block*>(pool.blocks.allocate());
+      block->next = cache.head;
+      cache.head = block;
+      cache.count++;
+    }
+  }
+
+  static void release(local_cache& cache, size_t count) noexcept {
+    shared_pool& pool = global();
+    std::lock_guard<std::mutex> guard(pool.lock);
+    for (size_t i = 0; i < count; i++) {
+      free_block* block = cache.head;
+      cache.head = block->next;
+      pool.blocks.deallocate(block);
+    }
+    cache.count -= count;
+  }
+};
+
+// POOL_ALLOCATOR
+
+// Отдельный node_pool на каждый контейнер; пул создаётся вместе с
+// аллокатором, так что равенство экземпляров не меняется со временем.
+// Копии аллокатора разделяют пул и равны между собой, перемещение тоже
+// копирует; копия контейнера получает новый пул. При swap и перемещении
+// пул уходит вместе с узлами. Между контейнерами с разными пулами splice
+// и merge переносят значения в новые узлы. Запросы больше одного элемента
+// обслуживает std::allocator
+template <typename T>
+class pool_allocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  pool_allocator()
+      : _pool(std::make_shared<node_pool>(sizeof(T), alignof(T))) {}
+
+  // Перемещённый аллокатор должен остаться рабочим, поэтому перемещения
+  // нет и пул просто разделяется
+  pool_allocator(const pool_allocator&) noexcept = default;
+  pool_allocator& operator=(const pool_allocator&) noexcept = default;
+
+  // Блоки другого типа другого размера, поэтому пул не разделяется
+  template <typename U>
+  pool_allocator(const pool_allocator<U>&) : pool_allocator() {}
+
+  T* allocate(size_t n) {
+    if (n != 1) {
+      return std::allocator<T>().allocate(n);
+    }
+    return static_cast<T*>(_pool->allocate());
+  }
+
+  void deallocate(T* p, size_t n) noexcept {
+    if (n != 1) {
+      std::allocator<T>().deallocate(p, n);
+    } else {
+      _pool->deallocate(p);
+    }
+  }
+
+  pool_allocator select_on_container_copy_construction() const {
+    return pool_allocator();
+  }
+
+  friend bool operator==(const pool_allocator& a, const pool_allocator& b) {
+    return a._pool == b._pool;
+  }
+  friend bool operator!=(const pool_allocator& a, const pool_allocator& b) {
+    return a._pool != b._pool;
+  }
+
+ private:
+  std::shared_ptr<node_pool> _pool;
+};
+
+// THREAD_POOL_ALLOCATOR
+
+// Один node_pool на тип узла и поток, общий для всех контейнеров этого
+// потока. Все экземпляры равны, поэтому узлы можно перевешивать между
+// контейнерами (splice, merge) без копирования. Контейнер не должен
+// переживать поток, в котором создан, и использоваться из других потоков
+template <typename T>
+class thread_pool_allocator {
+ public:
+  using value_type = T;
+  using is_always_equal = std::true_type;
+
+  thread_pool_allocator() noexcept = default;
+
+  template <typename U>
+  thread_pool_allocator(const thread_pool_allocator<U>&) noexcept {}
+
+  T* allocate(size_t n) {
+    if (n != 1) {
+      return std::allocator<T>().allocate(n);
+    }
+    return static_cast<T*>(pool().allocate());
+  }
+
+  void deallocate(T* p, size_t n) noexcept {
+    if (n != 1) {
+      std::allocator<T>().deallocate(p, n);
+    } else {
+      pool().deallocate(p);
+    }
+  }
+
+  friend bool operator==(const thread_pool_allocator&,
+                         const thread_pool_allocator&) {
+    return true;
+  }
+  friend bool operator!=(const thread_pool_allocator&,
+                         const thread_pool_allocator&) {
+    return false;
+  }
+
+ private:
+  static node_pool& pool() {
+    static thread_local node_pool local(sizeof(T), alignof(T));
+    return local;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_NODE_POOL_H_
@@ -0,0 +1,259 @@
+#ifndef S21_PRIORITY_QUEUE_H_
+#define S21_PRIORITY_QUEUE_H_
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
+
+// CONTENTS
+
+// - MEMBER_TYPE
+// - CONSTRUCTORS_DESTRUCTORS_AND_OPERATORS
+// - ELEMENT_ACCESS
+// - CAPACITY
+// - MODIFIERS
+// - HEAP
+
+namespace s21 {
+// Очередь с приоритетом: d-арная куча в контейнере с произвольным доступом
+// (по умолчанию s21::vector). На вершине - наибольший по Compare элемент,
+// для минимума нужен std::greater. У узла i дети Arity * i + 1 ...
+// Arity * i + Arity. При Arity = 4 куча вдвое ниже двоичной, а дети узла
+// лежат рядом в памяти: просеивание вниз делает меньше промахов кэша, хотя
+// и сравнивает больше детей на уровне
+template <typename T, typename Container = vector<T>,
+          typename Compare = std::less<T>, size_t Arity = 4>
+class priority_queue {
+  static_assert(Arity >= 2, "priority_queue arity must be at least 2");
+
+ public:
+  // MEMBER_TYPE
+  using value_type = T;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = size_t;
+  using container_type = Container;
+  using value_compare = Compare;
+
+  static constexpr size_type arity = Arity;
+
+ private:
+  container_type _c;
+  value_compare _comp;
+
+  // CONSTRUCTORS_DESTRUCTORS_AND_OPERATORS
+
+ public:
+  priority_queue() : _c(), _comp() {}
+
+  explicit priority_queue(const value_compare& comp) : _c(), _comp(comp) {}
+
+  // Куча строится из содержимого контейнера за O(n)
+  priority_queue(const value_compare& comp, const container_type& c)
+      : _c(c), _comp(comp) {
+    make_heap();
+  }
+
+  priority_queue(const value_compare& comp, container_type&& c)
+      : _c(std::move(c)), _comp(comp) {
+    make_heap();
+  }
+
+  template <typename InputIt>
+  priority_queue(InputIt first, InputIt last,
+                 const value_compare& comp = value_compare())
+      : _c(), _comp(comp) {
+    push_range(first, last);
+  }
+
+  priority_queue(std::initializer_list<value_type> const& items)
+      : priority_queue(items.begin(), items.end()) {}
+
+  priority_queue(const priority_queue& q) : _c(q._c), _comp(q._comp) {}
+
+  priority_queue(priority_queue&& q)
+      : _c(std::move(q._c)), _comp(std::move(q._comp)) {}
+
+  priority_queue& operator=(priority_queue&& q) {
+    _c = std::move(q._c);
+    _comp = std::move(q._comp);
+    return *this;
+  }
+
+  priority_queue& operator=(const priority_queue& q) {
+    _c = q._c;
+    _comp = q._comp;
+    return *this;
+  }
+
+  ~priority_queue() {}
+
+  // ELEMENT_ACCESS
+
+  const_reference top() {
+    if (size() == 0) {
+      throw std::out_of_range("Priority queue is empty");
+    }
+    return *_c.begin();
+  }
+
+  // MODIFIERS
+
+  void clear() { _c.clear(); }
+
+  void pop() {
+    if (empty()) {
+      return;
+    }
+    auto base = _c.begin();
+    size_type last = size() - 1;
+    if (last == 0) {
+      _c.pop_back();
+      return;
+    }
+    value_type value = std::move(base[last]);
+    _c.pop_back();
+    // Последний элемент почти всегда возвращается к листьям, поэтому дырка
+    // от вершины сразу спускается до листа по лучшим детям, без сравнений с
+    // ним, и уже оттуда он всплывает на место (приём Флойда)
+    size_type index = sink_hole();
+    base[index] = std::move(value);
+    sift_up(index);
+  }
+
+  void push(const_reference value) {
+    _c.push_back(value);
+    sift_up(size() - 1);
+  }
+
+  void push(value_type&& value) {
+    _c.push_back(std::move(value));
+    sift_up(size() - 1);
+  }
+
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    _c.emplace_back(std::forward<Args>(args)...);
+    sift_up(size() - 1);
+  }
+
+  // Добавляет элементы [first, last). Если их не меньше, чем уже лежит в
+  // куче, она перестраивается целиком за O(n), иначе каждый новый элемент
+  // всплывает за O(log n)
+  template <typename InputIt>
+  void push_range(InputIt first, InputIt last) {
+    size_type old_size = size();
+    for (; first != last; ++first) {
+      _c.push_back(*first);
+    }
+    size_type added = size() - old_size;
+    if (added >= old_size) {
+      make_heap();
+    } else {
+      for (size_type i = old_size; i < old_size + added; i++) {
+        sift_up(i);
+      }
+    }
+  }
+
+  template <typename Range>
+  void push_range(const Range& range) {
+    push_range(std::begin(range), std::end(range));
+  }
+
+  void swap(priority_queue& other) {
+    _c.swap(other._c);
+    std::swap(_comp, other._comp);
+  }
+
+  // CAPACITY
+
+  bool empty() { return _c.empty(); }
+
+  size_type size() { return _c.size(); }
+
+  // HEAP
+
+ private:
+  // Просеивание с «дыркой»: элемент переносится один раз, а не меняется
+  // местами на каждом уровне
+  void sift_up(size_type index) {
+    auto base = _c.begin();
+    value_type value = std::move(base[index]);
+    while (index > 0) {
+      size_type parent = (index - 1) / Arity;
+      if (!_comp(base[parent], value)) {
+        break;
+      }
+      base[index] = std::move(base[parent]);
+      index = parent;
+    }
+    base[index] = std::move(value);
+  }
+
+  void sift_down(size_type index) {
+    auto base = _c.begin();
+    size_type count = size();
+    value_type value = std::move(base[index]);
+    for (;;) {
+      size_type first = index * Arity + 1;
+      if (first >= count) {
+        break;
+      }
+      size_type best = best_child(first, count);
+      if (!_comp(value, base[best])) {
+        break;
+      }
+      base[index] = std::move(base[best]);
+      index = best;
+    }
+    base[index] = std::move(value);
+  }
+
+  // Спускает дырку с вершины до листа, поднимая лучших детей. Возвращает
+  // позицию дырки
+  size_type sink_hole() {
+    auto base = _c.begin();
+    size_type count = size();
+    size_type index = 0;
+    for (;;) {
+      size_type first = index * Arity + 1;
+      if (first >= count) {
+        return index;
+      }
+      size_type best = best_child(first, count);
+      base[index] = std::move(base[best]);
+      index = best;
+    }
+  }
+
+  size_type best_child(size_type first, size_type count) {
+    auto base = _c.begin();
+    size_type end = first + Arity < count ? first + Arity : count;
+    size_type best = first;
+    for (size_type child = first + 1; child < end; child++) {
+      if (_comp(base[best], base[child])) {
+        best = child;
+      }
+    }
+    return best;
+  }
+
+  // Построение Флойда: просеивание вниз от последнего родителя, O(n)
+  void make_heap() {
+    size_type count = size();
+    if (count < 2) {
+      return;
+    }
+    for (size_type i = (count - 2) / Arity + 1; i > 0; i--) {
+      sift_down(i - 1);
+    }
+  }
+};  // class priority_queue
+}  // namespace s21
+
+#endif  // S21_PRIORITY_QUEUE_H_
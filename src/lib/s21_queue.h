@@ -1,6 +1,13 @@
 #ifndef S21_QUEUE_H_
 #define S21_QUEUE_H_
 
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_deque.h"
+
 // CONTENTS
 
 // - MEMBER_TYPE
@@ -8,70 +15,52 @@
 // - ELEMENT_ACCESS
 // - CAPACITY
 // - MODIFIERS
-// - NODE_STRUCT
 
 namespace s21 {
-template <typename T>
+// Адаптер над контейнером с front, back, push_back и pop_front. По умолчанию
+// элементы лежат в кольцевом буфере s21::deque, память выделяется только
+// при его росте
+template <typename T, typename Container = deque<T>>
 class queue {
- private:
-  struct _node;
-
  public:
   // MEMBER_TYPE
   using value_type = T;
   using reference = value_type&;
   using const_reference = const value_type&;
   using size_type = size_t;
-  using pointer = struct _node*;
+  using container_type = Container;
 
  private:
-  pointer _first;
-  pointer _last;
-  size_type _size;
+  container_type _c;
 
   // CONSTRUCTORS_DESTRUCTORS_AND_OPERATORS
 
  public:
-  queue() : _first(nullptr), _last(nullptr), _size(0) {}
+  queue() : _c() {}
+
+  explicit queue(const container_type& c) : _c(c) {}
+
+  explicit queue(container_type&& c) : _c(std::move(c)) {}
 
   queue(std::initializer_list<value_type> const& items) : queue() {
-    for (auto it = items.begin(); it != items.end(); ++it) {
-      push(*it);
-    }
+    push_range(items.begin(), items.end());
   }
 
-  queue(const queue& l) : queue() {
-    _node* cur = l._first;
-    while (cur != nullptr) {
-      push(cur->_value);
-      cur = cur->_prev;
-    }
-  }
+  queue(const queue& l) : _c(l._c) {}
 
-  queue(queue&& l) : queue() { *this = std::move(l); }
+  queue(queue&& l) : _c(std::move(l._c)) {}
 
   queue& operator=(queue&& l) {
-    clear();
-    _first = l._first;
-    _last = l._last;
-    _size = l._size;
-    l._first = nullptr;
-    l._last = nullptr;
-    l._size = 0;
+    _c = std::move(l._c);
     return *this;
   }
 
   queue& operator=(const queue& l) {
-    clear();
-    _node* cur = l._first;
-    while (cur != nullptr) {
-      push(cur->_value);
-      cur = cur->_prev;
-    }
+    _c = l._c;
     return *this;
   }
 
-  ~queue() { clear(); }
+  ~queue() {}
 
   // ELEMENT_ACCESS
 
@@ -79,100 +68,60 @@ class queue {
     if (size() == 0) {
       throw std::out_of_range("Queue is empty");
     }
-    return _first->_value;
+    return _c.front();
   }
 
   const_reference back() {
     if (size() == 0) {
       throw std::out_of_range("Queue is empty");
     }
-    return _last->_value;
+    return _c.back();
   }
 
   // MODIFIERS
 
-  void clear() {
-    while (empty() == false) {
-      pop();
-    }
-  }
+  void clear() { _c.clear(); }
 
   void pop() {
     if (empty() == false) {
-      _size--;
-      pointer temp = _first;
-      _first = _first->_prev;
-      delete temp;
-      if (_first == nullptr) {
-        _last = nullptr;
-      }
+      _c.pop_front();
     }
   }
 
-  void push(value_type value) {
-    if (empty() == true) {
-      _first = new _node(value);
-      _last = _first;
-    } else {
-      _last->_prev = new _node(value);
-      _last = _last->_prev;
-    }
-    _size++;
-  }
+  void push(const_reference value) { _c.push_back(value); }
 
-  template <typename... Args>
-  void insert_many_back(Args&&... args) {
-    (push(args), ...);
-  }
+  void push(value_type&& value) { _c.push_back(std::move(value)); }
 
-  void swap(queue& other) {
-    queue temp = other;
-    other = *this;
-    *this = temp;
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    _c.emplace_back(std::forward<Args>(args)...);
   }
 
-  // CAPACITY
-
-  bool empty() { return _first == nullptr ? true : false; }
-
-  size_type size() { return _size; }
-
- private:
-  struct _node {
-    value_type _value;
-    _node* _prev;
-
-    _node() : _prev(nullptr), _value(value_type()) {}
-
-    _node(value_type _value, _node* _prev_pointer = nullptr) {
-      this->_prev = _prev_pointer;
-      this->_value = _value;
+  // Ставит в очередь элементы [first, last) по порядку
+  template <typename InputIt>
+  void push_range(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      _c.push_back(*first);
     }
+  }
 
-    _node& operator=(const _node& other) {
-      this->_value = other._value;
-      this->_prev = other._prev;
-      return *this;
-    }
+  template <typename Range>
+  void push_range(const Range& range) {
+    push_range(std::begin(range), std::end(range));
+  }
 
-    bool operator==(const _node& other) { return _value == other._value; }
+  template <typename... Args>
+  void insert_many_back(Args&&... args) {
+    (push(std::forward<Args>(args)), ...);
+  }
 
-    bool operator!=(const _node& other) { return !(*this == other); }
+  void swap(queue& other) { _c.swap(other._c); }
 
-    void print_node() {
-      std::cout << "prev:  ";
-      if (_prev != nullptr) {
-        std::cout << _prev->_value << "\n";
-      } else {
-        std::cout << "nullptr\n";
-      }
-      std::cout << "value: " << _value << "\nnext:  ";
-      std::cout << "\n";
-    }
+  // CAPACITY
 
-    ~_node() {}
-  };  // struct _node
+  bool empty() { return _c.empty(); }
 
+  size_type size() { return _c.size(); }
 };  // class queue
 }  // namespace s21
 
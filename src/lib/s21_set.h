@@ -7,8 +7,8 @@
 #include "s21_vector.h"
 
 namespace s21 {
-template <typename K>
-class set : public tree<K, K> {
+template <typename K, typename Compare = std::less<K>>
+class set : public tree<K, K, Compare> {
  public:
   class ConstSetIterator;
   class SetIterator;
@@ -20,39 +20,42 @@ class set : public tree<K, K> {
   using const_iterator = ConstSetIterator;
   using iterator = SetIterator;
 
-  set() : tree<K, K>(){};
+  set() : tree<K, K, Compare>(){};
 
-  set(const set &s) : tree<K, K>(s){};
+  explicit set(const Compare &comp) : tree<K, K, Compare>(comp){};
 
-  set(set &&s) : tree<K, K>(std::move(s)){};
+  set(const set &s) : tree<K, K, Compare>(s){};
+
+  set(set &&s) : tree<K, K, Compare>(std::move(s)){};
 
   set &operator=(set &&s) noexcept {
-    tree<K, K>::operator=(std::move(s));
+    tree<K, K, Compare>::operator=(std::move(s));
     return *this;
   }
 
-  set(std::initializer_list<value_type> const &items) : tree<K, K>() {
-    for (value_type i : items) tree<K, K>::add({i, i});
+  set(std::initializer_list<value_type> const &items) : tree<K, K, Compare>() {
+    for (value_type i : items) tree<K, K, Compare>::add({i, i});
   };
 
   ~set() = default;
 
-  class ConstSetIterator : public tree<K, K>::const_iterator {
+  class ConstSetIterator : public tree<K, K, Compare>::const_iterator {
    public:
-    using tree<K, K>::const_iterator::current_;
+    using tree<K, K, Compare>::const_iterator::current_;
 
-    using tree<K, K>::const_iterator::operatorPlus;
-    using tree<K, K>::const_iterator::operatorMinus;
+    using tree<K, K, Compare>::const_iterator::operatorPlus;
+    using tree<K, K, Compare>::const_iterator::operatorMinus;
 
     ConstSetIterator(const ConstSetIterator &) = default;
 
     ConstSetIterator(ConstSetIterator &&) noexcept = default;
     ConstSetIterator &operator=(ConstSetIterator &&) noexcept = default;
 
-    ConstSetIterator(typename tree<K, K>::node *node_)
-        : tree<K, K>::const_iterator(node_){};
+    ConstSetIterator(typename tree<K, K, Compare>::node *node_)
+        : tree<K, K, Compare>::const_iterator(node_){};
 
-    ConstSetIterator(tree<K, K> *tree_) : tree<K, K>::const_iterator(tree_){};
+    ConstSetIterator(tree<K, K, Compare> *tree_)
+        : tree<K, K, Compare>::const_iterator(tree_){};
 
     ~ConstSetIterator() = default;
 
@@ -107,9 +110,10 @@ class set : public tree<K, K> {
     using ConstSetIterator::operatorPlus;
 
    public:
-    SetIterator(typename tree<K, K>::node *node_) : ConstSetIterator(node_){};
+    SetIterator(typename tree<K, K, Compare>::node *node_)
+        : ConstSetIterator(node_){};
 
-    SetIterator(tree<K, K> *tree_) : ConstSetIterator(tree_){};
+    SetIterator(tree<K, K, Compare> *tree_) : ConstSetIterator(tree_){};
 
     ~SetIterator() = default;
 
@@ -167,7 +171,7 @@ class set : public tree<K, K> {
     if (!this->root) throw std::out_of_range("tree does not exist");
     auto tmp = this->findMin(this->root);
     while (tmp->parent &&
-           tmp->parent->element_->first == tmp->element_->first) {
+           tree<K, K, Compare>::equivalent(tmp->parent, tmp)) {
       tmp = tmp->parent;
     }
     return iterator(tmp);
@@ -178,24 +182,54 @@ class set : public tree<K, K> {
   }
 
   void erase(iterator pos) {
-    auto it = tree<K, K>::search(pos.GetNode()->element_->first);
-    tree<K, K>::erase(it);
+    auto it = tree<K, K, Compare>::search(pos.GetNode()->element_->first);
+    tree<K, K, Compare>::erase(it);
   }
 
   iterator find(const Key &key) {
-    auto tmp = tree<K, K>::search(key);
+    auto tmp = tree<K, K, Compare>::search(key);
+    return tmp ? iterator(tmp) : this->end();
+  }
+
+  // Поиск по ключу, сравнимому с K через прозрачный компаратор (std::less<>)
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const Other &key) {
+    auto tmp = tree<K, K, Compare>::findNode(key, this->root);
+    return tmp ? iterator(tmp) : this->end();
+  }
+
+  size_type count(const Key &key) {
+    return tree<K, K, Compare>::search(key) ? 1 : 0;
+  }
+
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type count(const Other &key) {
+    return tree<K, K, Compare>::findNode(key, this->root) ? 1 : 0;
+  }
+
+  iterator lower_bound(const Key &key) {
+    auto tmp = tree<K, K, Compare>::lowerNode(key, this->root);
+    return tmp ? iterator(tmp) : this->end();
+  }
+
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const Other &key) {
+    auto tmp = tree<K, K, Compare>::lowerNode(key, this->root);
     return tmp ? iterator(tmp) : this->end();
   }
 
   std::pair<iterator, bool> insert(const value_type &value) {
-    auto tmp = tree<K, K>::add(value, value);
+    auto tmp = tree<K, K, Compare>::add(value, value);
     return {iterator(tmp.first.GetNode()), tmp.second};
   }
 
   template <class... Args>
-  std::vector<std::pair<typename set<K>::iterator, bool>> insert_many(
-      Args &&...args) {
-    std::vector<std::pair<typename set<K>::iterator, bool>> vec;
+  std::vector<std::pair<typename set<K, Compare>::iterator, bool>>
+  insert_many(Args &&...args) {
+    std::vector<std::pair<typename set<K, Compare>::iterator, bool>> vec;
     for (const auto &arg : {args...}) {
       vec.push_back(insert(arg));
     }
@@ -205,7 +239,8 @@ class set : public tree<K, K> {
   size_type max_size() { return (SIZE_MAX / sizeof(value_type)) / 10; }
 
   K &operator[](const K &key) {
-    typename tree<K, K>::node *tmp = tree<K, K>::search(key);
+    typename tree<K, K, Compare>::node *tmp =
+        tree<K, K, Compare>::search(key);
 
     if (!tmp) {
       tmp = insert(key, K()).first.GetNode();
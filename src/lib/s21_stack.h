@@ -1,6 +1,13 @@
 #ifndef S21_STACK_H_
 #define S21_STACK_H_
 
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
+
 // CONTENTS
 
 // - MEMBER_TYPE
@@ -8,66 +15,52 @@
 // - ELEMENT_ACCESS
 // - CAPACITY
 // - MODIFIERS
-// - NODE_STRUCT
 
 namespace s21 {
-template <typename T>
+// Адаптер над контейнером с back, push_back и pop_back. По умолчанию
+// элементы лежат подряд в s21::vector: push и pop не выделяют память, пока
+// хватает ёмкости, а копирование стека - одно копирование буфера
+template <typename T, typename Container = vector<T>>
 class stack {
- private:
-  struct _node;
-
  public:
   // MEMBER_TYPE
   using value_type = T;
   using reference = value_type&;
   using const_reference = const value_type&;
   using size_type = size_t;
-  using pointer = struct _node*;
+  using container_type = Container;
 
  private:
-  pointer _top;
-  size_type _size;
+  container_type _c;
 
   // CONSTRUCTORS_DESTRUCTORS_AND_OPERATORS
 
  public:
-  stack() : _top(nullptr), _size(0) {}
+  stack() : _c() {}
+
+  explicit stack(const container_type& c) : _c(c) {}
+
+  explicit stack(container_type&& c) : _c(std::move(c)) {}
 
   stack(std::initializer_list<value_type> const& items) : stack() {
-    for (auto it = items.begin(); it != items.end(); ++it) {
-      push(*it);
-    }
+    push_range(items.begin(), items.end());
   }
 
-  stack(const stack& s) : stack() { *this = s; }
+  stack(const stack& s) : _c(s._c) {}
 
-  stack(stack&& s) : stack() { *this = std::move(s); }
+  stack(stack&& s) : _c(std::move(s._c)) {}
 
   stack& operator=(stack&& s) {
-    clear();
-    _top = s._top;
-    _size = s._size;
-    s._top = nullptr;
-    s._size = 0;
+    _c = std::move(s._c);
     return *this;
   }
 
   stack& operator=(const stack& s) {
-    clear();
-    _node* cur = s._top;
-    stack temp;
-    while (cur != nullptr) {
-      temp.push(cur->_value);
-      cur = cur->_prev;
-    }
-    while (temp.empty() == false) {
-      push(temp.top());
-      temp.pop();
-    }
+    _c = s._c;
     return *this;
   }
 
-  ~stack() { clear(); }
+  ~stack() {}
 
   // ELEMENT_ACCESS
 
@@ -75,93 +68,58 @@ class stack {
     if (size() == 0) {
       throw std::out_of_range("Stack is empty");
     }
-    return _top->_value;
+    return _c.back();
   }
 
   // MODIFIERS
 
-  void clear() {
-    while (empty() == false) {
-      pop();
-    }
-  }
+  void clear() { _c.clear(); }
 
   void pop() {
     if (empty() == false) {
-      _size--;
-      pointer temp = _top;
-      _top = _top->_prev;
-      delete temp;
+      _c.pop_back();
     }
   }
 
-  void push(value_type value) {
-    if (empty() == true) {
-      _top = new _node(value);
-    } else {
-      _top = new _node(value, _top);
-    }
-    _size++;
-  }
+  void push(const_reference value) { _c.push_back(value); }
+
+  void push(value_type&& value) { _c.push_back(std::move(value)); }
 
   template <typename... Args>
-  void insert_many_front(Args&&... args) {
-    stack<value_type> temp = stack();
-    (temp.push(args), ...);
-    while (temp.empty() == false) {
-      push(temp.top());
-      temp.pop();
-    }
+  void emplace(Args&&... args) {
+    _c.emplace_back(std::forward<Args>(args)...);
   }
 
-  void swap(stack& other) {
-    stack temp = other;
-    other = *this;
-    *this = temp;
+  // Кладёт элементы [first, last) по порядку, последний окажется на вершине
+  template <typename InputIt>
+  void push_range(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      _c.push_back(*first);
+    }
   }
 
-  // CAPACITY
-
-  bool empty() { return _top == nullptr ? true : false; }
-
-  size_type size() { return _size; }
-
- private:
-  struct _node {
-    value_type _value;
-    _node* _prev;
-
-    _node() : _prev(nullptr), _value(value_type()) {}
-
-    _node(value_type _value, _node* _prev_pointer = nullptr) {
-      this->_prev = _prev_pointer;
-      this->_value = _value;
-    }
+  template <typename Range>
+  void push_range(const Range& range) {
+    push_range(std::begin(range), std::end(range));
+  }
 
-    _node& operator=(const _node& other) {
-      this->_value = other._value;
-      this->_prev = other._prev;
-      return *this;
+  template <typename... Args>
+  void insert_many_front(Args&&... args) {
+    if constexpr (sizeof...(Args) > 0) {
+      value_type items[] = {value_type(std::forward<Args>(args))...};
+      for (size_type i = sizeof...(Args); i > 0; i--) {
+        _c.push_back(std::move(items[i - 1]));
+      }
     }
+  }
 
-    bool operator==(const _node& other) { return _value == other._value; }
-
-    bool operator!=(const _node& other) { return !(*this == other); }
+  void swap(stack& other) { _c.swap(other._c); }
 
-    void print_node() {
-      std::cout << "prev:  ";
-      if (_prev != nullptr) {
-        std::cout << _prev->_value << "\n";
-      } else {
-        std::cout << "nullptr\n";
-      }
-      std::cout << "value: " << _value << "\nnext:  ";
-      std::cout << "\n";
-    }
+  // CAPACITY
 
-    ~_node() {}
-  };  // struct _node
+  bool empty() { return _c.empty(); }
 
+  size_type size() { return _c.size(); }
 };  // class stack
 }  // namespace s21
 
@@ -1,8 +1,11 @@
 #ifndef __TREE_H__
 #define __TREE_H__
 
+#include <functional>
+#include <type_traits>
+
 namespace s21 {
-template <typename K, typename V>
+template <typename K, typename V, typename Compare = std::less<K>>
 class tree {
  public:
   //   Member type
@@ -25,6 +28,10 @@ class tree {
   // Тип размера, используемый для представления размера дерева
   using size_type = size_t;
 
+  // Тип компаратора ключей. Объект компаратора хранится в дереве, как в
+  // std::map, поэтому у него может быть состояние
+  using key_compare = Compare;
+
   class node {
    public:
     value_type *element_;
@@ -50,9 +57,11 @@ class tree {
 
   node *root = nullptr;
   unsigned int count = 0;
+  key_compare comp = key_compare();
 
   // CONSTRUCTORS
   tree() noexcept;
+  explicit tree(const key_compare &comparator) noexcept;
   tree(const value_type &elem) noexcept;
   tree(std::initializer_list<value_type> const &items) noexcept;
   tree(tree &&other) noexcept;
@@ -68,9 +77,9 @@ class tree {
   // ITERATORS
   class const_iterator {
    public:
-    using value_type = typename tree<K, V>::value_type;
+    using value_type = typename tree<K, V, Compare>::value_type;
 
-    typename tree<K, V>::node *current_;
+    typename tree<K, V, Compare>::node *current_;
     void operatorPlus() {
       node *tmp = current_;
       if (current_->right) {
@@ -104,8 +113,9 @@ class tree {
     }
 
    public:
-    const_iterator(const tree<K, V> *tree) : current_(tree->root){};
-    const_iterator(typename tree<K, V>::node *node_) : current_(node_){};
+    const_iterator(const tree<K, V, Compare> *tree) : current_(tree->root){};
+    const_iterator(typename tree<K, V, Compare>::node *node_)
+        : current_(node_){};
     const_iterator(const const_iterator &other) : current_(other.current_){};
     // Операторы сравнения
     bool operator==(const const_iterator &other) const {
@@ -160,7 +170,7 @@ class tree {
       }
     }
 
-    tree<K, V>::node *GetNode() { return this->current_; }
+    tree<K, V, Compare>::node *GetNode() { return this->current_; }
   };
 
   class iterator : public const_iterator {
@@ -171,8 +181,9 @@ class tree {
     using const_iterator::operatorPlus;
 
    public:
-    iterator(tree<K, V> *tree) : const_iterator(tree) {}
-    iterator(typename tree<K, V>::node *node_) : const_iterator(node_) {}
+    iterator(tree<K, V, Compare> *tree) : const_iterator(tree) {}
+    iterator(typename tree<K, V, Compare>::node *node_)
+        : const_iterator(node_) {}
 
     iterator operator++() {
       if (current_) {
@@ -228,10 +239,10 @@ class tree {
   iterator end() const;
 
   // Проверяет, пустое ли дерево
-  bool empty();
+  bool empty() const;
 
   // Возвращает количество элементов в дереве
-  size_type size();
+  size_type size() const;
 
   // Возвращает максимально возможное количество элементов в дереве
   size_type max_size();
@@ -254,8 +265,8 @@ class tree {
 
   // Вставляет пару ключ-значение в дерево или обновляет значение существующего
   // ключа, если он уже присутствует, и возвращает пару, содержащую итератор на
-  // вставленный или обновленный элемент и флаг, указывающий, был ли элемент
-  // вставлен или обновлен
+  // вставленный или обновленный элемент и флаг, равный true, если элемент
+  // был вставлен
   std::pair<iterator, bool> add_or_assign(const K &key, const V &obj);
 
   // Обменивает содержимое данного дерева с содержимым другого дерева
@@ -286,6 +297,29 @@ class tree {
   // Проверяет, содержит ли дерево узел с указанным ключом
   bool contains(const K &key);
 
+  // Проверяет наличие ключа, сравнимого с K через прозрачный компаратор,
+  // без построения временного K
+  template <typename Key, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const Key &key) {
+    return findNode(key, this->root);
+  }
+
+  // Возвращает объект компаратора ключей
+  key_compare key_comp() const { return comp; }
+
+  // Сравнивает два ключа компаратором дерева
+  template <typename A, typename B>
+  bool compare(const A &a, const B &b) const {
+    return comp(a, b);
+  }
+
+  // Проверяет эквивалентность ключей двух узлов
+  bool equivalent(const node *a, const node *b) const {
+    return !compare(a->element_->first, b->element_->first) &&
+           !compare(b->element_->first, a->element_->first);
+  }
+
  protected:
   // Находит узел с минимальным значением ключа в дереве, начиная с указанного
   // родительского узла, и возвращает указатель на этот узел
@@ -296,15 +330,30 @@ class tree {
   node *findMax(const node *parent_node) const;
 
   unsigned int *setCount();
+
+  // Ставит поддерево new_node на место узла old_node у его родителя
+  void replaceNode(node *old_node, node *new_node);
+
+  // Ищет узел с ключом, эквивалентным key_search
+  template <typename Key>
+  node *findNode(const Key &key_search, node *parent_node) const;
+
+  // Находит первый узел, ключ которого не меньше key_search
+  template <typename Key>
+  node *lowerNode(const Key &key_search, node *parent_node) const;
+
+  // Находит первый узел, ключ которого больше key_search
+  template <typename Key>
+  node *upperNode(const Key &key_search, node *parent_node) const;
 };
 
 // Перегруженный оператор вставки в поток для класса tree.
 // Выводит элементы дерева в отсортированном порядке.
-template <typename K, typename V>
-std::ostream &operator<<(std::ostream &os, tree<K, V> &t);
+template <typename K, typename V, typename Compare>
+std::ostream &operator<<(std::ostream &os, tree<K, V, Compare> &t);
 
-template <typename K, typename V>
-std::ostream &operator<<(std::ostream &os, tree<K, V> &t) {
+template <typename K, typename V, typename Compare>
+std::ostream &operator<<(std::ostream &os, tree<K, V, Compare> &t) {
   auto it = t.begin();
   while (it != t.end()) {
     os << "Key: " << it->first << ", Value: " << it->second << "\n";
@@ -314,46 +363,55 @@ std::ostream &operator<<(std::ostream &os, tree<K, V> &t) {
   return os;
 };
 
-template <typename K, typename V>
-tree<K, V>::tree() noexcept : root(nullptr), count(0) {
+template <typename K, typename V, typename Compare>
+tree<K, V, Compare>::tree() noexcept : root(nullptr), count(0) {
+  this->root = new node();
+};
+
+template <typename K, typename V, typename Compare>
+tree<K, V, Compare>::tree(const key_compare &comparator) noexcept
+    : root(nullptr), count(0), comp(comparator) {
   this->root = new node();
 };
 
-template <typename K, typename V>
-tree<K, V>::tree(const value_type &elem) noexcept {
+template <typename K, typename V, typename Compare>
+tree<K, V, Compare>::tree(const value_type &elem) noexcept {
   this->count = 1;
   this->root = new node(elem);
   this->root->right = new node();
   this->root->right->parent = this->root;
 }
 
-template <typename K, typename V>
-tree<K, V>::tree(std::initializer_list<value_type> const &items) noexcept
+template <typename K, typename V, typename Compare>
+tree<K, V, Compare>::tree(
+    std::initializer_list<value_type> const &items) noexcept
     : root(nullptr), count(0) {
   for (value_type i : items) add(i);
 };
 
-template <typename K, typename V>
-tree<K, V>::tree(tree &&other) noexcept {
+template <typename K, typename V, typename Compare>
+tree<K, V, Compare>::tree(tree &&other) noexcept : comp(other.comp) {
   *this = std::move(other);
   other.clear();
 };
 
-template <typename K, typename V>
-tree<K, V>::tree(const tree &other) noexcept {
+template <typename K, typename V, typename Compare>
+tree<K, V, Compare>::tree(const tree &other) noexcept : comp(other.comp) {
   *this = other;
 };
 
-template <typename K, typename V>
-tree<K, V>::~tree() {
+template <typename K, typename V, typename Compare>
+tree<K, V, Compare>::~tree() {
   this->clear();
 };
 
-template <typename K, typename V>
-tree<K, V> &tree<K, V>::operator=(const tree<K, V> &other) noexcept {
+template <typename K, typename V, typename Compare>
+tree<K, V, Compare> &tree<K, V, Compare>::operator=(
+    const tree<K, V, Compare> &other) noexcept {
   if (this == &other) return *this;
 
   if (this->root != nullptr) clear();
+  this->comp = other.comp;
 
   auto it = other.begin();
   while (it != other.end()) {
@@ -364,12 +422,14 @@ tree<K, V> &tree<K, V>::operator=(const tree<K, V> &other) noexcept {
   return *this;
 }
 
-template <typename K, typename V>
-tree<K, V> &tree<K, V>::operator=(tree<K, V> &&other) noexcept {
+template <typename K, typename V, typename Compare>
+tree<K, V, Compare> &tree<K, V, Compare>::operator=(
+    tree<K, V, Compare> &&other) noexcept {
   if (this != &other) {
     this->clear();
     this->root = other.root;
     this->count = other.count;
+    this->comp = other.comp;
     // other.clear();
     other.root = nullptr;
     other.count = 0;
@@ -378,8 +438,8 @@ tree<K, V> &tree<K, V>::operator=(tree<K, V> &&other) noexcept {
   return *this;
 }
 
-template <typename K, typename V>
-tree<K, V>::node::node() {
+template <typename K, typename V, typename Compare>
+tree<K, V, Compare>::node::node() {
   element_ = nullptr;
 
   left = nullptr;
@@ -387,8 +447,8 @@ tree<K, V>::node::node() {
   parent = nullptr;
 }
 
-template <typename K, typename V>
-tree<K, V>::node::node(const value_type elem) {
+template <typename K, typename V, typename Compare>
+tree<K, V, Compare>::node::node(const value_type elem) {
   element_ = new value_type(elem);
 
   left = nullptr;
@@ -396,28 +456,28 @@ tree<K, V>::node::node(const value_type elem) {
   parent = nullptr;
 }
 
-template <typename K, typename V>
-typename tree<K, V>::iterator tree<K, V>::begin() const {
+template <typename K, typename V, typename Compare>
+typename tree<K, V, Compare>::iterator tree<K, V, Compare>::begin() const {
   if (!this->root) throw std::out_of_range("tree does not exist");
 
   return iterator(this->findMin(this->root));
 }
 
-template <typename K, typename V>
-typename tree<K, V>::iterator tree<K, V>::end() const {
+template <typename K, typename V, typename Compare>
+typename tree<K, V, Compare>::iterator tree<K, V, Compare>::end() const {
   if (!this->root) throw std::out_of_range("tree does not exist");
   return iterator(this->findMax(this->root));
 }
 
-template <typename K, typename V>
-std::pair<typename tree<K, V>::iterator, bool> tree<K, V>::add(
-    const tree<K, V>::value_type &value) {
+template <typename K, typename V, typename Compare>
+std::pair<typename tree<K, V, Compare>::iterator, bool>
+tree<K, V, Compare>::add(const tree<K, V, Compare>::value_type &value) {
   return this->add(value.first, value.second);
 }
 
-template <typename K, typename V>
-std::pair<typename tree<K, V>::iterator, bool> tree<K, V>::add(const K &key,
-                                                               const V &obj) {
+template <typename K, typename V, typename Compare>
+std::pair<typename tree<K, V, Compare>::iterator, bool>
+tree<K, V, Compare>::add(const K &key, const V &obj) {
   this->count++;
   bool flag = 1;
   node *tmp = new node({key, obj});
@@ -431,43 +491,39 @@ std::pair<typename tree<K, V>::iterator, bool> tree<K, V>::add(const K &key,
     this->root->right->parent = this->root;
   } else if (!this->add(tmp, this->root))
     flag = 0;
-  return {tree<K, V>::iterator(tmp), flag};
+  return {tree<K, V, Compare>::iterator(tmp), flag};
 }
 
-template <typename K, typename V>
-typename tree<K, V>::node *tree<K, V>::add(node *new_node, node *parent_node) {
+template <typename K, typename V, typename Compare>
+typename tree<K, V, Compare>::node *tree<K, V, Compare>::add(
+    node *new_node, node *parent_node) {
   node *tmp = new_node;
 
-  while (parent_node->left &&
-         parent_node->element_->first == parent_node->left->element_->first)
-    parent_node = parent_node->left;
-  while (parent_node->right && parent_node->right->element_ &&
-         parent_node->element_->first == parent_node->right->element_->first)
-    parent_node = parent_node->right;
-
   if (parent_node->right && !parent_node->right->element_)
     erase(parent_node->right);
 
   if (!parent_node) {
     parent_node = new_node;
-  } else if (new_node->element_->first == parent_node->element_->first) {
-    delete tmp;
-    this->count--;
-    tmp = nullptr;
-  } else if (new_node->element_->first < parent_node->element_->first) {
+  } else if (compare(new_node->element_->first,
+                     parent_node->element_->first)) {
     if (parent_node->left)
       tmp = this->add(new_node, parent_node->left);
     else {
       parent_node->left = new_node;
     }
     parent_node->left->parent = parent_node;
-  } else if (new_node->element_->first > parent_node->element_->first) {
+  } else if (compare(parent_node->element_->first,
+                     new_node->element_->first)) {
     if (parent_node->right)
       tmp = this->add(new_node, parent_node->right);
     else {
       parent_node->right = new_node;
     }
     parent_node->right->parent = parent_node;
+  } else {
+    delete tmp;
+    this->count--;
+    tmp = nullptr;
   }
   node *max = findMax(root);
   if (max->element_) {
@@ -478,146 +534,167 @@ typename tree<K, V>::node *tree<K, V>::add(node *new_node, node *parent_node) {
   return tmp;
 }
 
-template <typename K, typename V>
-typename tree<K, V>::node *tree<K, V>::search(const K &key_search) const {
-  return this->search(key_search, this->root);
+template <typename K, typename V, typename Compare>
+typename tree<K, V, Compare>::node *tree<K, V, Compare>::search(
+    const K &key_search) const {
+  return this->findNode(key_search, this->root);
 }
 
-template <typename K, typename V>
-typename tree<K, V>::node *tree<K, V>::search(const K &key_search,
-                                              node *parent_node) const {
+template <typename K, typename V, typename Compare>
+typename tree<K, V, Compare>::node *tree<K, V, Compare>::search(
+    const K &key_search, node *parent_node) const {
+  return this->findNode(key_search, parent_node);
+}
+
+template <typename K, typename V, typename Compare>
+template <typename Key>
+typename tree<K, V, Compare>::node *tree<K, V, Compare>::findNode(
+    const Key &key_search, node *parent_node) const {
+  node *tmp = this->lowerNode(key_search, parent_node);
+  if (tmp && compare(key_search, tmp->element_->first)) tmp = nullptr;
+  return tmp;
+}
+
+template <typename K, typename V, typename Compare>
+template <typename Key>
+typename tree<K, V, Compare>::node *tree<K, V, Compare>::lowerNode(
+    const Key &key_search, node *parent_node) const {
   node *tmp = nullptr;
-  if (parent_node && parent_node->element_) {
-    while (parent_node->left &&
-           parent_node->element_->first == parent_node->left->element_->first)
-      parent_node = parent_node->left;
-    while (parent_node->right && parent_node->right->element_ &&
-           parent_node->element_->first == parent_node->right->element_->first)
+  while (parent_node && parent_node->element_) {
+    if (compare(parent_node->element_->first, key_search)) {
       parent_node = parent_node->right;
+    } else {
+      tmp = parent_node;
+      parent_node = parent_node->left;
+    }
+  }
+  return tmp;
+}
 
-    if (key_search < parent_node->element_->first) {
-      tmp = this->search(key_search, parent_node->left);
-    } else if (key_search > parent_node->element_->first) {
-      tmp = this->search(key_search, parent_node->right);
-    } else if (key_search == parent_node->element_->first) {
+template <typename K, typename V, typename Compare>
+template <typename Key>
+typename tree<K, V, Compare>::node *tree<K, V, Compare>::upperNode(
+    const Key &key_search, node *parent_node) const {
+  node *tmp = nullptr;
+  while (parent_node && parent_node->element_) {
+    if (compare(key_search, parent_node->element_->first)) {
       tmp = parent_node;
+      parent_node = parent_node->left;
+    } else {
+      parent_node = parent_node->right;
     }
   }
   return tmp;
 }
 
-template <typename K, typename V>
-void tree<K, V>::erase(typename tree<K, V>::iterator pos) {
+template <typename K, typename V, typename Compare>
+void tree<K, V, Compare>::erase(typename tree<K, V, Compare>::iterator pos) {
   this->erase(pos.GetNode());
 }
 
-template <typename K, typename V>
-typename tree<K, V>::node *tree<K, V>::erase(const K &key_del) {
+template <typename K, typename V, typename Compare>
+typename tree<K, V, Compare>::node *tree<K, V, Compare>::erase(
+    const K &key_del) {
   return this->erase(this->search(key_del));
 }
 
-template <typename K, typename V>
-typename tree<K, V>::node *tree<K, V>::erase(node *_node) {
+// Узлы перевешиваются, а не копируются: итераторы на остальные элементы
+// остаются действительными. Узел с двумя потомками заменяется своим
+// предшественником - он никогда не бывает узлом end()
+template <typename K, typename V, typename Compare>
+typename tree<K, V, Compare>::node *tree<K, V, Compare>::erase(node *_node) {
   if (!_node) return nullptr;
-  node *tmp = _node;
-
-  auto it = tree<K, V>::iterator(_node);
 
   if (_node->right || _node->left || _node->parent) {
-    if (_node->left) {
-      it--;
-      tmp = it.GetNode();
-      _node->setElement(tmp->element_);
-      if (tmp->parent == _node) {
-        _node->left = tmp->left;
-        if (_node->left) _node->left->parent = _node;
-      } else
-        tmp->parent->right = tmp->left;
-    } else if (_node->right) {
-      it++;
-      tmp = it.GetNode();
-      _node->setElement(tmp->element_);
-
-      if (tmp->parent == _node) {
-        _node->right = tmp->right;
-        if (_node->right) _node->right->parent = _node;
-      } else
-        tmp->parent->left = tmp->right;
-    } else if (!_node->right && !_node->left) {
-      if (tmp->parent->left == _node)
-        tmp->parent->left = nullptr;
-      else if (tmp->parent->right == _node)
-        tmp->parent->right = nullptr;
+    node *replacement = _node->left ? _node->left : _node->right;
+    if (_node->left && _node->right) {
+      replacement = _node->left;
+      while (replacement->right) replacement = replacement->right;
+      if (replacement != _node->left) {
+        replaceNode(replacement, replacement->left);
+        replacement->left = _node->left;
+        replacement->left->parent = replacement;
+      }
+      replacement->right = _node->right;
+      replacement->right->parent = replacement;
     }
+    replaceNode(_node, replacement);
   } else {
     root = nullptr;
   }
-  tmp->left = nullptr;
-  tmp->right = nullptr;
-  tmp->parent = nullptr;
+  _node->left = nullptr;
+  _node->right = nullptr;
+  _node->parent = nullptr;
 
-  delete tmp;
+  delete _node;
   this->count--;
   return 0;
 }
 
-template <typename K, typename V>
-void tree<K, V>::swap(tree<K, V> &other) {
-  tree<K, V>::node *tmp = other.root;
+template <typename K, typename V, typename Compare>
+void tree<K, V, Compare>::replaceNode(node *old_node, node *new_node) {
+  node *parent = old_node->parent;
+  if (!parent)
+    root = new_node;
+  else if (parent->left == old_node)
+    parent->left = new_node;
+  else
+    parent->right = new_node;
+  if (new_node) new_node->parent = parent;
+}
+
+template <typename K, typename V, typename Compare>
+void tree<K, V, Compare>::swap(tree<K, V, Compare> &other) {
+  tree<K, V, Compare>::node *tmp = other.root;
   other.root = this->root;
   this->root = tmp;
 
   std::swap(this->count, other.count);
+  std::swap(this->comp, other.comp);
 }
 
-template <typename K, typename V>
-unsigned int *tree<K, V>::setCount() {
+template <typename K, typename V, typename Compare>
+unsigned int *tree<K, V, Compare>::setCount() {
   return &count;
 }
 
-template <typename K, typename V>
-typename tree<K, V>::node *tree<K, V>::findMax(const node *parent_node) const {
-  while (parent_node && parent_node->left &&
-         parent_node->left->element_->first == parent_node->element_->first) {
-    parent_node = parent_node->left;
-  }
-  return (parent_node && parent_node->right) ? findMax(parent_node->right)
-                                             : (tree<K, V>::node *)parent_node;
+template <typename K, typename V, typename Compare>
+typename tree<K, V, Compare>::node *tree<K, V, Compare>::findMax(
+    const node *parent_node) const {
+  while (parent_node && parent_node->right) parent_node = parent_node->right;
+  return (tree<K, V, Compare>::node *)parent_node;
 }
 
-template <typename K, typename V>
-typename tree<K, V>::node *tree<K, V>::findMin(const node *parent_node) const {
-  while (parent_node && parent_node->right && parent_node->right->element_ &&
-         parent_node->right->element_->first == parent_node->element_->first) {
-    parent_node = parent_node->right;
-  }
-  return (parent_node && parent_node->left) ? findMin(parent_node->left)
-                                            : (tree<K, V>::node *)parent_node;
+template <typename K, typename V, typename Compare>
+typename tree<K, V, Compare>::node *tree<K, V, Compare>::findMin(
+    const node *parent_node) const {
+  while (parent_node && parent_node->left) parent_node = parent_node->left;
+  return (tree<K, V, Compare>::node *)parent_node;
 }
 
-template <typename K, typename V>
-bool tree<K, V>::empty() {
+template <typename K, typename V, typename Compare>
+bool tree<K, V, Compare>::empty() const {
   return !this->root || (this->root && !this->root->element_);
 }
 
-template <typename K, typename V>
-bool tree<K, V>::contains(const K &key) {
+template <typename K, typename V, typename Compare>
+bool tree<K, V, Compare>::contains(const K &key) {
   return search(key);
 }
 
-template <typename K, typename V>
-typename tree<K, V>::size_type tree<K, V>::size() {
+template <typename K, typename V, typename Compare>
+typename tree<K, V, Compare>::size_type tree<K, V, Compare>::size() const {
   return this->count;
 }
 
-template <typename K, typename V>
-typename tree<K, V>::size_type tree<K, V>::max_size() {
+template <typename K, typename V, typename Compare>
+typename tree<K, V, Compare>::size_type tree<K, V, Compare>::max_size() {
   std::allocator<std::pair<key_type, mapped_type>> Alloc;
   return std::allocator_traits<decltype(Alloc)>::max_size(Alloc) / 5;
 }
 
-template <typename K, typename V>
-void tree<K, V>::clear() {
+template <typename K, typename V, typename Compare>
+void tree<K, V, Compare>::clear() {
   if (this->root != nullptr) {
     delete this->root;
     this->root = nullptr;
@@ -625,26 +702,17 @@ void tree<K, V>::clear() {
   }
 }
 
-template <typename K, typename V>
-std::pair<typename tree<K, V>::iterator, bool> tree<K, V>::add_or_assign(
-    const K &key, const V &obj) {
-  bool flag = 0;
+template <typename K, typename V, typename Compare>
+std::pair<typename tree<K, V, Compare>::iterator, bool>
+tree<K, V, Compare>::add_or_assign(const K &key, const V &obj) {
   node *tmp = this->search(key);
-  if (!tmp) {
-    tmp = new node({key, obj});
-    if (!this->root)
-      this->root = tmp;
-    else
-      this->add(tmp, this->root);
-  } else {
-    tmp->element_->second = obj;
-    flag = 1;
-  }
-  return {iterator(tmp), flag};
+  if (!tmp) return this->add(key, obj);
+  tmp->element_->second = obj;
+  return {iterator(tmp), false};
 }
 
-template <typename K, typename V>
-void tree<K, V>::merge(tree<K, V> &other) {
+template <typename K, typename V, typename Compare>
+void tree<K, V, Compare>::merge(tree<K, V, Compare> &other) {
   if (!other.root || this->root == other.root) return;
 
   auto it = other.begin();
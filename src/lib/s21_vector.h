@@ -1,11 +1,21 @@
 #ifndef CPP2_S21_CONTAINERS_0_SRC_HEADERS_S21_VECTOR_H_
 #define CPP2_S21_CONTAINERS_0_SRC_HEADERS_S21_VECTOR_H_
 
+#include <algorithm>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace s21 {
+// Элементы лежат в сыром буфере на capacity() ячеек: живы только первые
+// size(), они создаются placement new и разрушаются явно, поэтому pop_back
+// и clear сразу освобождают ресурсы элементов, а T не обязан иметь
+// конструктор по умолчанию
 template <typename T>
-
 class vector {
  public:
   using value_type = T;
@@ -18,18 +28,27 @@ class vector {
   vector() : arr_(nullptr), size_(0), capacity_(0) {}
 
   explicit vector(size_type n) : vector() {
-    size_ = n;
+    arr_ = allocate_(n);
     capacity_ = n;
-    if (size_ > 0) {
-      arr_ = new value_type[n];
+    try {
+      std::uninitialized_value_construct_n(arr_, n);
+    } catch (...) {
+      makeEmpty_();
+      throw;
     }
+    size_ = n;
   }
 
   vector(std::initializer_list<value_type> const &items) : vector() {
-    size_ = items.size();
+    arr_ = allocate_(items.size());
     capacity_ = items.size();
-    arr_ = new value_type[capacity_];
-    std::copy(items.begin(), items.end(), arr_);
+    try {
+      std::uninitialized_copy(items.begin(), items.end(), arr_);
+    } catch (...) {
+      makeEmpty_();
+      throw;
+    }
+    size_ = items.size();
   }
 
   vector(const vector &v) : vector() { operator=(v); }
@@ -41,14 +60,16 @@ class vector {
   vector &operator=(const vector &v) {
     if (this != &v) {
       makeEmpty_();
-      size_ = v.size_;
-      capacity_ = v.capacity_;
-      arr_ = nullptr;
-      if (size_ > 0) {
-        arr_ = new value_type[capacity_];
-        for (size_type i = 0; i < size_; i += 1) {
-          arr_[i] = *(v.begin() + i);
+      if (v.size_ > 0) {
+        arr_ = allocate_(v.capacity_);
+        capacity_ = v.capacity_;
+        try {
+          std::uninitialized_copy(v.begin(), v.end(), arr_);
+        } catch (...) {
+          makeEmpty_();
+          throw;
         }
+        size_ = v.size_;
       }
     }
     return *this;
@@ -125,13 +146,7 @@ class vector {
           "Error: in reserve(size_type size): size > s21::vector::max_size()");
     }
     if (size > capacity_) {
-      value_type *temp = arr_;
-      arr_ = new value_type[size];
-      for (size_t i = 0; i < size_; i++) {
-        arr_[i] = temp[i];
-      }
-      delete[] temp;
-      capacity_ = size;
+      reallocate_(size);
     }
   }
 
@@ -142,27 +157,29 @@ class vector {
     }
     if (size > capacity_) {
       reserve(size);
-      size_ = size;
     }
-    if (size < capacity_) {
-      value_type *temp = arr_;
-      arr_ = new value_type[capacity_];
-      for (size_type i = 0; i < size; i += 1) {
-        arr_[i] = temp[i];
-      }
-      delete[] temp;
-      size_ = size;
+    if (size > size_) {
+      std::uninitialized_value_construct(arr_ + size_, arr_ + size);
+    } else {
+      std::destroy(arr_ + size, arr_ + size_);
     }
+    size_ = size;
   }
 
   size_type capacity() { return capacity_; }
 
   void shrink_to_fit() {
-    capacity_ = size_;
-    reserve(capacity_);
+    if (size_ == 0) {
+      makeEmpty_();
+    } else if (size_ < capacity_) {
+      reallocate_(size_);
+    }
   }
 
-  inline void clear() { size_ = 0; }
+  inline void clear() {
+    std::destroy(begin(), end());
+    size_ = 0;
+  }
 
   iterator insert(iterator pos, const_reference value) {
     if (pos < begin() || pos > end()) {
@@ -174,13 +191,11 @@ class vector {
       return arr_ + size() - 1;
     }
     auto newPosIndex = std::distance(begin(), pos);
-    push_back(value_type());
-    auto temp = arr_[newPosIndex];
-    arr_[newPosIndex] = value;
-    for (size_t i = newPosIndex + 1; i < size() - 1; i++) {
-      std::swap(temp, arr_[i]);
-    }
-    arr_[size() - 1] = temp;
+    // value может лежать в самом векторе и сдвинуться вместе с хвостом
+    value_type copy(value);
+    emplace_back(std::move(arr_[size_ - 1]));
+    std::move_backward(arr_ + newPosIndex, arr_ + size_ - 2, arr_ + size_ - 1);
+    arr_[newPosIndex] = std::move(copy);
     return arr_ + newPosIndex;
   }
 
@@ -189,22 +204,46 @@ class vector {
       throw std::length_error(
           "Error: erase(): Accessing an inaccessible area of memory");
     }
-    for (size_t i = std::distance(begin(), pos); i < size() - 1; i++) {
-      arr_[i] = arr_[i + 1];
+    if (pos == end()) {
+      return;
     }
-    size_ -= 1;
+    std::move(pos + 1, end(), pos);
+    pop_back();
   }
 
-  void push_back(const_reference value) {
-    if (size_ >= capacity_) {
-      if (capacity_ == 0) {
-        reserve(1);
-      } else {
-        reserve(capacity_ * 2);
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  // Элемент создаётся прямо в своей ячейке. При нехватке места он
+  // создаётся в новом буфере до переноса старых элементов: args могут
+  // ссылаться на элемент самого вектора
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ < capacity_) {
+      ::new (static_cast<void *>(arr_ + size_))
+          value_type(std::forward<Args>(args)...);
+    } else {
+      size_type capacity = capacity_ == 0 ? 1 : capacity_ * 2;
+      iterator fresh = allocate_(capacity);
+      try {
+        ::new (static_cast<void *>(fresh + size_))
+            value_type(std::forward<Args>(args)...);
+      } catch (...) {
+        deallocate_(fresh, capacity);
+        throw;
+      }
+      try {
+        relocate_(fresh);
+      } catch (...) {
+        fresh[size_].~value_type();
+        deallocate_(fresh, capacity);
+        throw;
       }
+      replaceStorage_(fresh, capacity);
     }
-    arr_[size_] = value;
     size_ += 1;
+    return arr_[size_ - 1];
   }
 
   void pop_back() {
@@ -212,6 +251,7 @@ class vector {
       throw std::length_error("Error: size == 0, nothing to pop_back");
     }
     size_ -= 1;
+    arr_[size_].~value_type();
   }
 
   void swap(vector &other) {
@@ -244,9 +284,50 @@ class vector {
   size_type size_;
   size_type capacity_;
 
+  static iterator allocate_(size_type n) {
+    return n == 0 ? nullptr : std::allocator<value_type>().allocate(n);
+  }
+
+  static void deallocate_(iterator p, size_type n) {
+    if (p != nullptr) {
+      std::allocator<value_type>().deallocate(p, n);
+    }
+  }
+
+  // Создаёт копии элементов в сыром буфере fresh: перемещением, если оно
+  // не бросает или копировать нельзя. При исключении fresh остаётся пустым
+  void relocate_(iterator fresh) {
+    if constexpr (std::is_nothrow_move_constructible_v<value_type> ||
+                  !std::is_copy_constructible_v<value_type>) {
+      std::uninitialized_move(begin(), end(), fresh);
+    } else {
+      std::uninitialized_copy(begin(), end(), fresh);
+    }
+  }
+
+  // Разрушает элементы и отдаёт старый буфер, дальше вектор живёт в fresh
+  void replaceStorage_(iterator fresh, size_type capacity) {
+    std::destroy(begin(), end());
+    deallocate_(arr_, capacity_);
+    arr_ = fresh;
+    capacity_ = capacity;
+  }
+
+  void reallocate_(size_type capacity) {
+    iterator fresh = allocate_(capacity);
+    try {
+      relocate_(fresh);
+    } catch (...) {
+      deallocate_(fresh, capacity);
+      throw;
+    }
+    replaceStorage_(fresh, capacity);
+  }
+
   void makeEmpty_() {
     if (arr_ != nullptr) {
-      delete[] arr_;
+      std::destroy(begin(), end());
+      deallocate_(arr_, capacity_);
       arr_ = nullptr;
       size_ = 0;
       capacity_ = 0;
@@ -1,14 +1,22 @@
 #ifndef CPP2_S21_CONTAINERS_S21_ARRAY_H_
 #define CPP2_S21_CONTAINERS_S21_ARRAY_H_
 
-#include <initializer_list>
-#include <iostream>
+#include <cstddef>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace s21 {
+// Массив фиксированного размера N - агрегат, как std::array: размер берётся
+// из параметра шаблона и не хранится, конструкторов нет. Поэтому
+//   s21::array<int, 3> a = {2, 1, 3};  // агрегатная инициализация
+//   s21::array<int, 3> b{};            // нули
+//   s21::array<int, 3> c;              // без инициализации, как int[3]
+// а для тривиального T массив тривиально копируемый: его можно копировать
+// memcpy, а маленькие массивы передаются в регистрах. Все методы
+// constexpr, так что таблицы можно строить при компиляции.
 template <typename T, size_t N>
-class array {
- public:
+struct array {
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
@@ -16,63 +24,56 @@ class array {
   using const_iterator = const T *;
   using size_type = size_t;
 
-  array() {
-    for (size_type i = 0; i < size_; ++i) {
-      array_[i] = value_type{};
-    }
-  }
-  array(std::initializer_list<value_type> const &items) {
-    size_type i = 0;
-    for (auto it = items.begin(); it != items.end(); ++it, ++i) {
-      array_[i] = *it;
-    }
-    for (; i < size_; ++i) {
-      array_[i] = value_type{};
-    }
-  }
-  array(const array &a) { std::copy(a.cbegin(), a.cend(), array_); }
-  array(array &&a) : size_(a.size_) { std::move(a.begin(), a.end(), array_); }
-  ~array() {}
-
-  array &operator=(const array &a) {
-    if (this != &a) std::copy(a.cbegin(), a.cend(), array_);
-    return *this;
-  }
-  array &operator=(array &&a) {
-    if (this != &a) std::move(a.begin(), a.end(), array_);
-    return *this;
+  constexpr reference at(size_type pos) {
+    if (pos >= N) throw std::out_of_range("array::at out of range");
+    return array_[pos];
   }
-  reference at(size_type pos) {
-    if (pos >= size_) throw std::out_of_range("array::at out of range");
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= N) throw std::out_of_range("array::at out of range");
     return array_[pos];
   }
-  const_reference at(size_type pos) const {
-    if (pos >= size_) throw std::out_of_range("array::at out of range");
+  constexpr reference operator[](size_type pos) noexcept {
     return array_[pos];
   }
-  reference operator[](size_type pos) noexcept { return array_[pos]; }
-  const_reference operator[](size_type pos) const noexcept {
+  constexpr const_reference operator[](size_type pos) const noexcept {
     return array_[pos];
   }
-  const_reference front() const { return array_[0]; }
-  const_reference back() const { return array_[size_ - 1]; }
-  iterator data() noexcept { return array_; }
-  const_iterator data() const noexcept { return array_; }
+  constexpr reference front() noexcept { return array_[0]; }
+  constexpr const_reference front() const noexcept { return array_[0]; }
+  constexpr reference back() noexcept { return array_[N - 1]; }
+  constexpr const_reference back() const noexcept { return array_[N - 1]; }
+  constexpr iterator data() noexcept { return array_; }
+  constexpr const_iterator data() const noexcept { return array_; }
 
-  iterator begin() noexcept { return array_; }
-  iterator end() noexcept { return &array_[size_]; }
-  const_iterator cbegin() const noexcept { return array_; }
-  const_iterator cend() const noexcept { return &array_[size_]; }
+  constexpr iterator begin() noexcept { return array_; }
+  constexpr iterator end() noexcept { return array_ + N; }
+  constexpr const_iterator begin() const noexcept { return array_; }
+  constexpr const_iterator end() const noexcept { return array_ + N; }
+  constexpr const_iterator cbegin() const noexcept { return array_; }
+  constexpr const_iterator cend() const noexcept { return array_ + N; }
 
-  bool empty() const noexcept { return size_ == 0; }
-  size_type size() const noexcept { return size_; }
-  size_type max_size() const noexcept { return size_; }
+  // Статические: размер не зависит от содержимого, и их можно вызывать у
+  // ещё не инициализированного массива
+  static constexpr bool empty() noexcept { return N == 0; }
+  static constexpr size_type size() noexcept { return N; }
+  static constexpr size_type max_size() noexcept { return N; }
 
-  void swap(array &other) noexcept { std::swap(*this, other); }
-  void fill(const_reference value) { std::fill(begin(), end(), value); }
+  // Поэлементный обмен без промежуточной копии всего массива
+  constexpr void swap(array &other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type> &&
+      std::is_nothrow_move_assignable_v<value_type>) {
+    for (size_type i = 0; i < N; ++i) {
+      value_type tmp = std::move(array_[i]);
+      array_[i] = std::move(other.array_[i]);
+      other.array_[i] = std::move(tmp);
+    }
+  }
+  constexpr void fill(const_reference value) {
+    for (size_type i = 0; i < N; ++i) array_[i] = value;
+  }
 
- private:
-  const size_type size_ = N;
+  // Открыт только ради агрегатной инициализации. При N == 0 лежит один
+  // неиспользуемый элемент, чтобы массив не был нулевой длины
   value_type array_[N ? N : 1];
 };
 }  // namespace s21
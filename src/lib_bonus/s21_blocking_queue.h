@@ -0,0 +1,246 @@
+#ifndef CPP2_S21_CONTAINERS_S21_BLOCKING_QUEUE_H_
+#define CPP2_S21_CONTAINERS_S21_BLOCKING_QUEUE_H_
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "s21_ring_buffer.h"
+
+namespace s21 {
+// Ограниченная блокирующая очередь для конвейеров. push ждёт, пока есть
+// место (обратное давление), pop и pop_batch ждут элементов. После close()
+// новые элементы не принимаются, а потребители дочитывают оставшиеся и
+// получают признак конца.
+//
+// Ждущий потребитель будится, когда в очереди набирается wake_batch
+// элементов (по умолчанию - на первом же элементе), а pop_batch забирает за
+// одно пробуждение все накопившиеся элементы (до max), поэтому при потоке
+// сообщений пробуждений намного меньше, чем элементов. При wake_batch > 1
+// задержку ограничивает таймаут pop_batch: по его истечении потребитель
+// забирает то, что есть; pop без таймаута ждёт пакета или close().
+// Производители, упёршиеся в полную очередь, будятся все разом, когда она
+// опустеет до половины.
+//
+// statistics() возвращает счётчики для наблюдения: глубину очереди, число
+// ожиданий и суммарное время ожидания производителей и потребителей.
+template <typename T>
+class blocking_queue {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using clock = std::chrono::steady_clock;
+
+  struct stats {
+    size_type pushed = 0;
+    size_type popped = 0;
+    // Наибольшая глубина очереди за всё время
+    size_type max_depth = 0;
+    // Сколько раз производители ждали места и потребители - элементов
+    size_type producer_waits = 0;
+    size_type consumer_waits = 0;
+    std::chrono::nanoseconds producer_wait_time{0};
+    std::chrono::nanoseconds consumer_wait_time{0};
+  };
+
+  explicit blocking_queue(size_type capacity, size_type wake_batch = 1)
+      : items_(capacity, ring_policy::reject),
+        wake_batch_(std::clamp<size_type>(wake_batch, 1, capacity)) {}
+
+  blocking_queue(const blocking_queue &) = delete;
+  blocking_queue &operator=(const blocking_queue &) = delete;
+
+  // PRODUCERS
+  // Ждёт места. Возвращает false, если очередь закрыта
+  bool push(const value_type &value) { return emplace(value); }
+  bool push(value_type &&value) { return emplace(std::move(value)); }
+
+  template <typename... Args>
+  bool emplace(Args &&...args) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (items_.full() && !closed_) {
+      waitFor(lock, not_full_, stats_.producer_waits,
+              stats_.producer_wait_time, waiting_producers_,
+              clock::time_point::max(),
+              [this] { return !items_.full() || closed_; });
+    }
+    if (closed_) return false;
+    insertLocked(lock, std::forward<Args>(args)...);
+    return true;
+  }
+
+  // Не ждёт: false, если очередь полна или закрыта
+  bool try_push(const value_type &value) { return tryEmplace(value); }
+  bool try_push(value_type &&value) { return tryEmplace(std::move(value)); }
+
+  // Запрещает новые элементы и будит всех ждущих. Уже положенные элементы
+  // остаются доступны потребителям
+  void close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+    }
+    not_empty_.notify_all();
+    not_full_.notify_all();
+  }
+
+  // CONSUMERS
+  // Ждёт элемента. Пустой результат - очередь закрыта и опустела
+  std::optional<value_type> pop() {
+    std::optional<value_type> out;
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (waitForItems(lock, clock::time_point::max())) {
+      out.emplace(std::move(items_.front()));
+      items_.pop_front();
+      afterPopLocked(lock, 1);
+    }
+    return out;
+  }
+
+  bool try_pop(value_type &out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (items_.empty()) return false;
+    out = std::move(items_.front());
+    items_.pop_front();
+    afterPopLocked(lock, 1);
+    return true;
+  }
+
+  // Ждёт хотя бы одного элемента не дольше timeout и забирает в out все
+  // накопившиеся, но не больше max. Возвращает их число; 0 - истёк таймаут
+  // или очередь закрыта и пуста
+  template <typename OutputIt, typename Rep, typename Period>
+  size_type pop_batch(OutputIt out, size_type max,
+                      std::chrono::duration<Rep, Period> timeout) {
+    return popBatchUntil(out, max, deadline(timeout));
+  }
+
+  // То же без ограничения времени ожидания
+  template <typename OutputIt>
+  size_type pop_batch(OutputIt out, size_type max) {
+    return popBatchUntil(out, max, clock::time_point::max());
+  }
+
+  // CAPACITY
+  size_type size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return items_.size();
+  }
+  size_type capacity() const noexcept { return items_.capacity(); }
+  size_type wake_batch() const noexcept { return wake_batch_; }
+  bool closed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+  }
+
+  stats statistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+ private:
+  template <typename Rep, typename Period>
+  static clock::time_point deadline(std::chrono::duration<Rep, Period> d) {
+    auto left = clock::time_point::max() - clock::now();
+    if (d >= left) return clock::time_point::max();
+    return clock::now() + std::chrono::duration_cast<clock::duration>(d);
+  }
+
+  template <typename... Args>
+  bool tryEmplace(Args &&...args) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (closed_ || items_.full()) return false;
+    insertLocked(lock, std::forward<Args>(args)...);
+    return true;
+  }
+
+  // Кладёт элемент и отпускает замок. Потребителя будим только когда
+  // очередь дорастает до wake_batch_: раньше ему нечего забирать пакетом,
+  // позже он уже разбужен. Будим после unlock, чтобы он сразу не упёрся в
+  // мьютекс
+  template <typename... Args>
+  void insertLocked(std::unique_lock<std::mutex> &lock, Args &&...args) {
+    items_.emplace_back(std::forward<Args>(args)...);
+    ++stats_.pushed;
+    if (items_.size() > stats_.max_depth) stats_.max_depth = items_.size();
+    bool wake = items_.size() == wake_batch_ && waiting_consumers_ > 0;
+    lock.unlock();
+    if (wake) not_empty_.notify_one();
+  }
+
+  template <typename OutputIt>
+  size_type popBatchUntil(OutputIt out, size_type max,
+                          clock::time_point until) {
+    if (max == 0) return 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!waitForItems(lock, until)) return 0;
+    size_type count = 0;
+    for (; count < max && !items_.empty(); ++count, ++out) {
+      *out = std::move(items_.front());
+      items_.pop_front();
+    }
+    afterPopLocked(lock, count);
+    return count;
+  }
+
+  // Ждёт, пока наберётся пакет. false - элементов нет: истёк срок или
+  // очередь закрыта
+  bool waitForItems(std::unique_lock<std::mutex> &lock,
+                    clock::time_point until) {
+    if (items_.empty() && !closed_) {
+      waitFor(lock, not_empty_, stats_.consumer_waits,
+              stats_.consumer_wait_time, waiting_consumers_, until,
+              [this] { return items_.size() >= wake_batch_ || closed_; });
+    }
+    return !items_.empty();
+  }
+
+  // Производители ждут у полной очереди; будим их всех разом, когда она
+  // опустеет до половины, чтобы они доложили пакет, а не будились на каждое
+  // освободившееся место. Если после нас остались элементы, будим
+  // следующего потребителя
+  void afterPopLocked(std::unique_lock<std::mutex> &lock, size_type count) {
+    bool more = !items_.empty() && waiting_consumers_ > 0;
+    bool wake_producers =
+        waiting_producers_ > 0 && items_.size() <= items_.capacity() / 2;
+    stats_.popped += count;
+    lock.unlock();
+    if (wake_producers) not_full_.notify_all();
+    if (more) not_empty_.notify_one();
+  }
+
+  // Ожидание с учётом в статистике; время меряется только при реальном
+  // ожидании
+  template <typename Ready>
+  void waitFor(std::unique_lock<std::mutex> &lock,
+               std::condition_variable &condition, size_type &waits,
+               std::chrono::nanoseconds &wait_time, size_type &waiting,
+               clock::time_point until, Ready ready) {
+    ++waits;
+    ++waiting;
+    auto start = clock::now();
+    if (until == clock::time_point::max()) {
+      condition.wait(lock, ready);
+    } else {
+      condition.wait_until(lock, until, ready);
+    }
+    wait_time += clock::now() - start;
+    --waiting;
+  }
+
+  mutable std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  ring_buffer<value_type> items_;
+  const size_type wake_batch_;
+  bool closed_ = false;
+  size_type waiting_producers_ = 0;
+  size_type waiting_consumers_ = 0;
+  stats stats_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_BLOCKING_QUEUE_H_
@@ -0,0 +1,708 @@
+#ifndef CPP2_S21_CONTAINERS_S21_BTREE_H_
+#define CPP2_S21_CONTAINERS_S21_BTREE_H_
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// B-дерево: в узле до kNodeSlots элементов подряд, так что поиск внутри узла
+// идёт по соседним адресам, а высота дерева - log по основанию ~kNodeSlots.
+// Размер узла подобран под kTargetNodeBytes (четыре кэш-линии). Для
+// арифметических ключей позиция в узле ищется линейным проходом - он читает
+// память подряд и на узлах такого размера обгоняет двоичный поиск с его
+// непредсказуемыми ветвлениями; для остальных ключей - двоичный поиск.
+//
+// K - тип ключа, T - тип хранимого элемента (K для set, пара для map).
+// Вставка и удаление перемещают элементы между узлами, поэтому делают
+// недействительными все итераторы контейнера.
+template <typename K, typename T, typename Compare>
+class btree {
+ public:
+  using key_type = K;
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  static constexpr size_type kTargetNodeBytes = 256;
+  static constexpr int kNodeSlots = static_cast<int>(std::max<size_type>(
+      3, (kTargetNodeBytes - 3 * sizeof(void *)) / sizeof(value_type)));
+  // Узел, кроме корня, после удаления держит не меньше kMinSlots элементов
+  static constexpr int kMinSlots = kNodeSlots / 2;
+
+ protected:
+  // Лист: элементы лежат в сырой памяти, сконструированы первые count
+  struct node {
+    explicit node(bool is_leaf) : leaf(is_leaf) {}
+
+    value_type &slot(int i) {
+      return reinterpret_cast<value_type *>(storage)[i];
+    }
+    const value_type &slot(int i) const {
+      return reinterpret_cast<const value_type *>(storage)[i];
+    }
+    const K &key(int i) const { return keyOf(slot(i)); }
+
+    node *parent = nullptr;
+    int position = 0;  // индекс среди детей родителя
+    int count = 0;
+    bool leaf;
+    alignas(value_type) unsigned char storage[kNodeSlots * sizeof(value_type)];
+  };
+
+  // Внутренний узел: count элементов и count + 1 детей
+  struct internal_node : node {
+    internal_node() : node(false) {}
+
+    node *children[kNodeSlots + 1];
+  };
+
+ public:
+  class const_iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = btree::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    const_iterator() : node_(nullptr), position_(0) {}
+
+    reference operator*() const { return node_->slot(position_); }
+    pointer operator->() const { return &node_->slot(position_); }
+
+    const_iterator &operator++() {
+      increment();
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator tmp(*this);
+      increment();
+      return tmp;
+    }
+
+    const_iterator &operator--() {
+      decrement();
+      return *this;
+    }
+
+    const_iterator operator--(int) {
+      const_iterator tmp(*this);
+      decrement();
+      return tmp;
+    }
+
+    bool operator==(const const_iterator &other) const {
+      return node_ == other.node_ && position_ == other.position_;
+    }
+    bool operator!=(const const_iterator &other) const {
+      return !(*this == other);
+    }
+
+   protected:
+    friend class btree;
+
+    const_iterator(node *n, int position) : node_(n), position_(position) {}
+
+    // Следующий элемент - самый левый в правом поддереве, а у листа -
+    // ближайший предок, из левого поддерева которого поднялись
+    void increment() {
+      if (!node_->leaf) {
+        node_ = child(node_, position_ + 1);
+        while (!node_->leaf) node_ = child(node_, 0);
+        position_ = 0;
+        return;
+      }
+      if (++position_ < node_->count) return;
+      const_iterator save(*this);
+      while (node_->parent && position_ == node_->count) {
+        position_ = node_->position;
+        node_ = node_->parent;
+      }
+      if (position_ == node_->count) *this = save;
+    }
+
+    void decrement() {
+      if (!node_->leaf) {
+        node_ = child(node_, position_);
+        while (!node_->leaf) node_ = child(node_, node_->count);
+        position_ = node_->count - 1;
+        return;
+      }
+      if (--position_ >= 0) return;
+      const_iterator save(*this);
+      while (node_->parent && position_ < 0) {
+        position_ = node_->position - 1;
+        node_ = node_->parent;
+      }
+      if (position_ < 0) *this = save;
+    }
+
+    node *node_;
+    int position_;
+  };
+
+  class iterator : public const_iterator {
+   public:
+    using pointer = value_type *;
+    using reference = value_type &;
+
+    iterator() : const_iterator() {}
+
+    reference operator*() const { return this->node_->slot(this->position_); }
+    pointer operator->() const { return &this->node_->slot(this->position_); }
+
+    iterator &operator++() {
+      this->increment();
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator tmp(*this);
+      this->increment();
+      return tmp;
+    }
+
+    iterator &operator--() {
+      this->decrement();
+      return *this;
+    }
+
+    iterator operator--(int) {
+      iterator tmp(*this);
+      this->decrement();
+      return tmp;
+    }
+
+   private:
+    friend class btree;
+
+    iterator(node *n, int position) : const_iterator(n, position) {}
+  };
+
+  // CONSTRUCTORS
+  btree() noexcept : btree(key_compare()) {}
+
+  explicit btree(const key_compare &comp) noexcept
+      : root_(nullptr),
+        leftmost_(nullptr),
+        rightmost_(nullptr),
+        size_(0),
+        comp_(comp) {}
+
+  btree(const btree &other) : btree(other.comp_) { *this = other; }
+
+  btree(btree &&other) noexcept : btree(other.comp_) { swap(other); }
+
+  ~btree() { clear(); }
+
+  // Копия повторяет форму дерева узел в узел, без повторных вставок
+  btree &operator=(const btree &other) {
+    if (this != &other) {
+      clear();
+      comp_ = other.comp_;
+      if (other.root_) {
+        root_ = copyTree(other.root_);
+        size_ = other.size_;
+        updateEdges();
+      }
+    }
+    return *this;
+  }
+
+  btree &operator=(btree &&other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  // ITERATORS
+  iterator begin() noexcept { return iterator(leftmost_, 0); }
+  iterator end() noexcept {
+    return iterator(rightmost_, rightmost_ ? rightmost_->count : 0);
+  }
+  const_iterator begin() const noexcept { return const_iterator(leftmost_, 0); }
+  const_iterator end() const noexcept {
+    return const_iterator(rightmost_, rightmost_ ? rightmost_->count : 0);
+  }
+
+  // CAPACITY
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+  }
+
+  // MODIFIERS
+  void clear() noexcept {
+    if (root_) destroyTree(root_);
+    root_ = leftmost_ = rightmost_ = nullptr;
+    size_ = 0;
+  }
+
+  void erase(const_iterator pos) { eraseAt(pos.node_, pos.position_); }
+
+  size_type erase(const K &key) {
+    const_iterator pos = findImpl(key);
+    if (pos == end()) return 0;
+    eraseAt(pos.node_, pos.position_);
+    return 1;
+  }
+
+  void swap(btree &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(leftmost_, other.leftmost_);
+    std::swap(rightmost_, other.rightmost_);
+    std::swap(size_, other.size_);
+    std::swap(comp_, other.comp_);
+  }
+
+  // Переносит из other элементы с ключами, которых нет в дереве; остальные
+  // остаются в other
+  void merge(btree &other) {
+    if (this == &other) return;
+    btree rest(other.comp_);
+    for (auto it = other.begin(); it != other.end(); ++it) {
+      if (!emplaceKey(keyOf(*it), std::move(*it)).second) {
+        rest.emplaceKey(keyOf(*it), std::move(*it));
+      }
+    }
+    other.swap(rest);
+  }
+
+  // LOOKUP
+  iterator find(const K &key) { return findImpl(key); }
+  const_iterator find(const K &key) const {
+    return const_cast<btree *>(this)->findImpl(key);
+  }
+
+  // Поиск по ключу другого типа, если компаратор прозрачный
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const Other &key) {
+    return findImpl(key);
+  }
+
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator find(const Other &key) const {
+    return const_cast<btree *>(this)->findImpl(key);
+  }
+
+  bool contains(const K &key) const { return find(key) != end(); }
+
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const Other &key) const {
+    return find(key) != end();
+  }
+
+  size_type count(const K &key) const { return contains(key) ? 1 : 0; }
+
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type count(const Other &key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  // Один спуск от корня: в каждом узле запоминается первая ячейка с ключом
+  // не меньше key, ответ - последняя запомненная, самая глубокая
+  iterator lower_bound(const K &key) { return lowerImpl(key); }
+  const_iterator lower_bound(const K &key) const {
+    return const_cast<btree *>(this)->lowerImpl(key);
+  }
+
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const Other &key) {
+    return lowerImpl(key);
+  }
+
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator lower_bound(const Other &key) const {
+    return const_cast<btree *>(this)->lowerImpl(key);
+  }
+
+  // Тот же спуск, но в узле ищется первый ключ строго больше key
+  iterator upper_bound(const K &key) { return upperImpl(key); }
+  const_iterator upper_bound(const K &key) const {
+    return const_cast<btree *>(this)->upperImpl(key);
+  }
+
+  key_compare key_comp() const { return comp_; }
+
+  // Число уровней дерева: 0 для пустого, 1 - только корень-лист
+  size_type height() const noexcept {
+    size_type levels = 0;
+    for (const node *n = root_; n; n = n->leaf ? nullptr : child(n, 0)) {
+      ++levels;
+    }
+    return levels;
+  }
+
+ protected:
+  static constexpr bool kLinearSearch = std::is_arithmetic<K>::value;
+
+  static const K &keyOf(const K &key) { return key; }
+
+  template <typename V>
+  static const K &keyOf(const std::pair<const K, V> &value) {
+    return value.first;
+  }
+
+  template <typename A, typename B>
+  bool compare(const A &a, const B &b) const { return comp_(a, b); }
+
+  static node *child(const node *n, int i) {
+    return static_cast<const internal_node *>(n)->children[i];
+  }
+
+  static void setChild(node *parent, int i, node *c) {
+    static_cast<internal_node *>(parent)->children[i] = c;
+    c->parent = parent;
+    c->position = i;
+  }
+
+  // Переносит элемент в несконструированный слот
+  static void relocate(value_type *dst, value_type *src) {
+    new (dst) value_type(std::move(*src));
+    src->~value_type();
+  }
+
+  // Число элементов узла с ключом меньше key
+  template <typename Key>
+  int lowerIndex(const node *n, const Key &key) const {
+    if constexpr (kLinearSearch) {
+      int index = 0;
+      while (index < n->count && compare(n->key(index), key)) ++index;
+      return index;
+    } else {
+      int lo = 0, hi = n->count;
+      while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (compare(n->key(mid), key)) {
+          lo = mid + 1;
+        } else {
+          hi = mid;
+        }
+      }
+      return lo;
+    }
+  }
+
+  // Число элементов узла с ключом не больше key
+  template <typename Key>
+  int upperIndex(const node *n, const Key &key) const {
+    if constexpr (kLinearSearch) {
+      int index = 0;
+      while (index < n->count && !compare(key, n->key(index))) ++index;
+      return index;
+    } else {
+      int lo = 0, hi = n->count;
+      while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (compare(key, n->key(mid))) {
+          hi = mid;
+        } else {
+          lo = mid + 1;
+        }
+      }
+      return lo;
+    }
+  }
+
+  template <typename Key>
+  iterator findImpl(const Key &key) {
+    for (node *n = root_; n;) {
+      int i = lowerIndex(n, key);
+      if (i < n->count && !compare(key, n->key(i))) return iterator(n, i);
+      n = n->leaf ? nullptr : child(n, i);
+    }
+    return end();
+  }
+
+  // Спуск запоминает последний подходящий слот: он самый глубокий, а значит
+  // наименьший из подходящих
+  template <typename Key>
+  iterator lowerImpl(const Key &key) {
+    iterator result = end();
+    for (node *n = root_; n;) {
+      int i = lowerIndex(n, key);
+      if (i < n->count) result = iterator(n, i);
+      n = n->leaf ? nullptr : child(n, i);
+    }
+    return result;
+  }
+
+  template <typename Key>
+  iterator upperImpl(const Key &key) {
+    iterator result = end();
+    for (node *n = root_; n;) {
+      int i = upperIndex(n, key);
+      if (i < n->count) result = iterator(n, i);
+      n = n->leaf ? nullptr : child(n, i);
+    }
+    return result;
+  }
+
+  // Вставляет элемент, сконструированный из args, если key ещё нет
+  template <typename... Args>
+  std::pair<iterator, bool> emplaceKey(const K &key, Args &&...args) {
+    if (!root_) root_ = leftmost_ = rightmost_ = new node(true);
+    node *n = root_;
+    while (true) {
+      int i = lowerIndex(n, key);
+      if (i < n->count && !compare(key, n->key(i))) {
+        return {iterator(n, i), false};
+      }
+      if (n->leaf) {
+        return {insertLeaf(n, i, std::forward<Args>(args)...), true};
+      }
+      n = child(n, i);
+    }
+  }
+
+  template <typename... Args>
+  iterator insertLeaf(node *n, int i, Args &&...args) {
+    if (n->count == kNodeSlots) {
+      int mid = splitPoint(i);
+      split(n, mid);
+      if (i > mid) {
+        n = child(n->parent, n->position + 1);
+        i -= mid + 1;
+      }
+    }
+    shiftRight(n, i);
+    new (&n->slot(i)) value_type(std::forward<Args>(args)...);
+    ++n->count;
+    ++size_;
+    return iterator(n, i);
+  }
+
+  // Медиана для деления полного узла. При вставке в край узла делим
+  // несимметрично, чтобы последовательные ключи заполняли узлы целиком
+  static int splitPoint(int insert_position) {
+    if (insert_position == kNodeSlots) return kNodeSlots - 1;
+    if (insert_position == 0) return 0;
+    return kNodeSlots / 2;
+  }
+
+  // Делит полный узел: элементы после mid уходят в новый правый сосед,
+  // элемент mid поднимается в родителя (при необходимости делится и он)
+  void split(node *n, int mid) {
+    if (!n->parent) {
+      internal_node *root = new internal_node();
+      setChild(root, 0, n);
+      root_ = root;
+    } else if (n->parent->count == kNodeSlots) {
+      split(n->parent, splitPoint(n->position));
+    }
+    node *parent = n->parent;
+    int p = n->position;
+    node *sibling = n->leaf ? new node(true) : new internal_node();
+    int moved = n->count - mid - 1;
+    for (int j = 0; j < moved; ++j) {
+      relocate(&sibling->slot(j), &n->slot(mid + 1 + j));
+    }
+    if (!n->leaf) {
+      for (int j = 0; j <= moved; ++j) {
+        setChild(sibling, j, child(n, mid + 1 + j));
+      }
+    }
+    sibling->count = moved;
+    shiftRight(parent, p);
+    relocate(&parent->slot(p), &n->slot(mid));
+    setChild(parent, p + 1, sibling);
+    ++parent->count;
+    n->count = mid;
+    if (n == rightmost_) rightmost_ = sibling;
+  }
+
+  // Освобождает слот i (и место ребёнка i + 1 во внутреннем узле)
+  static void shiftRight(node *n, int i) {
+    for (int j = n->count; j > i; --j) {
+      relocate(&n->slot(j), &n->slot(j - 1));
+    }
+    if (!n->leaf) {
+      for (int j = n->count + 1; j > i + 1; --j) {
+        setChild(n, j, child(n, j - 1));
+      }
+    }
+  }
+
+  // Убирает пустой слот i (и ребёнка i + 1 во внутреннем узле)
+  static void shiftLeft(node *n, int i) {
+    for (int j = i + 1; j < n->count; ++j) {
+      relocate(&n->slot(j - 1), &n->slot(j));
+    }
+    if (!n->leaf) {
+      for (int j = i + 2; j <= n->count; ++j) {
+        setChild(n, j - 1, child(n, j));
+      }
+    }
+  }
+
+  // Удаление из внутреннего узла заменяет элемент предшественником из
+  // листа, так что элемент всегда уходит из листа
+  void eraseAt(node *n, int i) {
+    n->slot(i).~value_type();
+    if (!n->leaf) {
+      node *leaf = child(n, i);
+      while (!leaf->leaf) leaf = child(leaf, leaf->count);
+      relocate(&n->slot(i), &leaf->slot(leaf->count - 1));
+      n = leaf;
+    } else {
+      shiftLeft(n, i);
+    }
+    --n->count;
+    --size_;
+    rebalance(n);
+  }
+
+  // Поднимается от недозаполненного узла: занимает элемент у соседа, у
+  // которого есть лишний, иначе сливается с соседом через разделитель
+  void rebalance(node *n) {
+    while (n != root_ && n->count < kMinSlots) {
+      node *parent = n->parent;
+      int p = n->position;
+      node *left = p > 0 ? child(parent, p - 1) : nullptr;
+      node *right = p < parent->count ? child(parent, p + 1) : nullptr;
+      if (left && left->count > kMinSlots) {
+        rotateRight(left, n);
+        return;
+      }
+      if (right && right->count > kMinSlots) {
+        rotateLeft(n, right);
+        return;
+      }
+      if (left) {
+        mergeNodes(left, n);
+      } else {
+        mergeNodes(n, right);
+      }
+      n = parent;
+    }
+    if (root_->count == 0) {
+      node *old = root_;
+      if (old->leaf) {
+        root_ = leftmost_ = rightmost_ = nullptr;
+      } else {
+        root_ = child(old, 0);
+        root_->parent = nullptr;
+        root_->position = 0;
+      }
+      deleteNode(old);
+    }
+  }
+
+  // Последний элемент left уходит в родителя, разделитель - в начало n
+  static void rotateRight(node *left, node *n) {
+    node *parent = n->parent;
+    int p = n->position;
+    for (int j = n->count; j > 0; --j) {
+      relocate(&n->slot(j), &n->slot(j - 1));
+    }
+    if (!n->leaf) {
+      for (int j = n->count + 1; j > 0; --j) setChild(n, j, child(n, j - 1));
+      setChild(n, 0, child(left, left->count));
+    }
+    relocate(&n->slot(0), &parent->slot(p - 1));
+    relocate(&parent->slot(p - 1), &left->slot(left->count - 1));
+    --left->count;
+    ++n->count;
+  }
+
+  // Первый элемент right уходит в родителя, разделитель - в конец n
+  static void rotateLeft(node *n, node *right) {
+    node *parent = n->parent;
+    int p = n->position;
+    relocate(&n->slot(n->count), &parent->slot(p));
+    relocate(&parent->slot(p), &right->slot(0));
+    if (!n->leaf) setChild(n, n->count + 1, child(right, 0));
+    for (int j = 1; j < right->count; ++j) {
+      relocate(&right->slot(j - 1), &right->slot(j));
+    }
+    if (!right->leaf) {
+      for (int j = 1; j <= right->count; ++j) {
+        setChild(right, j - 1, child(right, j));
+      }
+    }
+    ++n->count;
+    --right->count;
+  }
+
+  // Сливает right в left вместе с разделителем из родителя
+  void mergeNodes(node *left, node *right) {
+    node *parent = left->parent;
+    int p = left->position;
+    relocate(&left->slot(left->count), &parent->slot(p));
+    for (int j = 0; j < right->count; ++j) {
+      relocate(&left->slot(left->count + 1 + j), &right->slot(j));
+    }
+    if (!left->leaf) {
+      for (int j = 0; j <= right->count; ++j) {
+        setChild(left, left->count + 1 + j, child(right, j));
+      }
+    }
+    left->count += 1 + right->count;
+    shiftLeft(parent, p);
+    --parent->count;
+    if (right == rightmost_) rightmost_ = left;
+    right->count = 0;
+    deleteNode(right);
+  }
+
+  static void deleteNode(node *n) {
+    for (int i = 0; i < n->count; ++i) n->slot(i).~value_type();
+    if (n->leaf) {
+      delete n;
+    } else {
+      delete static_cast<internal_node *>(n);
+    }
+  }
+
+  static void destroyTree(node *n) {
+    if (!n->leaf) {
+      for (int i = 0; i <= n->count; ++i) destroyTree(child(n, i));
+    }
+    deleteNode(n);
+  }
+
+  static node *copyTree(const node *src) {
+    node *n = src->leaf ? new node(true) : new internal_node();
+    for (; n->count < src->count; ++n->count) {
+      new (&n->slot(n->count)) value_type(src->slot(n->count));
+    }
+    if (!src->leaf) {
+      for (int i = 0; i <= src->count; ++i) {
+        setChild(n, i, copyTree(child(src, i)));
+      }
+    }
+    return n;
+  }
+
+  void updateEdges() {
+    leftmost_ = rightmost_ = root_;
+    while (!leftmost_->leaf) leftmost_ = child(leftmost_, 0);
+    while (!rightmost_->leaf) rightmost_ = child(rightmost_, rightmost_->count);
+  }
+
+  node *root_;
+  node *leftmost_;
+  node *rightmost_;
+  size_type size_;
+  key_compare comp_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_BTREE_H_
@@ -0,0 +1,97 @@
+#ifndef CPP2_S21_CONTAINERS_S21_BTREE_MAP_H_
+#define CPP2_S21_CONTAINERS_S21_BTREE_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "s21_btree.h"
+
+namespace s21 {
+// map на B-дереве: тот же интерфейс, что у s21::map, но элементы хранятся
+// пачками в узлах. Итераторы становятся недействительными после вставки и
+// удаления
+template <typename K, typename V, typename Compare = std::less<K>>
+class btree_map : public btree<K, std::pair<const K, V>, Compare> {
+  using tree_type = btree<K, std::pair<const K, V>, Compare>;
+
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = typename tree_type::value_type;
+  using size_type = typename tree_type::size_type;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+
+  // CONSTRUCTORS
+  btree_map() : tree_type(){};
+  explicit btree_map(const Compare &comp) : tree_type(comp){};
+  btree_map(std::initializer_list<value_type> const &items) : tree_type() {
+    for (const auto &item : items) insert(item);
+  };
+  btree_map(const btree_map &m) : tree_type(m){};
+  btree_map(btree_map &&m) noexcept : tree_type(std::move(m)){};
+
+  // DESTRUCTOR
+  ~btree_map() = default;
+
+  btree_map &operator=(const btree_map &m) {
+    tree_type::operator=(m);
+    return *this;
+  }
+
+  btree_map &operator=(btree_map &&m) noexcept {
+    tree_type::operator=(std::move(m));
+    return *this;
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return this->emplaceKey(value.first, value);
+  }
+
+  std::pair<iterator, bool> insert(const K &key, const V &obj) {
+    return this->emplaceKey(key, key, obj);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const K &key, const V &obj) {
+    auto res = this->emplaceKey(key, key, obj);
+    if (!res.second) res.first->second = obj;
+    return res;
+  }
+
+  V &operator[](const K &key) {
+    return this->emplaceKey(key, std::piecewise_construct,
+                            std::forward_as_tuple(key), std::tuple<>())
+        .first->second;
+  }
+
+  V &at(const K &key) {
+    auto it = this->find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("Key not found");
+    }
+    return it->second;
+  }
+
+  const V &at(const K &key) const {
+    auto it = this->find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("Key not found");
+    }
+    return it->second;
+  }
+
+  template <class... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    std::vector<std::pair<iterator, bool>> vec;
+    for (const auto &arg : {args...}) {
+      vec.push_back(insert(arg));
+    }
+    return vec;
+  }
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_BTREE_MAP_H_
@@ -0,0 +1,88 @@
+#ifndef CPP2_S21_CONTAINERS_S21_BTREE_SET_H_
+#define CPP2_S21_CONTAINERS_S21_BTREE_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+#include "s21_btree.h"
+
+namespace s21 {
+// set на B-дереве: ключи лежат в узлах подряд. Итераторы становятся
+// недействительными после вставки и удаления
+template <typename K, typename Compare = std::less<K>>
+class btree_set : public btree<K, K, Compare> {
+  using tree_type = btree<K, K, Compare>;
+
+ public:
+  using key_type = K;
+  using value_type = K;
+  using size_type = typename tree_type::size_type;
+  // Ключ задаёт место элемента в узле B-дерева, поэтому iterator тоже
+  // только для чтения
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
+
+  // CONSTRUCTORS
+  btree_set() : tree_type(){};
+  explicit btree_set(const Compare &comp) : tree_type(comp){};
+  btree_set(std::initializer_list<value_type> const &items) : tree_type() {
+    for (const auto &item : items) insert(item);
+  };
+  btree_set(const btree_set &s) : tree_type(s){};
+  btree_set(btree_set &&s) noexcept : tree_type(std::move(s)){};
+
+  // DESTRUCTOR
+  ~btree_set() = default;
+
+  btree_set &operator=(const btree_set &s) {
+    tree_type::operator=(s);
+    return *this;
+  }
+
+  btree_set &operator=(btree_set &&s) noexcept {
+    tree_type::operator=(std::move(s));
+    return *this;
+  }
+
+  iterator begin() const noexcept { return tree_type::begin(); }
+  iterator end() const noexcept { return tree_type::end(); }
+
+  iterator find(const K &key) const { return tree_type::find(key); }
+
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const Other &key) const {
+    return tree_type::find(key);
+  }
+
+  iterator lower_bound(const K &key) const {
+    return tree_type::lower_bound(key);
+  }
+
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const Other &key) const {
+    return tree_type::lower_bound(key);
+  }
+
+  iterator upper_bound(const K &key) const {
+    return tree_type::upper_bound(key);
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return this->emplaceKey(value, value);
+  }
+
+  template <class... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    std::vector<std::pair<iterator, bool>> vec;
+    for (const auto &arg : {args...}) {
+      vec.push_back(insert(arg));
+    }
+    return vec;
+  }
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_BTREE_SET_H_
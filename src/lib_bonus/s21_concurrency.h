@@ -0,0 +1,67 @@
+#ifndef CPP2_S21_CONTAINERS_S21_CONCURRENCY_H_
+#define CPP2_S21_CONTAINERS_S21_CONCURRENCY_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace s21 {
+// Общие детали многопоточных контейнеров
+
+// Размер строки кэша: поля, которые пишут разные потоки, выравниваются на
+// него, чтобы не делить одну строку (false sharing)
+inline constexpr size_t kCacheLine = 64;
+
+// Быстрый генератор xorshift64 без синхронизации: у каждого потока своё
+// состояние, засеянное адресом этого состояния. Годится для выбора жертвы
+// или высоты башни, но не для чего-то, где важно качество случайности
+inline uint64_t thread_random() noexcept {
+  thread_local uint64_t state =
+      0x9e3779b97f4a7c15ULL ^ reinterpret_cast<uintptr_t>(&state);
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+// Нарастающее ожидание для циклов повтора: сначала короткое вращение, затем
+// уступка процессора, затем сон, удваивающийся до kMaxSleep
+class backoff {
+ public:
+  static constexpr unsigned kSpins = 64;
+  static constexpr unsigned kYields = 16;
+  static constexpr std::chrono::microseconds kMaxSleep{1000};
+
+  void wait() {
+    if (step_ < kSpins) {
+      for (unsigned i = 0; i <= step_; i += 8) pause();
+    } else if (step_ < kSpins + kYields) {
+      std::this_thread::yield();
+    } else {
+      std::this_thread::sleep_for(sleep_);
+      if (sleep_ < kMaxSleep) sleep_ *= 2;
+    }
+    ++step_;
+  }
+
+  void reset() {
+    step_ = 0;
+    sleep_ = std::chrono::microseconds(1);
+  }
+
+ private:
+  static void pause() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+  }
+
+  unsigned step_ = 0;
+  std::chrono::microseconds sleep_{1};
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_CONCURRENCY_H_
@@ -0,0 +1,163 @@
+#ifndef CPP2_S21_CONTAINERS_S21_CONCURRENT_MAP_H_
+#define CPP2_S21_CONTAINERS_S21_CONCURRENT_MAP_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+
+#include "../lib/s21_map.h"
+#include "s21_concurrency.h"
+
+namespace s21 {
+// Потокобезопасный map: ключи распределяются по хешу между шардами, каждый
+// шард - отдельный s21::map под своей блокировкой читатель/писатель. Потоки,
+// работающие с разными шардами, друг друга не ждут.
+//
+// Итераторов нет: ссылка на элемент живёт только под блокировкой шарда,
+// поэтому доступ к значениям идёт копией (find) или через visit/for_each.
+template <typename K, typename V, typename Hash = std::hash<K>>
+class concurrent_map {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using size_type = size_t;
+  using hasher = Hash;
+
+  static constexpr size_type kDefaultShards = 64;
+
+  // CONSTRUCTORS
+  // Число шардов округляется вверх до степени двойки
+  explicit concurrent_map(size_type shards = kDefaultShards)
+      : shard_count_(1) {
+    while (shard_count_ < shards) shard_count_ <<= 1;
+    shards_.reset(new shard[shard_count_]);
+  }
+
+  concurrent_map(const concurrent_map &) = delete;
+  concurrent_map &operator=(const concurrent_map &) = delete;
+
+  // DESTRUCTOR
+  ~concurrent_map() = default;
+
+  // LOOKUP
+
+  // Возвращает копию значения или пустой optional
+  std::optional<V> find(const K &key) const {
+    const shard &s = shardFor(key);
+    std::shared_lock<std::shared_mutex> guard(s.lock);
+    auto node = s.items.search(key);
+    if (!node) return std::nullopt;
+    return node->element_->second;
+  }
+
+  bool contains(const K &key) const {
+    const shard &s = shardFor(key);
+    std::shared_lock<std::shared_mutex> guard(s.lock);
+    return s.items.search(key) != nullptr;
+  }
+
+  // MODIFIERS
+
+  // Вставляет элемент, если ключа ещё нет. Возвращает true при вставке
+  bool insert(const K &key, const V &obj) {
+    shard &s = shardFor(key);
+    std::unique_lock<std::shared_mutex> guard(s.lock);
+    return s.items.insert(key, obj).second;
+  }
+
+  // Вставляет или перезаписывает значение. Возвращает true при вставке
+  bool insert_or_assign(const K &key, const V &obj) {
+    shard &s = shardFor(key);
+    std::unique_lock<std::shared_mutex> guard(s.lock);
+    return s.items.insert_or_assign(key, obj).second;
+  }
+
+  size_type erase(const K &key) {
+    shard &s = shardFor(key);
+    std::unique_lock<std::shared_mutex> guard(s.lock);
+    auto node = s.items.search(key);
+    if (!node) return 0;
+    s.items.erase(node);
+    return 1;
+  }
+
+  // Вызывает fn(V &) для значения под эксклюзивной блокировкой шарда, что
+  // позволяет менять значение на месте. Возвращает false, если ключа нет
+  template <typename F>
+  bool visit(const K &key, F &&fn) {
+    shard &s = shardFor(key);
+    std::unique_lock<std::shared_mutex> guard(s.lock);
+    auto node = s.items.search(key);
+    if (!node) return false;
+    fn(node->element_->second);
+    return true;
+  }
+
+  // Обходит элементы шард за шардом, вызывая fn(const K &, const V &).
+  // Внутри шарда обход согласован (шард заблокирован на чтение), между
+  // шардами - нет
+  template <typename F>
+  void for_each(F &&fn) const {
+    for (size_type i = 0; i < shard_count_; ++i) {
+      const shard &s = shards_[i];
+      std::shared_lock<std::shared_mutex> guard(s.lock);
+      if (s.items.empty()) continue;
+      for (auto it = s.items.begin(); it != s.items.end(); ++it) {
+        fn(it->first, it->second);
+      }
+    }
+  }
+
+  void clear() {
+    for (size_type i = 0; i < shard_count_; ++i) {
+      std::unique_lock<std::shared_mutex> guard(shards_[i].lock);
+      shards_[i].items.clear();
+    }
+  }
+
+  // CAPACITY
+
+  // Сумма размеров шардов; при параллельных изменениях - приблизительная
+  size_type size() const {
+    size_type result = 0;
+    for (size_type i = 0; i < shard_count_; ++i) {
+      std::shared_lock<std::shared_mutex> guard(shards_[i].lock);
+      result += shards_[i].items.size();
+    }
+    return result;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  size_type shard_count() const { return shard_count_; }
+
+ private:
+  // Шард занимает целые кэш-линии, чтобы блокировки соседних шардов не
+  // делили одну линию
+  struct alignas(kCacheLine) shard {
+    mutable std::shared_mutex lock;
+    map<K, V> items;
+  };
+
+  // std::hash для целых - тождественная функция, поэтому хеш перемешивается
+  // и шард берётся из старших бит
+  const shard &shardFor(const K &key) const {
+    uint64_t h = static_cast<uint64_t>(hasher()(key));
+    h *= 0x9e3779b97f4a7c15ULL;
+    return shards_[(h >> 32) & (shard_count_ - 1)];
+  }
+
+  shard &shardFor(const K &key) {
+    return const_cast<shard &>(
+        static_cast<const concurrent_map *>(this)->shardFor(key));
+  }
+
+  size_type shard_count_;
+  std::unique_ptr<shard[]> shards_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_CONCURRENT_MAP_H_
@@ -0,0 +1,254 @@
+#ifndef CPP2_S21_CONTAINERS_S21_COUNTED_MULTISET_H_
+#define CPP2_S21_CONTAINERS_S21_COUNTED_MULTISET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "s21_btree_map.h"
+
+namespace s21 {
+// multiset со счётчиками: вместо отдельного узла на каждый дубликат хранится
+// один элемент на различный ключ и число его копий. count и equal_range
+// работают за O(log n) по числу различных ключей, вставка и удаление копии
+// уже присутствующего ключа - это изменение счётчика. Обход по-прежнему
+// выдаёт каждую копию.
+//
+// Подходит для ключей, у которых эквивалентные значения неотличимы: все копии
+// представлены одним сохранённым ключом. Итераторы становятся
+// недействительными, когда появляется новый ключ или исчезает последняя
+// копия ключа; изменение счётчика их не затрагивает.
+template <typename K, typename Compare = std::less<K>>
+class counted_multiset {
+  using counts_type = btree_map<K, size_t, Compare>;
+
+ public:
+  using key_type = K;
+  using value_type = K;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  // Позиция - элемент таблицы счётчиков и номер копии внутри него
+  class const_iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = counted_multiset::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    const_iterator() : copy_(0) {}
+
+    reference operator*() const { return entry_->first; }
+    pointer operator->() const { return &entry_->first; }
+
+    const_iterator &operator++() {
+      if (++copy_ == entry_->second) {
+        ++entry_;
+        copy_ = 0;
+      }
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+
+    const_iterator &operator--() {
+      if (copy_ == 0) {
+        --entry_;
+        copy_ = entry_->second;
+      }
+      --copy_;
+      return *this;
+    }
+
+    const_iterator operator--(int) {
+      const_iterator tmp(*this);
+      --*this;
+      return tmp;
+    }
+
+    bool operator==(const const_iterator &other) const {
+      return entry_ == other.entry_ && copy_ == other.copy_;
+    }
+    bool operator!=(const const_iterator &other) const {
+      return !(*this == other);
+    }
+
+   private:
+    friend class counted_multiset;
+
+    const_iterator(typename counts_type::const_iterator entry, size_type copy)
+        : entry_(entry), copy_(copy) {}
+
+    typename counts_type::const_iterator entry_;
+    size_type copy_;
+  };
+
+  // Все копии делят один сохранённый ключ, так что изменять через итератор
+  // нечего
+  using iterator = const_iterator;
+
+  // CONSTRUCTORS
+  counted_multiset() : size_(0) {}
+  explicit counted_multiset(const Compare &comp) : counts_(comp), size_(0) {}
+  counted_multiset(std::initializer_list<value_type> const &items)
+      : counted_multiset() {
+    for (const auto &item : items) insert(item);
+  }
+  counted_multiset(const counted_multiset &s) = default;
+  counted_multiset(counted_multiset &&s) noexcept
+      : counts_(std::move(s.counts_)), size_(s.size_) {
+    s.size_ = 0;
+  }
+
+  // DESTRUCTOR
+  ~counted_multiset() = default;
+
+  counted_multiset &operator=(const counted_multiset &s) = default;
+  counted_multiset &operator=(counted_multiset &&s) noexcept {
+    counts_ = std::move(s.counts_);
+    size_ = s.size_;
+    s.size_ = 0;
+    return *this;
+  }
+
+  // ITERATORS
+  iterator begin() const noexcept { return iterator(counts_.begin(), 0); }
+  iterator end() const noexcept { return iterator(counts_.end(), 0); }
+
+  // CAPACITY
+  bool empty() const noexcept { return size_ == 0; }
+  // Число копий всех ключей
+  size_type size() const noexcept { return size_; }
+  // Число различных ключей
+  size_type distinct() const noexcept { return counts_.size(); }
+  size_type max_size() const noexcept { return counts_.max_size(); }
+
+  // MODIFIERS
+  void clear() noexcept {
+    counts_.clear();
+    size_ = 0;
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return {insert(value, 1), true};
+  }
+
+  // Добавляет n копий value одним изменением счётчика. Возвращает итератор
+  // на первую из добавленных копий
+  iterator insert(const value_type &value, size_type n) {
+    if (n == 0) return lower_bound(value);
+    auto res = counts_.insert(value, 0);
+    size_type first = res.first->second;
+    res.first->second += n;
+    size_ += n;
+    return iterator(res.first, first);
+  }
+
+  template <class... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    std::vector<std::pair<iterator, bool>> vec;
+    for (const auto &arg : {args...}) {
+      vec.push_back(insert(arg));
+    }
+    return vec;
+  }
+
+  // Удаляет одну копию ключа, на который указывает pos
+  void erase(iterator pos) {
+    // Итератор константный, а сама таблица счётчиков - нет
+    size_type &copies = const_cast<size_type &>(pos.entry_->second);
+    --size_;
+    if (--copies == 0) counts_.erase(pos.entry_);
+  }
+
+  // Удаляет все копии key и возвращает их число
+  size_type erase(const K &key) {
+    auto entry = counts_.find(key);
+    if (entry == counts_.end()) return 0;
+    size_type n = entry->second;
+    size_ -= n;
+    counts_.erase(entry);
+    return n;
+  }
+
+  void swap(counted_multiset &other) noexcept {
+    counts_.swap(other.counts_);
+    std::swap(size_, other.size_);
+  }
+
+  // Переносит все копии из other; счётчики совпадающих ключей складываются
+  void merge(counted_multiset &other) {
+    if (this == &other) return;
+    for (const auto &entry : other.counts_) insert(entry.first, entry.second);
+    other.clear();
+  }
+
+  // LOOKUP
+  iterator find(const K &key) const { return iterator(counts_.find(key), 0); }
+
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const Other &key) const {
+    return iterator(counts_.find(key), 0);
+  }
+
+  bool contains(const K &key) const { return counts_.contains(key); }
+
+  size_type count(const K &key) const {
+    auto entry = counts_.find(key);
+    return entry == counts_.end() ? 0 : entry->second;
+  }
+
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type count(const Other &key) const {
+    auto entry = counts_.find(key);
+    return entry == counts_.end() ? 0 : entry->second;
+  }
+
+  // Начало записи счётчиков для первого ключа не меньше key
+  iterator lower_bound(const K &key) const {
+    return iterator(counts_.lower_bound(key), 0);
+  }
+
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const Other &key) const {
+    return iterator(counts_.lower_bound(key), 0);
+  }
+
+  // Начало записи для первого ключа больше key: копии ключей,
+  // эквивалентных key, пропускаются целиком вместе со счётчиком
+  iterator upper_bound(const K &key) const {
+    return iterator(counts_.upper_bound(key), 0);
+  }
+
+  // Обе границы находятся одним поиском ключа в таблице счётчиков
+  std::pair<iterator, iterator> equal_range(const K &key) const {
+    auto entry = counts_.lower_bound(key);
+    if (entry == counts_.end() || key_comp()(key, entry->first)) {
+      return {iterator(entry, 0), iterator(entry, 0)};
+    }
+    auto next = entry;
+    return {iterator(entry, 0), iterator(++next, 0)};
+  }
+
+  // Компаратор хранится в таблице счётчиков
+  key_compare key_comp() const { return counts_.key_comp(); }
+
+ private:
+  counts_type counts_;
+  size_type size_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_COUNTED_MULTISET_H_
@@ -0,0 +1,190 @@
+#ifndef CPP2_S21_CONTAINERS_S21_EPOCH_H_
+#define CPP2_S21_CONTAINERS_S21_EPOCH_H_
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#include "s21_concurrency.h"
+
+namespace s21 {
+// Эпохальное освобождение памяти (epoch-based reclamation) для lock-free
+// контейнеров. Поток, читающий разделяемые узлы, держит epoch_guard; узел,
+// исключённый из структуры, передаётся в retire() и удаляется, когда
+// глобальная эпоха продвинется на два шага - к этому моменту ни один поток,
+// который мог его видеть, уже не находится под guard.
+//
+// Домен один на процесс, запись потока заводится при первом обращении и
+// возвращается в пул при завершении потока.
+class epoch_domain {
+ public:
+  using deleter_type = void (*)(void *);
+
+  static epoch_domain &instance() {
+    static epoch_domain domain;
+    return domain;
+  }
+
+  epoch_domain(const epoch_domain &) = delete;
+  epoch_domain &operator=(const epoch_domain &) = delete;
+
+  ~epoch_domain() {
+    record *r = records_.load();
+    while (r) {
+      record *next = r->next;
+      release(r->limbo, kInactive);
+      delete r;
+      r = next;
+    }
+    release(orphans_, kInactive);
+  }
+
+  // Отмечает поток активным в текущей эпохе. Вызовы могут быть вложенными
+  void pin() {
+    record *r = local();
+    if (r->nesting++ == 0) {
+      // Обмен с seq_cst не даёт последующим чтениям узлов обогнать
+      // публикацию эпохи
+      r->epoch.exchange(global_.load(std::memory_order_relaxed),
+                        std::memory_order_seq_cst);
+    }
+  }
+
+  void unpin() {
+    record *r = local();
+    if (--r->nesting == 0) {
+      r->epoch.store(kInactive, std::memory_order_release);
+    }
+  }
+
+  // Откладывает удаление ptr. Указатель уже должен быть недостижим для
+  // потоков, которые войдут под guard позже
+  void retire(void *ptr, deleter_type deleter) {
+    record *r = local();
+    uint64_t epoch = global_.load(std::memory_order_acquire);
+    r->limbo.push_back({ptr, deleter, epoch});
+    if (r->limbo.size() >= kCollectThreshold) {
+      tryAdvance();
+      release(r->limbo, global_.load(std::memory_order_acquire));
+    }
+  }
+
+  template <typename T>
+  void retire(T *ptr) {
+    retire(ptr, [](void *p) { delete static_cast<T *>(p); });
+  }
+
+  // Продвигает эпоху, если все активные потоки уже в текущей
+  bool tryAdvance() {
+    uint64_t epoch = global_.load(std::memory_order_seq_cst);
+    for (record *r = records_.load(std::memory_order_acquire); r;
+         r = r->next) {
+      uint64_t seen = r->epoch.load(std::memory_order_seq_cst);
+      if (seen != kInactive && seen != epoch) return false;
+    }
+    bool advanced = global_.compare_exchange_strong(epoch, epoch + 1);
+    if (advanced) {
+      std::unique_lock<std::mutex> guard(orphans_lock_, std::try_to_lock);
+      if (guard) release(orphans_, epoch + 1);
+    }
+    return advanced;
+  }
+
+ private:
+  static constexpr uint64_t kInactive = std::numeric_limits<uint64_t>::max();
+  static constexpr size_t kCollectThreshold = 64;
+
+  struct retired {
+    void *ptr;
+    deleter_type deleter;
+    uint64_t epoch;
+  };
+
+  // Запись потока занимает свою кэш-линию: epoch читают все, пишет владелец
+  struct alignas(kCacheLine) record {
+    std::atomic<uint64_t> epoch{kInactive};
+    std::atomic<bool> in_use{true};
+    record *next = nullptr;
+    unsigned nesting = 0;
+    std::vector<retired> limbo;
+  };
+
+  // Держит запись потока и возвращает её в пул при завершении потока
+  class thread_slot {
+   public:
+    explicit thread_slot(epoch_domain &domain)
+        : domain_(domain), record_(domain.acquire()) {}
+    ~thread_slot() { domain_.abandon(record_); }
+
+    record *get() const { return record_; }
+
+   private:
+    epoch_domain &domain_;
+    record *record_;
+  };
+
+  epoch_domain() = default;
+
+  record *local() {
+    static thread_local thread_slot slot(*this);
+    return slot.get();
+  }
+
+  // Занимает свободную запись или добавляет новую в начало списка
+  record *acquire() {
+    for (record *r = records_.load(std::memory_order_acquire); r;
+         r = r->next) {
+      bool expected = false;
+      if (r->in_use.compare_exchange_strong(expected, true)) return r;
+    }
+    record *r = new record();
+    r->next = records_.load(std::memory_order_relaxed);
+    while (!records_.compare_exchange_weak(r->next, r)) {
+    }
+    return r;
+  }
+
+  void abandon(record *r) {
+    if (!r->limbo.empty()) {
+      std::lock_guard<std::mutex> guard(orphans_lock_);
+      orphans_.insert(orphans_.end(), r->limbo.begin(), r->limbo.end());
+      r->limbo.clear();
+    }
+    r->nesting = 0;
+    r->epoch.store(kInactive, std::memory_order_release);
+    r->in_use.store(false, std::memory_order_release);
+  }
+
+  // Удаляет отложенные узлы, запечатанные не позже epoch - 2. Узлы лежат в
+  // порядке запечатывания, поэтому освобождается префикс
+  static void release(std::vector<retired> &items, uint64_t epoch) {
+    size_t count = 0;
+    while (count < items.size() &&
+           (epoch == kInactive || items[count].epoch + 2 <= epoch)) {
+      items[count].deleter(items[count].ptr);
+      ++count;
+    }
+    items.erase(items.begin(), items.begin() + count);
+  }
+
+  std::atomic<uint64_t> global_{0};
+  std::atomic<record *> records_{nullptr};
+  std::mutex orphans_lock_;
+  std::vector<retired> orphans_;
+};
+
+// RAII-защита: пока объект жив, узлы, прочитанные текущим потоком, не будут
+// освобождены. Копия снова входит в эпоху, поэтому guard можно хранить в
+// итераторах; использовать его можно только в создавшем потоке
+class epoch_guard {
+ public:
+  epoch_guard() { epoch_domain::instance().pin(); }
+  epoch_guard(const epoch_guard &) { epoch_domain::instance().pin(); }
+  epoch_guard &operator=(const epoch_guard &) { return *this; }
+  ~epoch_guard() { epoch_domain::instance().unpin(); }
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_EPOCH_H_
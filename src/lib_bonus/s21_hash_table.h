@@ -0,0 +1,571 @@
+#ifndef CPP2_S21_CONTAINERS_S21_HASH_TABLE_H_
+#define CPP2_S21_CONTAINERS_S21_HASH_TABLE_H_
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+// Хеш-таблица с открытой адресацией в стиле Swiss table. Рядом со слотами
+// хранится массив управляющих байт: старший бит отмечает пустой/удалённый
+// слот, младшие 7 бит занятого слота - часть хеша (h2). Поиск сравнивает
+// сразу группу из 16 управляющих байт (SSE2 или побайтово без него) и
+// обращается к слоту только при совпадении h2.
+//
+// K - тип ключа, T - тип хранимого элемента (K для set, пара для map).
+// Hash и KeyEqual хранятся в таблице и копируются, переносятся и
+// обмениваются вместе с ней, поэтому могут иметь состояние.
+template <typename K, typename T, typename Hash, typename KeyEqual>
+class hash_table {
+ public:
+  using key_type = K;
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+  class const_iterator;
+  class iterator;
+
+ protected:
+  using ctrl_t = int8_t;
+
+  static constexpr ctrl_t kEmpty = -128;
+  static constexpr ctrl_t kDeleted = -2;
+  static constexpr ctrl_t kSentinel = -1;
+  static constexpr size_type kWidth = 16;
+
+  // Группа из kWidth управляющих байт. Маски возвращаются по биту на байт
+  class group {
+   public:
+    explicit group(const ctrl_t *pos) {
+#ifdef __SSE2__
+      ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+#else
+      std::memcpy(ctrl_, pos, kWidth);
+#endif
+    }
+
+    // Байты, совпадающие с h2
+    uint32_t match(ctrl_t h2) const {
+#ifdef __SSE2__
+      return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_));
+#else
+      return maskOf([h2](ctrl_t c) { return c == h2; });
+#endif
+    }
+
+    uint32_t matchEmpty() const {
+#ifdef __SSE2__
+      return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(kEmpty), ctrl_));
+#else
+      return maskOf([](ctrl_t c) { return c == kEmpty; });
+#endif
+    }
+
+    // Пустые и удалённые байты: всё, что меньше kSentinel
+    uint32_t matchEmptyOrDeleted() const {
+#ifdef __SSE2__
+      return _mm_movemask_epi8(
+          _mm_cmpgt_epi8(_mm_set1_epi8(kSentinel), ctrl_));
+#else
+      return maskOf([](ctrl_t c) { return c < kSentinel; });
+#endif
+    }
+
+   private:
+#ifdef __SSE2__
+    __m128i ctrl_;
+#else
+    template <typename Pred>
+    uint32_t maskOf(Pred pred) const {
+      uint32_t mask = 0;
+      for (size_type i = 0; i < kWidth; ++i) {
+        if (pred(ctrl_[i])) mask |= 1u << i;
+      }
+      return mask;
+    }
+
+    ctrl_t ctrl_[kWidth];
+#endif
+  };
+
+ public:
+  class const_iterator {
+    friend class hash_table;
+
+   public:
+    const_iterator() : ctrl_(nullptr), slot_(nullptr) {}
+    const_iterator(const ctrl_t *ctrl, value_type *slot)
+        : ctrl_(ctrl), slot_(slot) {
+      skipFree();
+    }
+
+    const_reference operator*() const { return *slot_; }
+    const value_type *operator->() const { return slot_; }
+
+    const_iterator &operator++() {
+      ++ctrl_;
+      ++slot_;
+      skipFree();
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator tmp(*this);
+      ++(*this);
+      return tmp;
+    }
+
+    bool operator==(const const_iterator &other) const {
+      return slot_ == other.slot_;
+    }
+    bool operator!=(const const_iterator &other) const {
+      return !(*this == other);
+    }
+
+   protected:
+    // Пропускает пустые и удалённые слоты; на kSentinel итерация заканчивается
+    void skipFree() {
+      while (ctrl_ && *ctrl_ < kSentinel) {
+        ++ctrl_;
+        ++slot_;
+      }
+    }
+
+    const ctrl_t *ctrl_;
+    value_type *slot_;
+  };
+
+  class iterator : public const_iterator {
+   public:
+    iterator() : const_iterator() {}
+    iterator(const ctrl_t *ctrl, value_type *slot)
+        : const_iterator(ctrl, slot) {}
+
+    reference operator*() const { return *this->slot_; }
+    value_type *operator->() const { return this->slot_; }
+
+    iterator &operator++() {
+      const_iterator::operator++();
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator tmp(*this);
+      ++(*this);
+      return tmp;
+    }
+  };
+
+  // CONSTRUCTORS
+  hash_table() : hash_table(hasher(), key_equal()) {}
+
+  hash_table(const hasher &hash, const key_equal &equal)
+      : ctrl_(nullptr),
+        slots_(nullptr),
+        capacity_(0),
+        size_(0),
+        growth_left_(0),
+        hash_(hash),
+        equal_(equal) {}
+
+  // Копирование сохраняет ёмкость и раскладку: элементы конструируются в
+  // тех же слотах без перехеширования. Управляющий байт слота пишется
+  // только после его элемента, так что при исключении деструктор этого
+  // конструктора разрушит лишь созданные элементы
+  hash_table(const hash_table &other) : hash_table(other.hash_, other.equal_) {
+    if (!other.size_) return;
+    allocate(other.capacity_);
+    for (size_type i = 0; i < capacity_; ++i) {
+      if (isFull(other.ctrl_[i])) {
+        emplaceAt(i, other.slots_[i]);
+        setCtrl(i, other.ctrl_[i]);
+        ++size_;
+        --growth_left_;
+      }
+    }
+  }
+
+  hash_table(hash_table &&other) noexcept
+      : hash_table(other.hash_, other.equal_) {
+    swap(other);
+  }
+
+  ~hash_table() { destroy(); }
+
+  // Копия строится целиком до обмена: при исключении таблица не меняется
+  hash_table &operator=(const hash_table &other) {
+    if (this != &other) {
+      hash_table copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  hash_table &operator=(hash_table &&other) noexcept {
+    if (this != &other) {
+      destroy();
+      swap(other);
+    }
+    return *this;
+  }
+
+  // ITERATORS
+  iterator begin() noexcept {
+    return capacity_ ? iterator(ctrl_, slots_) : iterator();
+  }
+  iterator end() noexcept {
+    return capacity_ ? iterator(ctrl_ + capacity_, slots_ + capacity_)
+                     : iterator();
+  }
+  const_iterator begin() const noexcept {
+    return capacity_ ? const_iterator(ctrl_, slots_) : const_iterator();
+  }
+  const_iterator end() const noexcept {
+    return capacity_ ? const_iterator(ctrl_ + capacity_, slots_ + capacity_)
+                     : const_iterator();
+  }
+
+  // CAPACITY
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / (sizeof(value_type) + 1);
+  }
+
+  // HASH POLICY
+  size_type bucket_count() const noexcept { return capacity_; }
+
+  float load_factor() const noexcept {
+    return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f;
+  }
+
+  // Таблица растёт, когда заполнено 7/8 слотов
+  float max_load_factor() const noexcept { return 7.0f / 8.0f; }
+
+  hasher hash_function() const { return hash_; }
+  key_equal key_eq() const { return equal_; }
+
+  // Перестраивает таблицу под не менее count слотов (и не меньше, чем нужно
+  // текущим элементам). rehash(0) ужимает таблицу и вычищает удалённые слоты
+  void rehash(size_type count) {
+    size_type need = size_ ? growthToCapacity(size_) : 0;
+    if (count < need) count = need;
+    if (count == 0) {
+      if (!size_) destroy();
+      return;
+    }
+    resize(normalizeCapacity(count));
+  }
+
+  // Готовит таблицу к count элементам без промежуточных перестроек
+  void reserve(size_type count) {
+    if (count > size_ + growth_left_) {
+      resize(normalizeCapacity(growthToCapacity(count)));
+    }
+  }
+
+  // MODIFIERS
+  void clear() noexcept {
+    if (capacity_) {
+      destroySlots();
+      resetCtrl();
+    }
+  }
+
+  void erase(const_iterator pos) { eraseAt(pos.slot_ - slots_); }
+
+  size_type erase(const K &key) {
+    size_type index = 0;
+    bool found = findIndex(key, index);
+    if (found) eraseAt(index);
+    return found ? 1 : 0;
+  }
+
+  void swap(hash_table &other) noexcept {
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(growth_left_, other.growth_left_);
+    std::swap(hash_, other.hash_);
+    std::swap(equal_, other.equal_);
+  }
+
+  // Переносит из other элементы с ключами, которых нет в таблице
+  void merge(hash_table &other) {
+    if (this == &other) return;
+    for (auto it = other.begin(); it != other.end();) {
+      size_type hash = 0;
+      auto res = findOrPrepareInsert(keyOf(*it), hash);
+      if (res.second) {
+        insertAt(res.first, hash, std::move(*it));
+        other.erase(it++);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  // LOOKUP
+  iterator find(const K &key) { return findImpl(key); }
+  const_iterator find(const K &key) const {
+    return const_cast<hash_table *>(this)->findImpl(key);
+  }
+
+  // Поиск по ключу другого типа, если Hash и KeyEqual прозрачные
+  template <typename Other, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  iterator find(const Other &key) {
+    return findImpl(key);
+  }
+
+  template <typename Other, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  const_iterator find(const Other &key) const {
+    return const_cast<hash_table *>(this)->findImpl(key);
+  }
+
+  bool contains(const K &key) const { return find(key) != end(); }
+
+  template <typename Other, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  bool contains(const Other &key) const {
+    size_type index = 0;
+    return findIndex(key, index);
+  }
+
+  size_type count(const K &key) const { return contains(key) ? 1 : 0; }
+
+  template <typename Other, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  size_type count(const Other &key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+ protected:
+  static bool isFull(ctrl_t c) { return c >= 0; }
+
+  static const K &keyOf(const K &key) { return key; }
+
+  template <typename V>
+  static const K &keyOf(const std::pair<const K, V> &value) {
+    return value.first;
+  }
+
+  // Перемешивает хеш: std::hash для целых - тождественная функция, а h1 и h2
+  // берутся из разных бит
+  template <typename Key>
+  size_type hashOf(const Key &key) const {
+    uint64_t h = static_cast<uint64_t>(hash_(key));
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return static_cast<size_type>(h);
+  }
+
+  static size_type h1(size_type hash) { return hash >> 7; }
+  static ctrl_t h2(size_type hash) { return static_cast<ctrl_t>(hash & 0x7f); }
+
+  // Ёмкость вида 2^n - 1 (маска), не меньше kWidth - 1
+  static size_type normalizeCapacity(size_type n) {
+    size_type capacity = kWidth - 1;
+    while (capacity < n) capacity = capacity * 2 + 1;
+    return capacity;
+  }
+
+  static size_type capacityToGrowth(size_type capacity) {
+    return capacity - capacity / 8;
+  }
+
+  static size_type growthToCapacity(size_type growth) {
+    return growth + (growth - 1) / 7;
+  }
+
+  // Ищет слот с ключом key. Группы перебираются с шагом kWidth, 2 * kWidth,
+  // ... - при ёмкости 2^n - 1 такая последовательность обходит всю таблицу
+  template <typename Key>
+  bool findIndex(const Key &key, size_type &index) const {
+    if (!capacity_) return false;
+    size_type hash = hashOf(key);
+    size_type offset = h1(hash) & capacity_;
+    for (size_type step = kWidth;; step += kWidth) {
+      group g(ctrl_ + offset);
+      for (uint32_t mask = g.match(h2(hash)); mask; mask &= mask - 1) {
+        size_type i = (offset + __builtin_ctz(mask)) & capacity_;
+        if (equal_(keyOf(slots_[i]), key)) {
+          index = i;
+          return true;
+        }
+      }
+      if (g.matchEmpty()) return false;
+      offset = (offset + step) & capacity_;
+    }
+  }
+
+  template <typename Key>
+  iterator findImpl(const Key &key) {
+    size_type index = 0;
+    return findIndex(key, index) ? iterator(ctrl_ + index, slots_ + index)
+                                 : end();
+  }
+
+  size_type findFirstNonFull(size_type hash) const {
+    size_type offset = h1(hash) & capacity_;
+    for (size_type step = kWidth;; step += kWidth) {
+      uint32_t mask = group(ctrl_ + offset).matchEmptyOrDeleted();
+      if (mask) return (offset + __builtin_ctz(mask)) & capacity_;
+      offset = (offset + step) & capacity_;
+    }
+  }
+
+  // Возвращает индекс найденного ключа или свободный слот под него (second -
+  // ключ новый) и хэш ключа. Таблица при этом не меняется, кроме возможного
+  // роста: слот станет занятым только в insertAt
+  std::pair<size_type, bool> findOrPrepareInsert(const K &key,
+                                                 size_type &hash) {
+    size_type index = 0;
+    if (findIndex(key, index)) return {index, false};
+    hash = hashOf(key);
+    if (!capacity_) resize(kWidth - 1);
+    index = findFirstNonFull(hash);
+    if (growth_left_ == 0 && ctrl_[index] != kDeleted) {
+      // Если место съели удалённые слоты, хватит перестройки на месте
+      size_type capacity = capacity_;
+      if (size_ > capacityToGrowth(capacity_) / 2) capacity = capacity * 2 + 1;
+      resize(capacity);
+      index = findFirstNonFull(hash);
+    }
+    return {index, true};
+  }
+
+  // Сначала создаёт значение, потом отмечает слот занятым: если
+  // конструктор бросит, таблица останется прежней
+  template <typename... Args>
+  void insertAt(size_type index, size_type hash, Args &&...args) {
+    emplaceAt(index, std::forward<Args>(args)...);
+    growth_left_ -= ctrl_[index] == kEmpty;
+    setCtrl(index, h2(hash));
+    ++size_;
+  }
+
+  template <typename... Args>
+  void emplaceAt(size_type index, Args &&...args) {
+    std::allocator_traits<std::allocator<value_type>>::construct(
+        alloc_, slots_ + index, std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplaceKey(const K &key, Args &&...args) {
+    size_type hash = 0;
+    auto res = findOrPrepareInsert(key, hash);
+    if (res.second) insertAt(res.first, hash, std::forward<Args>(args)...);
+    return {iterator(ctrl_ + res.first, slots_ + res.first), res.second};
+  }
+
+  // Слот можно вернуть в kEmpty, если ни одна проба не могла пройти через
+  // него дальше: вокруг него нет kWidth подряд занятых байт
+  void eraseAt(size_type index) {
+    std::allocator_traits<std::allocator<value_type>>::destroy(alloc_,
+                                                               slots_ + index);
+    --size_;
+    size_type before = (index - kWidth) & capacity_;
+    uint32_t empty_after = group(ctrl_ + index).matchEmpty();
+    uint32_t empty_before = group(ctrl_ + before).matchEmpty();
+    bool was_never_full =
+        empty_before && empty_after &&
+        static_cast<size_type>(__builtin_ctz(empty_after) +
+                               __builtin_clz(empty_before) - 16) < kWidth;
+    setCtrl(index, was_never_full ? kEmpty : kDeleted);
+    growth_left_ += was_never_full;
+  }
+
+  // Записывает управляющий байт и его копию за kSentinel, чтобы группа,
+  // начатая у конца таблицы, видела начало таблицы
+  void setCtrl(size_type index, ctrl_t value) {
+    ctrl_[index] = value;
+    ctrl_[((index - (kWidth - 1)) & capacity_) + (kWidth - 1)] = value;
+  }
+
+  void allocate(size_type capacity) {
+    capacity_ = capacity;
+    ctrl_ = new ctrl_t[capacity_ + kWidth];
+    slots_ = alloc_.allocate(capacity_);
+    resetCtrl();
+  }
+
+  void resetCtrl() {
+    std::memset(ctrl_, kEmpty, capacity_ + kWidth);
+    ctrl_[capacity_] = kSentinel;
+    size_ = 0;
+    growth_left_ = capacityToGrowth(capacity_);
+  }
+
+  // Элементы переносятся в новую таблицу через move_if_noexcept: если
+  // перенос может бросить, они копируются, и при исключении новая таблица
+  // разрушается, а эта остаётся прежней. Ключ pair<const K, V> копируется
+  // в любом случае
+  void resize(size_type capacity) {
+    hash_table fresh(hash_, equal_);
+    fresh.allocate(capacity);
+    for (size_type i = 0; i < capacity_; ++i) {
+      if (isFull(ctrl_[i])) {
+        size_type hash = hashOf(keyOf(slots_[i]));
+        size_type index = fresh.findFirstNonFull(hash);
+        fresh.emplaceAt(index, std::move_if_noexcept(slots_[i]));
+        fresh.setCtrl(index, h2(hash));
+        ++fresh.size_;
+        --fresh.growth_left_;
+      }
+    }
+    swap(fresh);
+  }
+
+  void destroySlots() {
+    for (size_type i = 0; i < capacity_; ++i) {
+      if (isFull(ctrl_[i])) {
+        std::allocator_traits<std::allocator<value_type>>::destroy(
+            alloc_, slots_ + i);
+      }
+    }
+  }
+
+  void destroy() {
+    if (capacity_) {
+      destroySlots();
+      delete[] ctrl_;
+      alloc_.deallocate(slots_, capacity_);
+    }
+    ctrl_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+    growth_left_ = 0;
+  }
+
+  ctrl_t *ctrl_;
+  value_type *slots_;
+  size_type capacity_;
+  size_type size_;
+  size_type growth_left_;
+  hasher hash_;
+  key_equal equal_;
+  std::allocator<value_type> alloc_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_HASH_TABLE_H_
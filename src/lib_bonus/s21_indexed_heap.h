@@ -0,0 +1,232 @@
+#ifndef CPP2_S21_CONTAINERS_S21_INDEXED_HEAP_H_
+#define CPP2_S21_CONTAINERS_S21_INDEXED_HEAP_H_
+
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../lib/s21_vector.h"
+
+namespace s21 {
+// Индексированная куча для плотных целых ключей (номеров вершин графа):
+// d-арная куча пар (ключ, приоритет) и рядом индекс positions_[ключ] -
+// место пары в куче. Индекс позволяет за O(log n) менять приоритет уже
+// лежащего ключа и удалять его, поэтому, например, в алгоритме Дейкстры
+// каждая вершина лежит в куче не больше одного раза.
+//
+// На вершине - наименьший по Compare приоритет: decrease_key приближает
+// ключ к вершине, increase_key отдаляет. Индекс растёт до наибольшего
+// встреченного ключа, так что ключи должны быть небольшими.
+template <typename Key, typename Priority,
+          typename Compare = std::less<Priority>, size_t Arity = 4>
+class indexed_heap {
+  static_assert(std::is_integral_v<Key>, "indexed_heap keys must be integers");
+  static_assert(Arity >= 2, "indexed_heap arity must be at least 2");
+
+ public:
+  using key_type = Key;
+  using priority_type = Priority;
+  using value_type = std::pair<key_type, priority_type>;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using priority_compare = Compare;
+
+  indexed_heap() = default;
+
+  // Сразу выделяет индекс для ключей [0, key_count)
+  explicit indexed_heap(size_type key_count,
+                        const priority_compare &comp = priority_compare())
+      : comp_(comp) {
+    growIndex(key_count);
+  }
+
+  // ELEMENT ACCESS
+  // Пара с наименьшим приоритетом
+  const_reference top() const {
+    checkNotEmpty();
+    return *heap_.begin();
+  }
+
+  bool contains(key_type key) const noexcept {
+    return positionOf(key) != kAbsent;
+  }
+
+  const priority_type &priority(key_type key) const {
+    return heap_.begin()[checkedPosition(key)].second;
+  }
+
+  // MODIFIERS
+  // Возвращает false, если ключ уже в куче
+  bool push(key_type key, const priority_type &priority) {
+    if (contains(key)) return false;
+    if (negative(key)) {
+      throw std::out_of_range("indexed_heap key is negative");
+    }
+    growIndex(static_cast<size_type>(key) + 1);
+    heap_.push_back(value_type(key, priority));
+    siftUp(size() - 1);
+    return true;
+  }
+
+  void pop() {
+    checkNotEmpty();
+    removeAt(0);
+  }
+
+  // Новый приоритет не должен быть хуже текущего
+  void decrease_key(key_type key, const priority_type &priority) {
+    size_type position = checkedPosition(key);
+    if (comp_(heap_.begin()[position].second, priority)) {
+      throw std::invalid_argument("indexed_heap::decrease_key: worse priority");
+    }
+    heap_.begin()[position].second = priority;
+    siftUp(position);
+  }
+
+  // Новый приоритет не должен быть лучше текущего
+  void increase_key(key_type key, const priority_type &priority) {
+    size_type position = checkedPosition(key);
+    if (comp_(priority, heap_.begin()[position].second)) {
+      throw std::invalid_argument(
+          "indexed_heap::increase_key: better priority");
+    }
+    heap_.begin()[position].second = priority;
+    siftDown(position);
+  }
+
+  // Возвращает false, если ключа не было
+  bool erase(key_type key) {
+    size_type position = positionOf(key);
+    if (position == kAbsent) return false;
+    removeAt(position);
+    return true;
+  }
+
+  // Индекс сохраняет размер, сбрасываются только занятые позиции
+  void clear() noexcept {
+    for (const value_type &entry : heap_) {
+      positions_.begin()[entry.first] = kAbsent;
+    }
+    heap_.clear();
+  }
+
+  void swap(indexed_heap &other) noexcept {
+    heap_.swap(other.heap_);
+    positions_.swap(other.positions_);
+    std::swap(comp_, other.comp_);
+  }
+
+  // CAPACITY
+  size_type size() const noexcept { return heap_.end() - heap_.begin(); }
+  bool empty() const noexcept { return heap_.empty(); }
+
+ private:
+  static constexpr size_type kAbsent = std::numeric_limits<size_type>::max();
+
+  void checkNotEmpty() const {
+    if (empty()) throw std::out_of_range("indexed_heap is empty");
+  }
+
+  static bool negative(key_type key) noexcept {
+    if constexpr (std::is_signed_v<key_type>) {
+      return key < 0;
+    } else {
+      return false;
+    }
+  }
+
+  size_type indexSize() const noexcept {
+    return positions_.end() - positions_.begin();
+  }
+
+  size_type positionOf(key_type key) const noexcept {
+    if (negative(key) || static_cast<size_type>(key) >= indexSize()) {
+      return kAbsent;
+    }
+    return positions_.begin()[key];
+  }
+
+  size_type checkedPosition(key_type key) const {
+    size_type position = positionOf(key);
+    if (position == kAbsent) throw std::out_of_range("indexed_heap: no key");
+    return position;
+  }
+
+  // Растёт геометрически, чтобы ключи по возрастанию не копировали индекс
+  // на каждом push
+  void growIndex(size_type key_count) {
+    size_type known = indexSize();
+    if (key_count <= known) return;
+    size_type doubled = 2 * positions_.capacity();
+    positions_.reserve(key_count > doubled ? key_count : doubled);
+    for (; known < key_count; ++known) positions_.push_back(kAbsent);
+  }
+
+  // Кладёт пару в ячейку position и обновляет индекс
+  void place(size_type position, value_type &&entry) {
+    positions_.begin()[entry.first] = position;
+    heap_.begin()[position] = std::move(entry);
+  }
+
+  void removeAt(size_type position) {
+    value_type *base = heap_.begin();
+    positions_.begin()[base[position].first] = kAbsent;
+    size_type last = size() - 1;
+    if (position != last) {
+      value_type moved = std::move(base[last]);
+      heap_.pop_back();
+      place(position, std::move(moved));
+      // Перенесённый с конца элемент может пойти в любую сторону
+      if (position > 0 && comp_(base[position].second,
+                                base[(position - 1) / Arity].second)) {
+        siftUp(position);
+      } else {
+        siftDown(position);
+      }
+    } else {
+      heap_.pop_back();
+    }
+  }
+
+  // Просеивание с «дыркой»: пара переносится один раз, индекс обновляется
+  // для каждой сдвинутой пары
+  void siftUp(size_type position) {
+    value_type *base = heap_.begin();
+    value_type entry = std::move(base[position]);
+    while (position > 0) {
+      size_type parent = (position - 1) / Arity;
+      if (!comp_(entry.second, base[parent].second)) break;
+      place(position, std::move(base[parent]));
+      position = parent;
+    }
+    place(position, std::move(entry));
+  }
+
+  void siftDown(size_type position) {
+    value_type *base = heap_.begin();
+    size_type count = size();
+    value_type entry = std::move(base[position]);
+    for (;;) {
+      size_type first = position * Arity + 1;
+      if (first >= count) break;
+      size_type end = first + Arity < count ? first + Arity : count;
+      size_type best = first;
+      for (size_type child = first + 1; child < end; ++child) {
+        if (comp_(base[child].second, base[best].second)) best = child;
+      }
+      if (!comp_(base[best].second, entry.second)) break;
+      place(position, std::move(base[best]));
+      position = best;
+    }
+    place(position, std::move(entry));
+  }
+
+  vector<value_type> heap_;
+  vector<size_type> positions_;
+  priority_compare comp_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_INDEXED_HEAP_H_
@@ -0,0 +1,438 @@
+#ifndef CPP2_S21_CONTAINERS_S21_INTRUSIVE_LIST_H_
+#define CPP2_S21_CONTAINERS_S21_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+class list_hook;
+
+template <typename T, list_hook T::*Member>
+class intrusive_list;
+
+// Звенья интрузивного списка, встраиваемые в объект пользователя. Хук
+// безопасный: разрушение объекта выкидывает его из списка, а копия объекта
+// получает несвязанный хук. Пока объект в списке, хук помнит его адрес:
+// вычислять объект по смещению поля можно только для standard-layout T
+class list_hook {
+ public:
+  list_hook() noexcept : prev_(nullptr), next_(nullptr), owner_(nullptr) {}
+  list_hook(const list_hook &) noexcept : list_hook() {}
+  list_hook &operator=(const list_hook &) noexcept { return *this; }
+  ~list_hook() { unlink(); }
+
+  bool is_linked() const noexcept { return next_ != nullptr; }
+
+  // Выкидывает объект из списка, в котором он состоит, за O(1)
+  void unlink() noexcept {
+    if (is_linked()) {
+      prev_->next_ = next_;
+      next_->prev_ = prev_;
+      prev_ = next_ = nullptr;
+    }
+  }
+
+ private:
+  template <typename T, list_hook T::*Member>
+  friend class intrusive_list;
+
+  list_hook *prev_;
+  list_hook *next_;
+  void *owner_;
+};
+
+// Двусвязный список объектов, которые сами хранят звенья в поле Member
+// типа list_hook. Список не выделяет память и не владеет объектами:
+// clear и erase только выкидывают их. Объект может состоять в нескольких
+// списках сразу через разные хуки.
+//
+// Хук может выкинуть объект из списка сам, поэтому список не хранит
+// счётчик: size() считает элементы за O(n), empty() работает за O(1).
+//
+//   struct timer { int id; s21::list_hook hook; };
+//   s21::intrusive_list<timer, &timer::hook> timers;
+template <typename T, list_hook T::*Member>
+class intrusive_list {
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+
+  class const_iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = intrusive_list::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    const_iterator() : hook_(nullptr) {}
+
+    reference operator*() const { return *owner(hook_); }
+    pointer operator->() const { return owner(hook_); }
+
+    const_iterator &operator++() {
+      hook_ = hook_->next_;
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator tmp(*this);
+      hook_ = hook_->next_;
+      return tmp;
+    }
+
+    const_iterator &operator--() {
+      hook_ = hook_->prev_;
+      return *this;
+    }
+
+    const_iterator operator--(int) {
+      const_iterator tmp(*this);
+      hook_ = hook_->prev_;
+      return tmp;
+    }
+
+    bool operator==(const const_iterator &other) const {
+      return hook_ == other.hook_;
+    }
+    bool operator!=(const const_iterator &other) const {
+      return hook_ != other.hook_;
+    }
+
+   protected:
+    friend class intrusive_list;
+
+    explicit const_iterator(list_hook *hook) : hook_(hook) {}
+
+    list_hook *hook_;
+  };
+
+  class iterator : public const_iterator {
+   public:
+    using pointer = value_type *;
+    using reference = value_type &;
+
+    iterator() : const_iterator() {}
+
+    reference operator*() const { return *owner(this->hook_); }
+    pointer operator->() const { return owner(this->hook_); }
+
+    iterator &operator++() {
+      this->hook_ = this->hook_->next_;
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator tmp(*this);
+      this->hook_ = this->hook_->next_;
+      return tmp;
+    }
+
+    iterator &operator--() {
+      this->hook_ = this->hook_->prev_;
+      return *this;
+    }
+
+    iterator operator--(int) {
+      iterator tmp(*this);
+      this->hook_ = this->hook_->prev_;
+      return tmp;
+    }
+
+   private:
+    friend class intrusive_list;
+
+    explicit iterator(list_hook *hook) : const_iterator(hook) {}
+  };
+
+  // CONSTRUCTORS
+  intrusive_list() noexcept { reset(); }
+
+  intrusive_list(const intrusive_list &) = delete;
+  intrusive_list &operator=(const intrusive_list &) = delete;
+
+  intrusive_list(intrusive_list &&other) noexcept : intrusive_list() {
+    swap(other);
+  }
+
+  intrusive_list &operator=(intrusive_list &&other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  // DESTRUCTOR
+  ~intrusive_list() { clear(); }
+
+  // ELEMENT ACCESS
+  reference front() {
+    if (empty()) throw std::out_of_range("List is empty");
+    return *owner(header_.next_);
+  }
+  const_reference front() const {
+    if (empty()) throw std::out_of_range("List is empty");
+    return *owner(header_.next_);
+  }
+
+  reference back() {
+    if (empty()) throw std::out_of_range("List is empty");
+    return *owner(header_.prev_);
+  }
+  const_reference back() const {
+    if (empty()) throw std::out_of_range("List is empty");
+    return *owner(header_.prev_);
+  }
+
+  // ITERATORS
+  iterator begin() noexcept { return iterator(header_.next_); }
+  iterator end() noexcept { return iterator(&header_); }
+  const_iterator begin() const noexcept {
+    return const_iterator(header_.next_);
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(const_cast<list_hook *>(&header_));
+  }
+
+  // Итератор на объект, который состоит в этом списке
+  static iterator iterator_to(reference item) noexcept {
+    return iterator(&(item.*Member));
+  }
+  static const_iterator iterator_to(const_reference item) noexcept {
+    return const_iterator(const_cast<list_hook *>(&(item.*Member)));
+  }
+
+  // CAPACITY
+  bool empty() const noexcept { return header_.next_ == &header_; }
+
+  size_type size() const noexcept {
+    size_type count = 0;
+    for (const list_hook *h = header_.next_; h != &header_; h = h->next_) {
+      ++count;
+    }
+    return count;
+  }
+
+  // MODIFIERS
+  void clear() noexcept {
+    for (list_hook *h = header_.next_; h != &header_;) {
+      list_hook *next = h->next_;
+      h->prev_ = h->next_ = nullptr;
+      h = next;
+    }
+    reset();
+  }
+
+  void push_front(reference item) { linkBefore(header_.next_, item); }
+  void push_back(reference item) { linkBefore(&header_, item); }
+
+  void pop_front() {
+    if (!empty()) header_.next_->unlink();
+  }
+  void pop_back() {
+    if (!empty()) header_.prev_->unlink();
+  }
+
+  iterator insert(const_iterator pos, reference item) {
+    linkBefore(pos.hook_, item);
+    return iterator(&(item.*Member));
+  }
+
+  // Возвращает итератор на элемент, следующий за удалённым
+  iterator erase(const_iterator pos) noexcept {
+    list_hook *next = pos.hook_->next_;
+    pos.hook_->unlink();
+    return iterator(next);
+  }
+
+  // Выкидывает объект из этого списка за O(1), не проходя по списку
+  void erase(reference item) noexcept { (item.*Member).unlink(); }
+
+  void swap(intrusive_list &other) noexcept {
+    if (this == &other) return;
+    bool mine = empty(), theirs = other.empty();
+    std::swap(header_.prev_, other.header_.prev_);
+    std::swap(header_.next_, other.header_.next_);
+    if (theirs) {
+      reset();
+    } else {
+      fixHeader();
+    }
+    if (mine) {
+      other.reset();
+    } else {
+      other.fixHeader();
+    }
+  }
+
+  // Все элементы other перед pos за O(1)
+  void splice(const_iterator pos, intrusive_list &other) noexcept {
+    splice(pos, other, other.begin(), other.end());
+  }
+
+  void splice(const_iterator pos, intrusive_list &other,
+              const_iterator it) noexcept {
+    const_iterator next = it;
+    splice(pos, other, it, ++next);
+  }
+
+  // Диапазон [first, last) из other перед pos за O(1)
+  void splice(const_iterator pos, intrusive_list &,
+              const_iterator first, const_iterator last) noexcept {
+    if (first == last || pos == first || pos == last) return;
+    list_hook *from = first.hook_, *to = last.hook_->prev_;
+    from->prev_->next_ = last.hook_;
+    last.hook_->prev_ = from->prev_;
+    list_hook *at = pos.hook_;
+    from->prev_ = at->prev_;
+    to->next_ = at;
+    at->prev_->next_ = from;
+    at->prev_ = to;
+  }
+
+  void merge(intrusive_list &other) {
+    merge(other, [](const_reference a, const_reference b) { return a < b; });
+  }
+
+  // Слияние в один проход перевешиванием звеньев. При равенстве первым
+  // остаётся элемент этого списка
+  template <typename Compare>
+  void merge(intrusive_list &other, Compare comp) {
+    if (this == &other) return;
+    list_hook *cur = header_.next_;
+    while (!other.empty()) {
+      if (cur == &header_) {
+        splice(end(), other);
+      } else if (comp(*owner(other.header_.next_), *owner(cur))) {
+        list_hook *h = other.header_.next_;
+        h->unlink();
+        linkHookBefore(cur, h);
+      } else {
+        cur = cur->next_;
+      }
+    }
+  }
+
+  void reverse() noexcept {
+    list_hook *h = &header_;
+    do {
+      std::swap(h->prev_, h->next_);
+      h = h->prev_;
+    } while (h != &header_);
+  }
+
+  // Выкидывает подряд идущие равные элементы
+  void unique() {
+    if (empty()) return;
+    for (list_hook *h = header_.next_; h->next_ != &header_;) {
+      if (*owner(h) == *owner(h->next_)) {
+        h->next_->unlink();
+      } else {
+        h = h->next_;
+      }
+    }
+  }
+
+  void sort() {
+    sort([](const_reference a, const_reference b) { return a < b; });
+  }
+
+  // Устойчивая восходящая сортировка слиянием, как у s21::list: звенья
+  // перевешиваются, объекты не копируются и не перемещаются
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (empty() || header_.next_->next_ == &header_) return;
+    list_hook *bins[64] = {};
+    int used = 0;
+    header_.prev_->next_ = nullptr;
+    for (list_hook *h = header_.next_; h != nullptr;) {
+      list_hook *carry = h;
+      h = h->next_;
+      carry->next_ = nullptr;
+      int i = 0;
+      for (; i < used && bins[i] != nullptr; ++i) {
+        carry = mergeRuns(bins[i], carry, comp);
+        bins[i] = nullptr;
+      }
+      bins[i] = carry;
+      if (i == used) ++used;
+    }
+    list_hook *result = nullptr;
+    for (int i = 0; i < used; ++i) {
+      if (bins[i] != nullptr) {
+        result = result ? mergeRuns(bins[i], result, comp) : bins[i];
+      }
+    }
+    list_hook *prev = &header_;
+    for (list_hook *h = result; h != nullptr; prev = h, h = h->next_) {
+      prev->next_ = h;
+      h->prev_ = prev;
+    }
+    prev->next_ = &header_;
+    header_.prev_ = prev;
+  }
+
+ private:
+  // Объект, в который встроен связанный хук
+  static T *owner(list_hook *hook) noexcept {
+    return static_cast<T *>(hook->owner_);
+  }
+
+  static const T *owner(const list_hook *hook) noexcept {
+    return owner(const_cast<list_hook *>(hook));
+  }
+
+  void reset() noexcept { header_.prev_ = header_.next_ = &header_; }
+
+  // После обмена заголовками крайние элементы указывают на чужой заголовок
+  void fixHeader() noexcept {
+    header_.next_->prev_ = &header_;
+    header_.prev_->next_ = &header_;
+  }
+
+  static void linkHookBefore(list_hook *at, list_hook *h) noexcept {
+    h->prev_ = at->prev_;
+    h->next_ = at;
+    at->prev_->next_ = h;
+    at->prev_ = h;
+  }
+
+  static void linkBefore(list_hook *at, reference item) {
+    list_hook *h = &(item.*Member);
+    if (h->is_linked()) throw std::logic_error("Object is already linked");
+    h->owner_ = std::addressof(item);
+    linkHookBefore(at, h);
+  }
+
+  template <typename Compare>
+  static list_hook *mergeRuns(list_hook *left, list_hook *right,
+                              Compare &comp) {
+    list_hook *head = nullptr;
+    list_hook **tail = &head;
+    while (left != nullptr && right != nullptr) {
+      if (comp(*owner(right), *owner(left))) {
+        *tail = right;
+        right = right->next_;
+      } else {
+        *tail = left;
+        left = left->next_;
+      }
+      tail = &(*tail)->next_;
+    }
+    *tail = left ? left : right;
+    return head;
+  }
+
+  list_hook header_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_INTRUSIVE_LIST_H_
@@ -0,0 +1,154 @@
+#ifndef CPP2_S21_CONTAINERS_S21_LOCKFREE_STACK_H_
+#define CPP2_S21_CONTAINERS_S21_LOCKFREE_STACK_H_
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+#include "s21_concurrency.h"
+#include "s21_epoch.h"
+
+namespace s21 {
+// Lock-free стек Трайбера: вершина - атомарный указатель, push и pop
+// меняют её одним CAS-ом.
+//
+// Снятые узлы удаляются через epoch_domain, и все обращения к узлам идут
+// под epoch_guard. Поэтому адрес узла не может быть переиспользован, пока
+// его видит хотя бы один поток, и ABA (CAS вершины, которая успела уйти и
+// вернуться тем же адресом) невозможна без меток и двойного CAS.
+//
+// При неудачном CAS вершины операция пробует встретиться с
+// противоположной в массиве исключения (elimination backoff): push
+// оставляет узел в случайной ячейке и недолго ждёт, pop забирает узел из
+// ячейки. Встретившиеся push и pop взаимно гасятся, не трогая вершину,
+// так что под высокой конкуренцией поток операций расходится по ячейкам.
+template <typename T>
+class lockfree_stack {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  static constexpr size_type kEliminationSlots = 8;
+  // Сколько раз push проверяет, забрали ли его узел из ячейки
+  static constexpr unsigned kEliminationSpins = 64;
+
+  lockfree_stack() = default;
+  lockfree_stack(const lockfree_stack &) = delete;
+  lockfree_stack &operator=(const lockfree_stack &) = delete;
+
+  // Вызывается, когда другие потоки уже не работают со стеком
+  ~lockfree_stack() {
+    node *current = head_.value.load(std::memory_order_relaxed);
+    while (current) {
+      node *next = current->next;
+      delete current;
+      current = next;
+    }
+  }
+
+  // MODIFIERS
+  void push(const value_type &value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    node *fresh = new node(std::forward<Args>(args)...);
+    epoch_guard guard;
+    node *top = head_.value.load(std::memory_order_relaxed);
+    for (;;) {
+      fresh->next = top;
+      if (head_.value.compare_exchange_weak(top, fresh,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+        return;
+      }
+      if (tryHandOff(fresh)) return;
+      top = head_.value.load(std::memory_order_relaxed);
+    }
+  }
+
+  // Пустой результат - стек был пуст
+  std::optional<value_type> pop() {
+    std::optional<value_type> out;
+    epoch_guard guard;
+    node *top = head_.value.load(std::memory_order_acquire);
+    node *taken = nullptr;
+    while (top) {
+      if (head_.value.compare_exchange_weak(top, top->next,
+                                            std::memory_order_acquire,
+                                            std::memory_order_acquire)) {
+        taken = top;
+        break;
+      }
+      taken = tryTake();
+      if (taken) break;
+    }
+    if (taken) {
+      out.emplace(std::move(taken->value));
+      epoch_domain::instance().retire(taken);
+    }
+    return out;
+  }
+
+  // CAPACITY
+  // Моментальный снимок: при одновременных операциях может устареть
+  bool empty() const noexcept {
+    return head_.value.load(std::memory_order_acquire) == nullptr;
+  }
+
+ private:
+  struct node {
+    template <typename... Args>
+    explicit node(Args &&...args) : value(std::forward<Args>(args)...) {}
+
+    value_type value;
+    node *next = nullptr;
+  };
+
+  // Указатель в своей кэш-линии
+  struct alignas(kCacheLine) padded_pointer {
+    std::atomic<node *> value{nullptr};
+  };
+
+  // Кладёт узел в свободную ячейку исключения и ждёт встречного pop.
+  // true - узел забран, push завершён. Сравнивать ячейку с fresh безопасно:
+  // pop удаляет узлы через epoch_domain, а push ждёт под epoch_guard, так
+  // что адрес забранного узла не достанется новому, пока мы не ушли
+  bool tryHandOff(node *fresh) {
+    std::atomic<node *> &cell = elimination_[pick()].value;
+    node *empty = nullptr;
+    if (!cell.compare_exchange_strong(empty, fresh,
+                                      std::memory_order_release,
+                                      std::memory_order_relaxed)) {
+      return false;
+    }
+    for (unsigned i = 0; i < kEliminationSpins; ++i) {
+      if (cell.load(std::memory_order_relaxed) != fresh) return true;
+    }
+    // Забираем узел обратно. Неудача значит, что pop успел его взять
+    node *expected = fresh;
+    return !cell.compare_exchange_strong(expected, nullptr,
+                                         std::memory_order_relaxed);
+  }
+
+  // Забирает узел, оставленный встречным push, если он есть
+  node *tryTake() {
+    std::atomic<node *> &cell = elimination_[pick()].value;
+    node *offered = cell.load(std::memory_order_acquire);
+    if (offered && cell.compare_exchange_strong(offered, nullptr,
+                                                std::memory_order_acquire,
+                                                std::memory_order_relaxed)) {
+      return offered;
+    }
+    return nullptr;
+  }
+
+  static size_type pick() { return thread_random() % kEliminationSlots; }
+
+  padded_pointer head_;
+  padded_pointer elimination_[kEliminationSlots];
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_LOCKFREE_STACK_H_
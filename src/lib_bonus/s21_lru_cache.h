@@ -0,0 +1,298 @@
+#ifndef CPP2_S21_CONTAINERS_S21_LRU_CACHE_H_
+#define CPP2_S21_CONTAINERS_S21_LRU_CACHE_H_
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include "../lib/s21_list.h"
+#include "s21_unordered_map.h"
+
+namespace s21 {
+
+// Какую запись вытеснять, когда кэш заполнен
+enum class cache_policy {
+  lru,   // давно не использованную
+  slru,  // сегментированный LRU: сначала из испытательного сегмента
+  lfu    // реже всех использованную, среди равных - давнюю
+};
+
+// Кэш с ограниченной ёмкостью поверх s21::list и ассоциативного индекса.
+// Записи лежат в одном списке от самой ценной к жертве вытеснения, индекс
+// Index<K, iterator> (s21::unordered_map, s21::map, s21::btree_map или
+// любой словарь с таким же find/insert/erase) ведёт от ключа к узлу.
+// Продвижение записи - splice узла внутри списка: значения не копируются,
+// итераторы в индексе остаются действительными, get и put работают за O(1)
+// плюс поиск в индексе.
+//
+// Ёмкость считается в записях или, если задан weigher, в его единицах
+// (например, в байтах). put освобождает место, вытесняя записи с конца
+// списка; для каждой вытесненной записи вызывается on_evict. Обработчик не
+// должен менять сам кэш.
+//
+// Политики разбивают список на группы записей одного ранга, старшие
+// ранги ближе к началу, внутри группы свежие записи впереди:
+//   lru  - одна группа, попадание переносит запись в начало;
+//   slru - защищённый сегмент (ранг 1, до 80% ёмкости) и испытательный
+//          (ранг 0). Новая запись попадает в испытательный, повторное
+//          обращение переводит её в защищённый, переполнение защищённого
+//          возвращает его хвост в испытательный. Однократный проход по
+//          множеству ключей не вымывает часто используемые записи;
+//   lfu  - ранг - число обращений, попадание переводит запись в начало
+//          группы со следующим рангом.
+// Начало каждой группы хранится в отдельном словаре, поэтому переход
+// между группами тоже O(1).
+//
+//   s21::lru_cache<std::string, page> pages(64 << 20, page_bytes);
+//   if (page *hit = pages.get(url)) return *hit;
+//   pages.put(url, load(url));
+template <typename K, typename V, cache_policy Policy = cache_policy::lru,
+          template <typename...> class Index = unordered_map>
+class lru_cache {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using size_type = size_t;
+  using weigher_type =
+      std::function<size_type(const key_type &, const mapped_type &)>;
+  using evict_callback = std::function<void(const key_type &, mapped_type &)>;
+
+  struct stats {
+    size_type hits = 0;
+    size_type misses = 0;
+    size_type evictions = 0;
+  };
+
+  // Ёмкость в записях
+  explicit lru_cache(size_type capacity) : lru_cache(capacity, nullptr) {}
+
+  // Ёмкость в единицах weigher: каждая запись весит weigher(key, value)
+  lru_cache(size_type capacity, weigher_type weigher)
+      : capacity_(capacity),
+        protected_capacity_(capacity - capacity / 5),
+        weigher_(std::move(weigher)) {}
+
+  lru_cache(const lru_cache &) = delete;
+  lru_cache &operator=(const lru_cache &) = delete;
+
+  void on_evict(evict_callback callback) { on_evict_ = std::move(callback); }
+
+  // Значение по ключу с продвижением записи или nullptr. Указатель
+  // действителен до вытеснения или удаления записи
+  mapped_type *get(const key_type &key) {
+    auto found = index_.find(key);
+    if (found == index_.end()) {
+      ++stats_.misses;
+      return nullptr;
+    }
+    ++stats_.hits;
+    list_iterator it = found->second;
+    touch(it);
+    return &(*it).value;
+  }
+
+  // Значение без продвижения и без учёта в статистике
+  const mapped_type *peek(const key_type &key) const {
+    auto found = index_.find(key);
+    if (found == index_.end()) return nullptr;
+    return &(*found->second).value;
+  }
+
+  bool contains(const key_type &key) const {
+    return index_.find(key) != index_.end();
+  }
+
+  // Вставляет или заменяет значение. Запись тяжелее всей ёмкости не
+  // сохраняется (старое значение по ключу удаляется), put вернёт false
+  template <typename U>
+  bool put(const key_type &key, U &&value) {
+    size_type weight = weigher_ ? weigher_(key, value) : 1;
+    auto found = index_.find(key);
+    if (weight > capacity_) {
+      if (found != index_.end()) erase(key);
+      return false;
+    }
+    if (found != index_.end()) {
+      list_iterator it = found->second;
+      entry &item = *it;
+      item.value = std::forward<U>(value);
+      weight_ = weight_ - item.weight + weight;
+      if constexpr (Policy == cache_policy::slru) {
+        if (item.rank == kProtectedRank) {
+          protected_weight_ = protected_weight_ - item.weight + weight;
+        }
+      }
+      item.weight = weight;
+      touch(it);
+      // Потяжелевшая запись может переполнить защищённый сегмент
+      if constexpr (Policy == cache_policy::slru) demote();
+      evict(0, it);
+      return true;
+    }
+    evict(weight, entries_.end());
+    insert(key, std::forward<U>(value), weight);
+    return true;
+  }
+
+  // Удаляет запись без вызова on_evict
+  bool erase(const key_type &key) {
+    auto found = index_.find(key);
+    if (found == index_.end()) return false;
+    remove(found->second);
+    return true;
+  }
+
+  void clear() {
+    while (!entries_.empty()) remove(entries_.begin());
+  }
+
+  size_type size() const noexcept { return index_.size(); }
+  bool empty() const noexcept { return size() == 0; }
+  size_type capacity() const noexcept { return capacity_; }
+  // Суммарный вес записей; без weigher совпадает с size()
+  size_type weight() const noexcept { return weight_; }
+
+  stats statistics() const noexcept { return stats_; }
+  void reset_statistics() noexcept { stats_ = stats(); }
+
+ private:
+  struct entry {
+    key_type key;
+    mapped_type value;
+    size_type weight;
+    size_type rank;
+  };
+
+  using list_type = list<entry>;
+  using list_iterator = typename list_type::iterator;
+
+  // Ранг новой записи: испытательный сегмент slru, одно обращение lfu
+  static constexpr size_type kFirstRank = Policy == cache_policy::lfu ? 1 : 0;
+  static constexpr size_type kProtectedRank = 1;
+
+  template <typename U>
+  void insert(const key_type &key, U &&value, size_type weight) {
+    entries_.push_front(
+        entry{key, mapped_type(std::forward<U>(value)), weight, kFirstRank});
+    list_iterator it = entries_.begin();
+    try {
+      index_.insert(key, it);
+    } catch (...) {
+      entries_.pop_front();
+      throw;
+    }
+    weight_ += weight;
+    if constexpr (Policy != cache_policy::lru) {
+      auto head = heads_.find(kFirstRank);
+      if (head != heads_.end()) {
+        entries_.splice(head->second, entries_, it);
+      } else {
+        entries_.splice(entries_.end(), entries_, it);
+      }
+      heads_.insert_or_assign(kFirstRank, it);
+    }
+  }
+
+  // Продвигает запись после обращения
+  void touch(list_iterator it) {
+    if constexpr (Policy == cache_policy::lru) {
+      entries_.splice(entries_.begin(), entries_, it);
+    } else if constexpr (Policy == cache_policy::slru) {
+      bool promoted = (*it).rank != kProtectedRank;
+      regroup(it, kProtectedRank);
+      if (promoted) {
+        protected_weight_ += (*it).weight;
+        demote();
+      }
+    } else {
+      regroup(it, (*it).rank + 1);
+    }
+  }
+
+  // Переносит запись в начало группы rank. Отсутствующая группа rank
+  // появляется там, где стояла запись: выше её прежней группы
+  void regroup(list_iterator it, size_type rank) {
+    size_type old = (*it).rank;
+    bool was_head = heads_.find(old)->second == it;
+    leaveGroup(it);
+    auto head = heads_.find(rank);
+    if (head != heads_.end()) {
+      entries_.splice(head->second, entries_, it);
+    } else if (!was_head) {
+      entries_.splice(heads_.find(old)->second, entries_, it);
+    }
+    (*it).rank = rank;
+    heads_.insert_or_assign(rank, it);
+  }
+
+  // Отмечает, что запись покидает свою группу
+  void leaveGroup(list_iterator it) {
+    size_type rank = (*it).rank;
+    auto head = heads_.find(rank);
+    if (head->second != it) return;
+    list_iterator next = it.next();
+    if (next != entries_.end() && (*next).rank == rank) {
+      heads_.insert_or_assign(rank, next);
+    } else {
+      heads_.erase(rank);
+    }
+  }
+
+  // slru: хвост защищённого сегмента стоит прямо перед испытательным,
+  // поэтому понижение меняет только ранг и начало групп
+  void demote() {
+    while (protected_weight_ > protected_capacity_) {
+      auto probation = heads_.find(kFirstRank);
+      list_iterator tail = probation != heads_.end()
+                               ? probation->second.prev()
+                               : entries_.end().prev();
+      leaveGroup(tail);
+      (*tail).rank = kFirstRank;
+      heads_.insert_or_assign(kFirstRank, tail);
+      protected_weight_ -= (*tail).weight;
+    }
+  }
+
+  // Вытесняет записи с конца, пока не освободится место под weight.
+  // Запись keep (только что обновлённая) не вытесняется
+  void evict(size_type weight, list_iterator keep) {
+    while (weight_ + weight > capacity_ && !entries_.empty()) {
+      list_iterator victim = entries_.end().prev();
+      if (victim == keep) {
+        if (victim == entries_.begin()) break;
+        victim = victim.prev();
+      }
+      ++stats_.evictions;
+      if (on_evict_) on_evict_((*victim).key, (*victim).value);
+      remove(victim);
+    }
+  }
+
+  void remove(list_iterator it) {
+    if constexpr (Policy != cache_policy::lru) {
+      leaveGroup(it);
+      if (Policy == cache_policy::slru && (*it).rank == kProtectedRank) {
+        protected_weight_ -= (*it).weight;
+      }
+    }
+    weight_ -= (*it).weight;
+    index_.erase((*it).key);
+    entries_.erase(it);
+  }
+
+  size_type capacity_;
+  size_type protected_capacity_;
+  size_type weight_ = 0;
+  size_type protected_weight_ = 0;
+  weigher_type weigher_;
+  evict_callback on_evict_;
+  list_type entries_;
+  // s21::map ищет только неконстантными методами
+  mutable Index<key_type, list_iterator> index_;
+  // Первая (самая свежая) запись каждой группы
+  unordered_map<size_type, list_iterator> heads_;
+  stats stats_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_LRU_CACHE_H_
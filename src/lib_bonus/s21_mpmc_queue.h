@@ -0,0 +1,270 @@
+#ifndef CPP2_S21_CONTAINERS_S21_MPMC_QUEUE_H_
+#define CPP2_S21_CONTAINERS_S21_MPMC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_concurrency.h"
+
+namespace s21 {
+// Ограниченная lock-free очередь для многих производителей и потребителей
+// (кольцо ячеек с номерами последовательности, схема Д. Вьюкова).
+//
+// Ячейка с номером pos свободна для записи, когда её sequence == pos, и
+// готова к чтению, когда sequence == pos + 1. Производитель занимает
+// позицию CAS-ом enqueue_pos_, записывает значение и публикует его записью
+// sequence; потребитель так же занимает dequeue_pos_ и после чтения
+// переводит ячейку на следующий круг (pos + ёмкость). Производители и
+// потребители спорят только за свой счётчик, разные позиции не мешают друг
+// другу. Пакетные операции занимают сразу несколько подряд готовых ячеек
+// одним CAS-ом.
+//
+// Блокирующие push и pop повторяют попытку с нарастающим ожиданием
+// (s21::backoff). Перенос T не должен бросать исключений.
+template <typename T>
+class mpmc_queue {
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "mpmc_queue elements must be nothrow move constructible");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  // Ёмкость округляется вверх до степени двойки, не меньше 2
+  explicit mpmc_queue(size_type capacity)
+      : capacity_(roundUp(capacity)), mask_(capacity_ - 1) {
+    cells_ = new cell[capacity_];
+    for (size_type i = 0; i < capacity_; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+  ~mpmc_queue() {
+    size_type pos = dequeue_pos_.value.load(std::memory_order_relaxed);
+    size_type end = enqueue_pos_.value.load(std::memory_order_relaxed);
+    for (; pos != end; ++pos) cells_[pos & mask_].value()->~value_type();
+    delete[] cells_;
+  }
+
+  // PRODUCERS
+  bool try_push(const value_type &value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  // Возвращает false, если очередь полна
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    if constexpr (kBuildFirst<Args...>) {
+      value_type value(std::forward<Args>(args)...);
+      return try_emplace(std::move(value));
+    }
+    size_type pos = enqueue_pos_.value.load(std::memory_order_relaxed);
+    cell *target;
+    for (;;) {
+      target = &cells_[pos & mask_];
+      size_type sequence = target->sequence.load(std::memory_order_acquire);
+      auto lag = static_cast<std::intptr_t>(sequence - pos);
+      if (lag == 0) {
+        if (enqueue_pos_.value.compare_exchange_weak(
+                pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (lag < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos_.value.load(std::memory_order_relaxed);
+      }
+    }
+    new (target->storage) value_type(std::forward<Args>(args)...);
+    target->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Ждёт свободного места
+  void push(const value_type &value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    backoff wait;
+    if constexpr (kBuildFirst<Args...>) {
+      value_type value(std::forward<Args>(args)...);
+      while (!try_emplace(std::move(value))) wait.wait();
+    } else {
+      // Неудачная попытка не трогает аргументы, их можно передать снова
+      while (!try_emplace(std::forward<Args>(args)...)) wait.wait();
+    }
+  }
+
+  // Кладёт из [first, last) столько элементов, сколько подряд свободных
+  // ячеек удалось занять одним CAS-ом. Возвращает их число. Все занятые
+  // ячейки должны быть заполнены, поэтому одним CAS-ом кладётся только
+  // диапазон известной длины, копия элементов которого не бросает. Элементы
+  // однопроходного диапазона (istream_iterator) и элементы с бросающей
+  // копией кладутся по одному
+  template <typename InputIt>
+  size_type try_push_batch(InputIt first, InputIt last) {
+    using reference = typename std::iterator_traits<InputIt>::reference;
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (!std::is_nothrow_constructible_v<value_type, reference> ||
+                  !std::is_base_of_v<std::forward_iterator_tag, category>) {
+      size_type done = 0;
+      for (; first != last && try_emplace(*first); ++first) ++done;
+      return done;
+    } else {
+      size_type length = std::distance(first, last);
+      size_type wanted = length < capacity_ ? length : capacity_;
+      if (wanted == 0) return 0;
+      size_type pos = enqueue_pos_.value.load(std::memory_order_relaxed);
+      size_type count;
+      do {
+        count = claimable(pos, wanted, 0);
+        if (count == 0) return 0;
+      } while (!enqueue_pos_.value.compare_exchange_weak(
+          pos, pos + count, std::memory_order_relaxed));
+      for (size_type i = 0; i < count; ++i, ++first) {
+        cell *target = &cells_[(pos + i) & mask_];
+        new (target->storage) value_type(*first);
+        target->sequence.store(pos + i + 1, std::memory_order_release);
+      }
+      return count;
+    }
+  }
+
+  // CONSUMERS
+  // Возвращает false, если очередь пуста
+  bool try_pop(value_type &out) {
+    size_type pos = dequeue_pos_.value.load(std::memory_order_relaxed);
+    cell *source;
+    for (;;) {
+      source = &cells_[pos & mask_];
+      size_type sequence = source->sequence.load(std::memory_order_acquire);
+      auto lag = static_cast<std::intptr_t>(sequence - (pos + 1));
+      if (lag == 0) {
+        if (dequeue_pos_.value.compare_exchange_weak(
+                pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (lag < 0) {
+        return false;
+      } else {
+        pos = dequeue_pos_.value.load(std::memory_order_relaxed);
+      }
+    }
+    consume(source, pos, out);
+    return true;
+  }
+
+  // Ждёт элемента
+  value_type pop() {
+    value_type out;
+    backoff wait;
+    while (!try_pop(out)) wait.wait();
+    return out;
+  }
+
+  void pop(value_type &out) {
+    backoff wait;
+    while (!try_pop(out)) wait.wait();
+  }
+
+  // Забирает в out до max_count подряд готовых элементов одним CAS-ом.
+  // Возвращает их число
+  template <typename OutputIt>
+  size_type try_pop_batch(OutputIt out, size_type max_count) {
+    size_type wanted = max_count < capacity_ ? max_count : capacity_;
+    if (wanted == 0) return 0;
+    size_type pos = dequeue_pos_.value.load(std::memory_order_relaxed);
+    size_type count;
+    do {
+      count = claimable(pos, wanted, 1);
+      if (count == 0) return 0;
+    } while (!dequeue_pos_.value.compare_exchange_weak(
+        pos, pos + count, std::memory_order_relaxed));
+    for (size_type i = 0; i < count; ++i, ++out) {
+      consume(&cells_[(pos + i) & mask_], pos + i, *out);
+    }
+    return count;
+  }
+
+  // CAPACITY
+  // Моментальный снимок: при одновременных операциях может устареть
+  size_type size_approx() const noexcept {
+    size_type tail = enqueue_pos_.value.load(std::memory_order_acquire);
+    size_type head = dequeue_pos_.value.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  }
+  bool empty() const noexcept { return size_approx() == 0; }
+  size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  struct cell {
+    std::atomic<size_type> sequence;
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+
+    value_type *value() {
+      return std::launder(reinterpret_cast<value_type *>(storage));
+    }
+  };
+
+  // Если создание значения может бросить исключение, оно создаётся до
+  // захвата ячейки и затем переносится в неё: занятая, но не
+  // опубликованная ячейка остановила бы потребителей на этой позиции
+  // навсегда
+  template <typename... Args>
+  static constexpr bool kBuildFirst =
+      !std::is_nothrow_constructible_v<value_type, Args &&...>;
+
+  // Счётчик позиций в своей кэш-линии
+  struct alignas(kCacheLine) position {
+    std::atomic<size_type> value{0};
+  };
+
+  static size_type roundUp(size_type capacity) {
+    if (capacity == 0) {
+      throw std::invalid_argument("mpmc_queue capacity must be positive");
+    }
+    size_type rounded = 2;
+    while (rounded < capacity) rounded *= 2;
+    return rounded;
+  }
+
+  // Сколько ячеек начиная с pos (не больше wanted) готовы: для записи
+  // ready == 0, для чтения ready == 1
+  size_type claimable(size_type pos, size_type wanted, size_type ready) {
+    size_type count = 0;
+    while (count < wanted) {
+      size_type slot = pos + count;
+      size_type sequence =
+          cells_[slot & mask_].sequence.load(std::memory_order_acquire);
+      if (sequence != slot + ready) break;
+      ++count;
+    }
+    return count;
+  }
+
+  template <typename Out>
+  void consume(cell *source, size_type pos, Out &&out) {
+    value_type *value = source->value();
+    out = std::move(*value);
+    value->~value_type();
+    source->sequence.store(pos + capacity_, std::memory_order_release);
+  }
+
+  const size_type capacity_;
+  const size_type mask_;
+  cell *cells_;
+  position enqueue_pos_;
+  position dequeue_pos_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_MPMC_QUEUE_H_
@@ -4,44 +4,47 @@
 #include "../lib/s21_set.h"
 
 namespace s21 {
-template <typename K>
-class multiset : public set<K> {
+template <typename K, typename Compare = std::less<K>>
+class multiset : public set<K, Compare> {
  public:
   class MultisetConstIterator;
   class MultisetIterator;
-  using key_type = typename set<K>::key_type;
-  using value_type = typename set<K>::value_type;
+  using key_type = typename set<K, Compare>::key_type;
+  using value_type = typename set<K, Compare>::value_type;
   using size_type = size_t;
 
   using const_iterator = MultisetConstIterator;
   using iterator = MultisetIterator;
 
-  multiset() : set<K>(){};
+  multiset() : set<K, Compare>(){};
+  explicit multiset(const Compare &comp) : set<K, Compare>(comp){};
   multiset(std::initializer_list<value_type> const &items) {
     for (value_type i : items) insert(i);
   };
-  multiset(const multiset &s) : set<K>(s){};
-  multiset(multiset &&s) noexcept : set<K>(std::move(s)){};
+  multiset(const multiset &s) : set<K, Compare>(s){};
+  multiset(multiset &&s) noexcept : set<K, Compare>(std::move(s)){};
   ~multiset() = default;
 
   multiset &operator=(multiset &&s) noexcept {
-    set<K>::operator=(std::move(s));
+    set<K, Compare>::operator=(std::move(s));
     return *this;
   }
 
-  class MultisetConstIterator : public tree<K, K>::const_iterator {
+  class MultisetConstIterator : public tree<K, K, Compare>::const_iterator {
    public:
-    using tree<K, K>::const_iterator::current_;
+    using tree<K, K, Compare>::const_iterator::current_;
+    using tree<K, K, Compare>::const_iterator::operatorMinus;
+    using tree<K, K, Compare>::const_iterator::operatorPlus;
 
     MultisetConstIterator(const MultisetConstIterator &) = default;
 
     MultisetConstIterator(MultisetConstIterator &&) noexcept = default;
 
-    MultisetConstIterator(typename tree<K, K>::node *node_)
-        : tree<K, K>::const_iterator(node_){};
+    MultisetConstIterator(typename tree<K, K, Compare>::node *node_)
+        : tree<K, K, Compare>::const_iterator(node_){};
 
-    MultisetConstIterator(tree<K, K> *tree_)
-        : tree<K, K>::const_iterator(tree_){};
+    MultisetConstIterator(tree<K, K, Compare> *tree_)
+        : tree<K, K, Compare>::const_iterator(tree_){};
 
     ~MultisetConstIterator() = default;
 
@@ -58,100 +61,6 @@ class multiset : public set<K> {
       return current_->element_ ? current_->element_->first : value_type();
     }
 
-    typename tree<K, K>::node *max_range(typename tree<K, K>::node *tmp) {
-      while (tmp->left && tmp->left->element_->first == tmp->element_->first) {
-        tmp = tmp->left;
-      };
-      while (tmp->right && tmp->right->element_ &&
-             tmp->right->element_->first == tmp->element_->first) {
-        tmp = tmp->right;
-      }
-      return tmp;
-    }
-
-    typename tree<K, K>::node *min_range(typename tree<K, K>::node *tmp) {
-      while (tmp->parent && tmp->element_ &&
-             tmp->parent->element_->first == tmp->element_->first) {
-        tmp = tmp->parent;
-      }
-      return tmp;
-    }
-
-    void operatorPlus() {
-      typename tree<K, K>::node *tmp = current_;
-      if (!tmp->element_) {
-      } else if (tmp->left &&
-                 tmp->left->element_->first == tmp->element_->first) {
-        tmp = tmp->left;
-      } else if (tmp->right && tmp->right->element_ &&
-                 tmp->right->element_->first == tmp->element_->first) {
-        tmp = tmp->right;
-      } else if (current_->right) {
-        tmp = tmp->right;
-        typename tree<K, K>::node *tmp2 = tmp;
-        while (tmp2->right && tmp2->right->element_ &&
-               tmp2->element_->first == tmp2->right->element_->first)
-          tmp2 = tmp2->right;
-        if (tmp2->left) {
-          tmp = tmp2;
-          while (tmp->left) {
-            tmp = tmp->left;
-          }
-          while (tmp->parent->element_->first == tmp->element_->first) {
-            tmp = tmp->parent;
-          }
-        }
-      } else if (tmp->parent && tmp->parent->left == tmp &&
-                 tmp->parent->element_->first != tmp->element_->first) {
-        typename tree<K, K>::node *upper = tmp->parent;
-        while (upper->parent &&
-               upper->element_->first == upper->parent->element_->first) {
-          upper = upper->parent;
-          tmp = upper;
-        }
-      }
-      if (tmp == current_) {
-        while ((tmp->parent) && tmp->parent->right == tmp) {
-          tmp = tmp->parent;
-        }
-        if (tmp) {
-          while (tmp->parent &&
-                 tmp->parent->element_->first == tmp->element_->first)
-            tmp = tmp->parent;
-          if (tmp->parent) tmp = tmp->parent;
-          while (tmp->parent &&
-                 tmp->parent->element_->first == tmp->element_->first)
-            tmp = tmp->parent;
-        }
-      }
-      current_ = tmp ? tmp : current_;
-    }
-
-    void operatorMinus() {
-      typename tree<K, K>::node *tmp = current_;
-
-      typename tree<K, K>::node *last_element = max_range(tmp);
-      typename tree<K, K>::node *first_element = min_range(tmp);
-
-      if (tmp->parent && (!tmp->element_ || tmp->parent->element_->first ==
-                                                tmp->element_->first)) {
-        tmp = tmp->parent;
-      } else if (last_element->left) {
-        tmp = max_range(last_element->left);
-        while (tmp->right) {
-          tmp = tmp->right;
-        }
-      } else {
-        tmp = first_element;
-        while ((tmp->parent) && tmp->parent->left == tmp) {
-          tmp = tmp->parent;
-        }
-        tmp = min_range(tmp);
-        if (tmp) tmp = tmp->parent;
-      }
-      current_ = tmp ? tmp : current_;
-    }
-
     MultisetConstIterator operator++() {
       if (current_) {
         operatorPlus();
@@ -185,10 +94,11 @@ class multiset : public set<K> {
     using MultisetConstIterator::operatorPlus;
 
    public:
-    MultisetIterator(typename tree<K, K>::node *node_)
+    MultisetIterator(typename tree<K, K, Compare>::node *node_)
         : MultisetConstIterator(node_){};
 
-    MultisetIterator(tree<K, K> *tree_) : MultisetConstIterator(tree_){};
+    MultisetIterator(tree<K, K, Compare> *tree_)
+        : MultisetConstIterator(tree_){};
 
     ~MultisetIterator() = default;
 
@@ -231,12 +141,7 @@ class multiset : public set<K> {
 
   iterator begin() const {
     if (!this->root) throw std::out_of_range("tree does not exist");
-    auto tmp = this->findMin(this->root);
-    while (tmp->parent &&
-           tmp->parent->element_->first == tmp->element_->first) {
-      tmp = tmp->parent;
-    }
-    return iterator(tmp);
+    return iterator(this->findMin(this->root));
   }
 
   iterator end() const {
@@ -244,49 +149,42 @@ class multiset : public set<K> {
     return iterator(this->findMax(this->root));
   }
 
-  typename tree<K, K>::node *max_range(typename tree<K, K>::node *tmp) {
-    auto it = iterator(tmp);
-    return it.max_range(tmp);
-  }
-
-  typename tree<K, K>::node *min_range(typename tree<K, K>::node *tmp) {
-    auto it = iterator(tmp);
-    return it.min_range(tmp);
-  }
-
+  // Первый и последний дубликат ключа или end()
   iterator min_range(const K &key) {
-    auto tmp = tree<K, K>::search(key);
-    return tmp ? iterator(min_range(tmp)) : iterator(this->end());
-  }
-  iterator max_range(const K &key) {
-    auto tmp = tree<K, K>::search(key);
-    return tmp ? iterator(max_range(tmp)) : iterator(this->end());
+    return rangeBegin(tree<K, K, Compare>::search(key));
   }
+  iterator max_range(const K &key) { return findLast(key); }
 
   iterator upper_bound(const K &key) {
-    auto it = this->begin();
-    while (it != this->end() && *it <= key) {
-      it++;
-    }
-    return it;
+    return rangeBegin(tree<K, K, Compare>::upperNode(key, this->root));
+  }
+
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const Other &key) {
+    return rangeBegin(tree<K, K, Compare>::upperNode(key, this->root));
   }
 
   iterator lower_bound(const K &key) {
-    auto it = this->begin();
-    while (it != this->end() && *it < key) {
-      it++;
-    }
-    return it;
+    return rangeBegin(tree<K, K, Compare>::lowerNode(key, this->root));
   }
 
-  void erase(iterator pos) {
-    auto it = tree<K, K>::search(pos.GetNode()->element_->first);
-    tree<K, K>::erase(it);
+  // Поиск по ключу, сравнимому с K через прозрачный компаратор (std::less<>)
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const Other &key) {
+    return rangeBegin(tree<K, K, Compare>::lowerNode(key, this->root));
   }
 
-  iterator find(const K &key) {
-    auto tmp = tree<K, K>::search(key);
-    return tmp ? iterator(tmp) : this->end();
+  void erase(iterator pos) { tree<K, K, Compare>::erase(pos.GetNode()); }
+
+  // Годится любой из дубликатов; возвращается последний из них
+  iterator find(const K &key) { return findLast(key); }
+
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const Other &key) {
+    return findLast(key);
   }
 
   template <class... Args>
@@ -299,42 +197,36 @@ class multiset : public set<K> {
     return vec;
   }
 
-  std::pair<typename multiset<K>::iterator, bool> insert(
+  // Дубликат встаёт после всех равных ему ключей, как в std::multiset
+  std::pair<typename multiset<K, Compare>::iterator, bool> insert(
       const value_type &value) noexcept {
-    auto tmp = tree<K, K>::search(value);
-    typename tree<K, K>::node *node_new;
-    if (tmp) {
-      node_new = new typename tree<K, K>::node({value, value});
-      if (this->root->element_ &&
-          this->root->element_->first == tmp->element_->first) {
-        if (this->root->right && this->root->right->element_ &&
-            this->root->right->element_->first == tmp->element_->first) {
-          tmp = this->root->right;
+    auto tmp = tree<K, K, Compare>::search(value);
+    if (!tmp) {
+      tmp = tree<K, K, Compare>::add(value, value).first.GetNode();
+      return {typename multiset<K, Compare>::iterator(tmp), 0};
+    }
+    auto node_new = new typename tree<K, K, Compare>::node({value, value});
+    tmp = this->root;
+    while (true) {
+      if (tree<K, K, Compare>::compare(value, tmp->element_->first)) {
+        if (!tmp->left) {
+          tmp->left = node_new;
+          break;
         }
-        auto tmp2 = this->root;
-        node_new->right = tmp2;
-        tmp2->parent = node_new;
-        this->root = node_new;
+        tmp = tmp->left;
+      } else if (tmp->right && tmp->right->element_) {
+        tmp = tmp->right;
       } else {
-        if (tmp->parent) {
-          if (tmp->parent->left == tmp) {
-            tmp->parent->left = node_new;
-            node_new->parent = tmp->parent;
-            tmp->parent = node_new;
-            node_new->left = tmp;
-          } else if (tmp->parent->right == tmp) {
-            tmp->parent->right = node_new;
-            node_new->parent = tmp->parent;
-            tmp->parent = node_new;
-            node_new->right = tmp;
-          }
-        }
+        // Узел end() остаётся правее нового максимума
+        node_new->right = tmp->right;
+        if (node_new->right) node_new->right->parent = node_new;
+        tmp->right = node_new;
+        break;
       }
-      (*this->setCount())++;
-    } else {
-      tmp = tree<K, K>::add(value, value).first.GetNode();
     }
-    return {typename multiset<K>::iterator(tmp), 0};
+    node_new->parent = tmp;
+    (*this->setCount())++;
+    return {typename multiset<K, Compare>::iterator(node_new), 0};
   }
 
   std::pair<iterator, iterator> equal_range(const K &key) {
@@ -342,27 +234,47 @@ class multiset : public set<K> {
   }
 
   size_type count(const K &key) {
-    size_type c = 0;
-    auto tmp = this->min_range(key);
-    auto upper = this->max_range(key);
-    while (tmp != upper) {
-      tmp++;
-      c++;
-    }
-    return ++c;
+    return countChain(tree<K, K, Compare>::search(key));
+  }
+
+  template <typename Other, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type count(const Other &key) {
+    return countChain(tree<K, K, Compare>::findNode(key, this->root));
   }
 
   void merge(multiset &other) {
     if (!other.root || this->root == other.root) return;
 
-    auto it = other.begin();
-    while (it != other.end()) {
-      it = other.max_range(*it);
+    while (!other.empty()) {
+      auto it = other.begin();
       this->insert(*it);
       other.erase(it);
-      it++;
     }
   }
+
+ protected:
+  template <typename Key>
+  iterator findLast(const Key &key) {
+    if (!tree<K, K, Compare>::findNode(key, this->root)) return this->end();
+    return --rangeBegin(tree<K, K, Compare>::upperNode(key, this->root));
+  }
+
+  // Итератор на узел или end(), если узла нет
+  iterator rangeBegin(typename tree<K, K, Compare>::node *tmp) {
+    return tmp ? iterator(tmp) : this->end();
+  }
+
+  // Считает дубликаты, начиная с первого из них; для отсутствующего
+  // ключа - 0
+  size_type countChain(typename tree<K, K, Compare>::node *tmp) {
+    size_type c = 0;
+    for (auto it = rangeBegin(tmp); it != this->end(); ++it) {
+      if (!tree<K, K, Compare>::equivalent(it.GetNode(), tmp)) break;
+      c++;
+    }
+    return c;
+  }
 };
 }  // namespace s21
 
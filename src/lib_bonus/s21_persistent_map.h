@@ -0,0 +1,381 @@
+#ifndef CPP2_S21_CONTAINERS_S21_PERSISTENT_MAP_H_
+#define CPP2_S21_CONTAINERS_S21_PERSISTENT_MAP_H_
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "s21_epoch.h"
+
+namespace s21 {
+// Неизменяемый map на AVL-дереве. Каждая модификация возвращает новую
+// версию: копируется только путь от корня до изменённого узла (O(log n)
+// узлов), остальные поддеревья разделяются со старой версией через
+// счётчики ссылок. Старые версии остаются валидными, пока их кто-то держит;
+// копирование версии - это копирование указателя на корень.
+//
+// Итераторы однонаправленные и валидны, пока жива версия, из которой они
+// получены.
+template <typename K, typename V, typename Compare = std::less<K>>
+class persistent_map {
+ private:
+  struct node;
+  using node_ptr = std::shared_ptr<const node>;
+
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  // Обход по возрастанию ключей. Стек хранит узлы, в левое поддерево
+  // которых спустились и которые ещё не выданы
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = persistent_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    const_iterator() = default;
+
+    reference operator*() const { return path_.back()->value; }
+    pointer operator->() const { return &path_.back()->value; }
+
+    const_iterator &operator++() {
+      const node *n = path_.back();
+      path_.pop_back();
+      pushLeft(n->right.get());
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool operator==(const const_iterator &other) const {
+      return current() == other.current();
+    }
+    bool operator!=(const const_iterator &other) const {
+      return current() != other.current();
+    }
+
+   private:
+    friend class persistent_map;
+
+    const node *current() const {
+      return path_.empty() ? nullptr : path_.back();
+    }
+
+    void pushLeft(const node *n) {
+      for (; n; n = n->left.get()) path_.push_back(n);
+    }
+
+    std::vector<const node *> path_;
+  };
+
+  using iterator = const_iterator;
+
+  // CONSTRUCTORS
+  persistent_map() : persistent_map(key_compare()) {}
+
+  // Компаратор наследуют все версии, полученные из этой
+  explicit persistent_map(const key_compare &comp) : size_(0), comp_(comp) {}
+
+  persistent_map(std::initializer_list<value_type> const &items)
+      : persistent_map() {
+    for (const auto &item : items) {
+      bool inserted = false;
+      root_ = insertNode(root_, item.first, item.second, false, inserted);
+      size_ += inserted;
+    }
+  }
+
+  persistent_map(const persistent_map &other) = default;
+  persistent_map(persistent_map &&other) noexcept
+      : root_(std::move(other.root_)), size_(other.size_), comp_(other.comp_) {
+    other.size_ = 0;
+  }
+
+  persistent_map &operator=(const persistent_map &other) = default;
+  persistent_map &operator=(persistent_map &&other) noexcept {
+    root_ = std::move(other.root_);
+    size_ = other.size_;
+    comp_ = other.comp_;
+    other.size_ = 0;
+    return *this;
+  }
+
+  // DESTRUCTOR
+  ~persistent_map() = default;
+
+  // ELEMENT ACCESS
+  const V &at(const K &key) const {
+    const node *n = findNode(key);
+    if (!n) throw std::out_of_range("Key not found");
+    return n->value.second;
+  }
+
+  // ITERATORS
+  const_iterator begin() const {
+    const_iterator it;
+    it.pushLeft(root_.get());
+    return it;
+  }
+  const_iterator end() const { return const_iterator(); }
+
+  // LOOKUP
+  const_iterator find(const K &key) const {
+    const_iterator it = lower_bound(key);
+    if (it != end() && compare(key, it->first)) return end();
+    return it;
+  }
+
+  bool contains(const K &key) const { return findNode(key) != nullptr; }
+
+  size_type count(const K &key) const { return contains(key) ? 1 : 0; }
+
+  // Первый элемент с ключом не меньше key
+  const_iterator lower_bound(const K &key) const {
+    const_iterator it;
+    for (const node *n = root_.get(); n;) {
+      if (compare(n->value.first, key)) {
+        n = n->right.get();
+      } else {
+        it.path_.push_back(n);
+        n = n->left.get();
+      }
+    }
+    return it;
+  }
+
+  // Первый элемент с ключом больше key
+  const_iterator upper_bound(const K &key) const {
+    const_iterator it;
+    for (const node *n = root_.get(); n;) {
+      if (compare(key, n->value.first)) {
+        it.path_.push_back(n);
+        n = n->left.get();
+      } else {
+        n = n->right.get();
+      }
+    }
+    return it;
+  }
+
+  key_compare key_comp() const { return comp_; }
+
+  // CAPACITY
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(node);
+  }
+
+  // MODIFIERS
+  // Версия не меняется: методы возвращают новую версию, а текущая остаётся
+  // прежней. Если изменений нет, результат разделяет корень с текущей
+
+  [[nodiscard]] persistent_map insert(const value_type &value) const {
+    return insert(value.first, value.second);
+  }
+
+  [[nodiscard]] persistent_map insert(const K &key, const V &obj) const {
+    bool inserted = false;
+    node_ptr root = insertNode(root_, key, obj, false, inserted);
+    return persistent_map(std::move(root), size_ + inserted, comp_);
+  }
+
+  [[nodiscard]] persistent_map insert_or_assign(const K &key,
+                                                const V &obj) const {
+    bool inserted = false;
+    node_ptr root = insertNode(root_, key, obj, true, inserted);
+    return persistent_map(std::move(root), size_ + inserted, comp_);
+  }
+
+  [[nodiscard]] persistent_map erase(const K &key) const {
+    bool erased = false;
+    node_ptr root = eraseNode(root_, key, erased);
+    return persistent_map(std::move(root), size_ - erased, comp_);
+  }
+
+  [[nodiscard]] persistent_map clear() const { return persistent_map(comp_); }
+
+  void swap(persistent_map &other) noexcept {
+    root_.swap(other.root_);
+    std::swap(size_, other.size_);
+    std::swap(comp_, other.comp_);
+  }
+
+ private:
+  struct node {
+    node(const value_type &v, node_ptr l, node_ptr r)
+        : value(v),
+          left(std::move(l)),
+          right(std::move(r)),
+          height(1 + std::max(heightOf(left), heightOf(right))) {}
+
+    value_type value;
+    node_ptr left;
+    node_ptr right;
+    int height;
+  };
+
+  persistent_map(node_ptr root, size_type size, const key_compare &comp)
+      : root_(std::move(root)), size_(size), comp_(comp) {}
+
+  bool compare(const K &a, const K &b) const { return comp_(a, b); }
+
+  static int heightOf(const node_ptr &n) { return n ? n->height : 0; }
+
+  static node_ptr make(const value_type &v, node_ptr l, node_ptr r) {
+    return std::make_shared<const node>(v, std::move(l), std::move(r));
+  }
+
+  // Собирает узел из значения и поддеревьев, высоты которых отличаются не
+  // больше чем на 2, и восстанавливает AVL-баланс одним или двумя поворотами.
+  // Повороты тоже создают новые узлы: существующие узлы не меняются
+  static node_ptr balance(const value_type &v, node_ptr l, node_ptr r) {
+    int hl = heightOf(l), hr = heightOf(r);
+    if (hl > hr + 1) {
+      if (heightOf(l->left) >= heightOf(l->right)) {
+        return make(l->value, l->left, make(v, l->right, std::move(r)));
+      }
+      const node &lr = *l->right;
+      return make(lr.value, make(l->value, l->left, lr.left),
+                  make(v, lr.right, std::move(r)));
+    }
+    if (hr > hl + 1) {
+      if (heightOf(r->right) >= heightOf(r->left)) {
+        return make(r->value, make(v, std::move(l), r->left), r->right);
+      }
+      const node &rl = *r->left;
+      return make(rl.value, make(v, std::move(l), rl.left),
+                  make(r->value, rl.right, r->right));
+    }
+    return make(v, std::move(l), std::move(r));
+  }
+
+  node_ptr insertNode(const node_ptr &n, const K &key, const V &obj,
+                      bool assign, bool &inserted) const {
+    if (!n) {
+      inserted = true;
+      return make(value_type(key, obj), nullptr, nullptr);
+    }
+    if (compare(key, n->value.first)) {
+      node_ptr l = insertNode(n->left, key, obj, assign, inserted);
+      return l == n->left ? n : balance(n->value, std::move(l), n->right);
+    }
+    if (compare(n->value.first, key)) {
+      node_ptr r = insertNode(n->right, key, obj, assign, inserted);
+      return r == n->right ? n : balance(n->value, n->left, std::move(r));
+    }
+    if (!assign) return n;
+    return make(value_type(key, obj), n->left, n->right);
+  }
+
+  static node_ptr eraseMin(const node_ptr &n) {
+    if (!n->left) return n->right;
+    return balance(n->value, eraseMin(n->left), n->right);
+  }
+
+  node_ptr eraseNode(const node_ptr &n, const K &key, bool &erased) const {
+    if (!n) return n;
+    if (compare(key, n->value.first)) {
+      node_ptr l = eraseNode(n->left, key, erased);
+      return l == n->left ? n : balance(n->value, std::move(l), n->right);
+    }
+    if (compare(n->value.first, key)) {
+      node_ptr r = eraseNode(n->right, key, erased);
+      return r == n->right ? n : balance(n->value, n->left, std::move(r));
+    }
+    erased = true;
+    if (!n->left) return n->right;
+    if (!n->right) return n->left;
+    const node *successor = n->right.get();
+    while (successor->left) successor = successor->left.get();
+    return balance(successor->value, n->left, eraseMin(n->right));
+  }
+
+  const node *findNode(const K &key) const {
+    const node *n = root_.get();
+    while (n) {
+      if (compare(key, n->value.first)) {
+        n = n->left.get();
+      } else if (compare(n->value.first, key)) {
+        n = n->right.get();
+      } else {
+        break;
+      }
+    }
+    return n;
+  }
+
+  node_ptr root_;
+  size_type size_;
+  key_compare comp_;
+};
+
+// Ячейка с текущей версией неизменяемой структуры (например,
+// persistent_map). Публикация новой версии - один атомарный обмен
+// указателя, чтение не блокирует писателей. Снятая версия освобождается
+// через epoch_domain, когда её уже не может читать ни один поток.
+template <typename T>
+class atomic_version {
+ public:
+  explicit atomic_version(T initial = T())
+      : current_(new T(std::move(initial))) {}
+
+  atomic_version(const atomic_version &) = delete;
+  atomic_version &operator=(const atomic_version &) = delete;
+
+  ~atomic_version() { delete current_.load(); }
+
+  // Копия текущей версии; для persistent_map это копия указателя на корень
+  T load() const {
+    epoch_guard guard;
+    return *current_.load(std::memory_order_acquire);
+  }
+
+  void store(T next) {
+    epoch_guard guard;
+    const T *old = current_.exchange(new T(std::move(next)),
+                                     std::memory_order_acq_rel);
+    epoch_domain::instance().retire(const_cast<T *>(old));
+  }
+
+  // Публикует fn(текущая версия). Если другой писатель успел опубликовать
+  // свою версию, fn вызывается заново от неё, поэтому fn не должна иметь
+  // побочных эффектов
+  template <typename F>
+  T update(F &&fn) {
+    epoch_guard guard;
+    const T *old = current_.load(std::memory_order_acquire);
+    T *next = new T(fn(*old));
+    while (!current_.compare_exchange_weak(old, next,
+                                           std::memory_order_acq_rel)) {
+      *next = fn(*old);
+    }
+    epoch_domain::instance().retire(const_cast<T *>(old));
+    return *next;
+  }
+
+ private:
+  std::atomic<const T *> current_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_PERSISTENT_MAP_H_
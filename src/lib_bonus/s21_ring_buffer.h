@@ -0,0 +1,428 @@
+#ifndef CPP2_S21_CONTAINERS_S21_RING_BUFFER_H_
+#define CPP2_S21_CONTAINERS_S21_RING_BUFFER_H_
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Что делать с новым элементом, когда буфер заполнен
+enum class ring_policy {
+  overwrite,  // вытеснить самый старый элемент
+  reject      // не вставлять, push_back вернёт false
+};
+
+// Встроенная память для буфера с ёмкостью, известной при компиляции
+template <typename T, size_t Capacity>
+struct ring_buffer_slots {
+  alignas(T) unsigned char bytes[Capacity * sizeof(T)];
+};
+
+template <typename T>
+struct ring_buffer_slots<T, 0> {};
+
+// Кольцевой буфер фиксированной ёмкости. Ёмкость задаётся параметром
+// шаблона Capacity (память лежит внутри объекта) или, при Capacity == 0,
+// аргументом конструктора (память выделяется один раз). После создания
+// буфер не выделяет память: вставка в заполненный буфер по политике либо
+// вытесняет самый старый элемент, либо отклоняется.
+//
+// Индекс 0 - самый старый элемент. Для ёмкости-степени двойки позиция в
+// памяти вычисляется маской, иначе - одним условным вычитанием. Элементы
+// лежат не более чем двумя непрерывными кусками, которые возвращают
+// array_one и array_two, - их можно копировать целиком.
+template <typename T, size_t Capacity = 0>
+class ring_buffer {
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using size_type = size_t;
+  // Непрерывный кусок элементов: начало и длина
+  using array_range = std::pair<pointer, size_type>;
+  using const_array_range = std::pair<const_pointer, size_type>;
+
+ private:
+  // Куча отдаётся целиком, встроенная память требует переноса элементов
+  static constexpr bool kNothrowMove =
+      Capacity == 0 || std::is_nothrow_move_constructible_v<T>;
+
+  template <typename Value>
+  class basic_iterator {
+    using owner_type = std::conditional_t<std::is_const_v<Value>,
+                                          const ring_buffer, ring_buffer>;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value *;
+    using reference = Value &;
+
+    basic_iterator() : owner_(nullptr), index_(0) {}
+
+    template <typename Other, typename = std::enable_if_t<
+                                  std::is_same_v<const Other, Value>>>
+    basic_iterator(const basic_iterator<Other> &other)
+        : owner_(other.owner_), index_(other.index_) {}
+
+    reference operator*() const { return (*owner_)[index_]; }
+    pointer operator->() const { return &(*owner_)[index_]; }
+    reference operator[](difference_type n) const {
+      return (*owner_)[index_ + n];
+    }
+
+    basic_iterator &operator++() {
+      ++index_;
+      return *this;
+    }
+    basic_iterator operator++(int) {
+      basic_iterator tmp(*this);
+      ++index_;
+      return tmp;
+    }
+    basic_iterator &operator--() {
+      --index_;
+      return *this;
+    }
+    basic_iterator operator--(int) {
+      basic_iterator tmp(*this);
+      --index_;
+      return tmp;
+    }
+    basic_iterator &operator+=(difference_type n) {
+      index_ += n;
+      return *this;
+    }
+    basic_iterator &operator-=(difference_type n) {
+      index_ -= n;
+      return *this;
+    }
+    basic_iterator operator+(difference_type n) const {
+      return basic_iterator(owner_, index_ + n);
+    }
+    basic_iterator operator-(difference_type n) const {
+      return basic_iterator(owner_, index_ - n);
+    }
+    // Свободные друзья, чтобы iterator и const_iterator сравнивались между
+    // собой через неявное преобразование
+    friend difference_type operator-(const basic_iterator &a,
+                                     const basic_iterator &b) {
+      return static_cast<difference_type>(a.index_) -
+             static_cast<difference_type>(b.index_);
+    }
+    friend bool operator==(const basic_iterator &a, const basic_iterator &b) {
+      return a.index_ == b.index_ && a.owner_ == b.owner_;
+    }
+    friend bool operator!=(const basic_iterator &a, const basic_iterator &b) {
+      return !(a == b);
+    }
+    friend bool operator<(const basic_iterator &a, const basic_iterator &b) {
+      return a.index_ < b.index_;
+    }
+
+   private:
+    friend class ring_buffer;
+    template <typename Other>
+    friend class basic_iterator;
+
+    basic_iterator(owner_type *owner, size_type index)
+        : owner_(owner), index_(index) {}
+
+    owner_type *owner_;
+    size_type index_;
+  };
+
+ public:
+  // Итераторы хранят логический индекс: вытеснение старых элементов
+  // сдвигает их на следующий по возрасту элемент
+  using iterator = basic_iterator<value_type>;
+  using const_iterator = basic_iterator<const value_type>;
+
+  // CONSTRUCTORS
+  explicit ring_buffer(ring_policy policy = ring_policy::overwrite)
+      : ring_buffer(Capacity, policy) {
+    static_assert(Capacity != 0,
+                  "runtime-sized ring_buffer needs a capacity argument");
+  }
+
+  explicit ring_buffer(size_type capacity,
+                       ring_policy policy = ring_policy::overwrite)
+      : data_(nullptr),
+        capacity_(capacity),
+        mask_(maskFor(capacity)),
+        head_(0),
+        size_(0),
+        policy_(policy) {
+    if (capacity == 0) {
+      throw std::invalid_argument("ring_buffer capacity must be positive");
+    }
+    if constexpr (Capacity != 0) {
+      if (capacity != Capacity) {
+        throw std::invalid_argument("ring_buffer capacity is fixed");
+      }
+      data_ = reinterpret_cast<pointer>(inline_.bytes);
+    } else {
+      data_ = static_cast<pointer>(::operator new(
+          capacity * sizeof(value_type), std::align_val_t(alignof(T))));
+    }
+  }
+
+  ring_buffer(size_type capacity, std::initializer_list<value_type> items,
+              ring_policy policy = ring_policy::overwrite)
+      : ring_buffer(capacity, policy) {
+    for (const auto &item : items) push_back(item);
+  }
+
+  ring_buffer(const ring_buffer &other)
+      : ring_buffer(other.capacity_, other.policy_) {
+    for (size_type i = 0; i < other.size_; ++i) {
+      new (data_ + i) value_type(other[i]);
+      ++size_;
+    }
+  }
+
+  // Буфер в куче забирается без выделения памяти, перемещённый буфер
+  // остаётся пустым с нулевой ёмкостью и отклоняет вставки. Встроенный
+  // буфер переносит элементы и сохраняет ёмкость
+  ring_buffer(ring_buffer &&other) noexcept(kNothrowMove)
+      : data_(nullptr),
+        capacity_(Capacity),
+        mask_(maskFor(Capacity)),
+        head_(0),
+        size_(0),
+        policy_(other.policy_) {
+    if constexpr (Capacity == 0) {
+      swap(other);
+    } else {
+      data_ = reinterpret_cast<pointer>(inline_.bytes);
+      moveFrom(other);
+    }
+  }
+
+  // DESTRUCTOR
+  ~ring_buffer() {
+    clear();
+    if constexpr (Capacity == 0) {
+      ::operator delete(data_, std::align_val_t(alignof(T)));
+    }
+  }
+
+  ring_buffer &operator=(const ring_buffer &other) {
+    if (this != &other) {
+      ring_buffer copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  ring_buffer &operator=(ring_buffer &&other) noexcept(kNothrowMove) {
+    if (this != &other) {
+      ring_buffer moved(std::move(other));
+      swap(moved);
+    }
+    return *this;
+  }
+
+  // ELEMENT ACCESS
+  reference operator[](size_type index) noexcept {
+    return data_[slot(index)];
+  }
+  const_reference operator[](size_type index) const noexcept {
+    return data_[slot(index)];
+  }
+
+  reference at(size_type index) {
+    if (index >= size_) throw std::out_of_range("ring_buffer::at");
+    return data_[slot(index)];
+  }
+  const_reference at(size_type index) const {
+    if (index >= size_) throw std::out_of_range("ring_buffer::at");
+    return data_[slot(index)];
+  }
+
+  // Самый старый элемент
+  reference front() {
+    checkNotEmpty();
+    return data_[head_];
+  }
+  const_reference front() const {
+    checkNotEmpty();
+    return data_[head_];
+  }
+
+  // Самый новый элемент
+  reference back() {
+    checkNotEmpty();
+    return data_[slot(size_ - 1)];
+  }
+  const_reference back() const {
+    checkNotEmpty();
+    return data_[slot(size_ - 1)];
+  }
+
+  // Первый непрерывный кусок: от самого старого элемента до конца памяти
+  array_range array_one() noexcept {
+    return {data_ + head_, firstLength()};
+  }
+  const_array_range array_one() const noexcept {
+    return {data_ + head_, firstLength()};
+  }
+
+  // Продолжение с начала памяти; пустой, если элементы не переходят край
+  array_range array_two() noexcept { return {data_, size_ - firstLength()}; }
+  const_array_range array_two() const noexcept {
+    return {data_, size_ - firstLength()};
+  }
+
+  // Копирует элементы от старого к новому в out двумя вызовами std::copy
+  // и возвращает их число
+  template <typename OutputIt>
+  size_type copy_to(OutputIt out) const {
+    const_array_range one = array_one();
+    const_array_range two = array_two();
+    out = std::copy(one.first, one.first + one.second, out);
+    std::copy(two.first, two.first + two.second, out);
+    return size_;
+  }
+
+  // ITERATORS
+  iterator begin() noexcept { return iterator(this, 0); }
+  iterator end() noexcept { return iterator(this, size_); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator end() const noexcept { return const_iterator(this, size_); }
+
+  // CAPACITY
+  bool empty() const noexcept { return size_ == 0; }
+  bool full() const noexcept { return size_ == capacity_; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+  size_type max_size() const noexcept { return capacity_; }
+  ring_policy policy() const noexcept { return policy_; }
+
+  // MODIFIERS
+  void clear() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      for (size_type i = 0; i < size_; ++i) data_[slot(i)].~value_type();
+    }
+    head_ = 0;
+    size_ = 0;
+  }
+
+  // Возвращает false, если буфер заполнен и политика - reject, или если
+  // буфер перемещён и не имеет памяти
+  bool push_back(const value_type &value) { return emplace_back(value); }
+  bool push_back(value_type &&value) { return emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  bool emplace_back(Args &&...args) {
+    if (size_ < capacity_) {
+      new (data_ + slot(size_)) value_type(std::forward<Args>(args)...);
+      ++size_;
+      return true;
+    }
+    if (policy_ == ring_policy::reject || capacity_ == 0) return false;
+    // Значение создаётся до вытеснения, чтобы исключение не теряло элемент
+    value_type value(std::forward<Args>(args)...);
+    data_[head_] = std::move(value);
+    head_ = slot(1);
+    return true;
+  }
+
+  void pop_front() {
+    checkNotEmpty();
+    data_[head_].~value_type();
+    head_ = slot(1);
+    --size_;
+  }
+
+  // Удаляет n самых старых элементов, например после copy_to
+  void pop_front(size_type n) {
+    if (n > size_) throw std::out_of_range("ring_buffer::pop_front");
+    for (size_type i = 0; i < n; ++i) {
+      data_[head_].~value_type();
+      head_ = slot(1);
+    }
+    size_ -= n;
+  }
+
+  void pop_back() {
+    checkNotEmpty();
+    --size_;
+    data_[slot(size_)].~value_type();
+  }
+
+  void swap(ring_buffer &other) noexcept(kNothrowMove) {
+    if constexpr (Capacity == 0) {
+      std::swap(data_, other.data_);
+      std::swap(capacity_, other.capacity_);
+      std::swap(mask_, other.mask_);
+      std::swap(head_, other.head_);
+      std::swap(size_, other.size_);
+    } else {
+      ring_buffer tmp(std::move(other));
+      other.moveFrom(*this);
+      moveFrom(tmp);
+    }
+    std::swap(policy_, other.policy_);
+  }
+
+ private:
+  static constexpr bool kFixedPowerOfTwo =
+      Capacity != 0 && (Capacity & (Capacity - 1)) == 0;
+
+  // Позиция в памяти элемента с логическим индексом index. head_ + index
+  // меньше удвоенной ёмкости, поэтому без маски хватает одного вычитания
+  size_type slot(size_type index) const noexcept {
+    size_type position = head_ + index;
+    if constexpr (kFixedPowerOfTwo) {
+      return position & (Capacity - 1);
+    } else {
+      if (mask_ != 0) return position & mask_;
+      return position >= capacity_ ? position - capacity_ : position;
+    }
+  }
+
+  static size_type maskFor(size_type capacity) noexcept {
+    bool power_of_two = capacity != 0 && (capacity & (capacity - 1)) == 0;
+    return power_of_two ? capacity - 1 : 0;
+  }
+
+  size_type firstLength() const noexcept {
+    return std::min(size_, capacity_ - head_);
+  }
+
+  void checkNotEmpty() const {
+    if (size_ == 0) throw std::out_of_range("ring_buffer is empty");
+  }
+
+  // Переносит элементы source в этот пустой буфер, source становится пустым
+  void moveFrom(ring_buffer &source) {
+    clear();
+    for (size_type i = 0; i < source.size_; ++i) {
+      new (data_ + i) value_type(std::move(source[i]));
+      ++size_;
+    }
+    source.clear();
+  }
+
+  pointer data_;
+  size_type capacity_;
+  // capacity_ - 1 для ёмкости-степени двойки больше 1, иначе 0
+  size_type mask_;
+  size_type head_;
+  size_type size_;
+  ring_policy policy_;
+  ring_buffer_slots<T, Capacity> inline_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_RING_BUFFER_H_
@@ -0,0 +1,463 @@
+#ifndef CPP2_S21_CONTAINERS_S21_SKIPLIST_MAP_H_
+#define CPP2_S21_CONTAINERS_S21_SKIPLIST_MAP_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "s21_concurrency.h"
+#include "s21_epoch.h"
+
+namespace s21 {
+// Упорядоченный lock-free map на списке с пропусками. Узел связан в
+// несколько уровней ("башня"); вставка и удаление меняют связи через CAS,
+// поиск не блокирует и не пишет в память. Младший бит указателя next
+// помечает узел как удалённый на этом уровне: сначала помечаются верхние
+// уровни, нижний - последним, после чего узел логически удалён.
+// Физически узлы вырезает любой поток, встретивший пометку при поиске,
+// а память освобождается через epoch_domain.
+//
+// Итераторы - однонаправленные и хранят epoch_guard: пока итератор жив,
+// узел под ним не освобождается. Итератор нельзя передавать в другой поток.
+// Значения элементов после вставки не синхронизируются: их изменение при
+// параллельном чтении остаётся на стороне пользователя.
+template <typename K, typename V, typename Compare = std::less<K>>
+class skiplist_map {
+ private:
+  struct node;
+
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  static constexpr int kMaxLevel = 16;
+
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = skiplist_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    const_iterator() : node_(nullptr) {}
+
+    reference operator*() const { return node_->value; }
+    pointer operator->() const { return &node_->value; }
+
+    const_iterator &operator++() {
+      node_ = skiplist_map::nextLive(node_);
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool operator==(const const_iterator &other) const {
+      return node_ == other.node_;
+    }
+    bool operator!=(const const_iterator &other) const {
+      return node_ != other.node_;
+    }
+
+   protected:
+    friend class skiplist_map;
+    explicit const_iterator(node *n) : node_(n) {}
+
+    epoch_guard guard_;
+    node *node_;
+  };
+
+  class iterator : public const_iterator {
+   public:
+    using pointer = value_type *;
+    using reference = value_type &;
+
+    iterator() = default;
+
+    reference operator*() const { return this->node_->value; }
+    pointer operator->() const { return &this->node_->value; }
+
+    iterator &operator++() {
+      const_iterator::operator++();
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator tmp = *this;
+      const_iterator::operator++();
+      return tmp;
+    }
+
+   private:
+    friend class skiplist_map;
+    explicit iterator(node *n) : const_iterator(n) {}
+  };
+
+  // CONSTRUCTORS
+  skiplist_map() : skiplist_map(key_compare()) {}
+
+  explicit skiplist_map(const key_compare &comp) : size_(0), comp_(comp) {
+    for (int l = 0; l < kMaxLevel; ++l) head_[l].store(0);
+  }
+
+  skiplist_map(std::initializer_list<value_type> const &items)
+      : skiplist_map() {
+    for (const auto &item : items) insert(item);
+  }
+
+  skiplist_map(const skiplist_map &) = delete;
+  skiplist_map &operator=(const skiplist_map &) = delete;
+
+  // DESTRUCTOR
+  ~skiplist_map() { clear(); }
+
+  // ELEMENT ACCESS
+
+  // Вставляет V() при отсутствии ключа. Ссылка остаётся валидной, пока
+  // элемент не удалён
+  V &operator[](const K &key) { return emplace(key).first->second; }
+
+  V &at(const K &key) {
+    epoch_guard guard;
+    node *n = exact(key);
+    if (!n) throw std::out_of_range("Key not found");
+    return n->value.second;
+  }
+  const V &at(const K &key) const {
+    return const_cast<skiplist_map *>(this)->at(key);
+  }
+
+  // ITERATORS
+  iterator begin() {
+    epoch_guard guard;
+    return iterator(firstLive(ptr(head_[0].load(std::memory_order_acquire))));
+  }
+  const_iterator begin() const {
+    epoch_guard guard;
+    return const_iterator(
+        firstLive(ptr(head_[0].load(std::memory_order_acquire))));
+  }
+  iterator end() { return iterator(nullptr); }
+  const_iterator end() const { return const_iterator(nullptr); }
+
+  // LOOKUP
+  iterator find(const K &key) {
+    epoch_guard guard;
+    return iterator(exact(key));
+  }
+  const_iterator find(const K &key) const {
+    epoch_guard guard;
+    return const_iterator(exact(key));
+  }
+
+  bool contains(const K &key) const {
+    epoch_guard guard;
+    return exact(key) != nullptr;
+  }
+
+  size_type count(const K &key) const { return contains(key) ? 1 : 0; }
+
+  // Первый элемент с ключом не меньше key
+  iterator lower_bound(const K &key) {
+    epoch_guard guard;
+    return iterator(lowerNode(key));
+  }
+  const_iterator lower_bound(const K &key) const {
+    epoch_guard guard;
+    return const_iterator(lowerNode(key));
+  }
+
+  // Первый элемент с ключом больше key
+  iterator upper_bound(const K &key) {
+    epoch_guard guard;
+    return iterator(upperNode(key));
+  }
+  const_iterator upper_bound(const K &key) const {
+    epoch_guard guard;
+    return const_iterator(upperNode(key));
+  }
+
+  key_compare key_comp() const { return comp_; }
+
+  // CAPACITY
+
+  // Счётчик элементов; при параллельных изменениях - приблизительный
+  size_type size() const { return size_.load(std::memory_order_relaxed); }
+  bool empty() const { return size() == 0; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() /
+           (sizeof(node) + sizeof(link_type));
+  }
+
+  // MODIFIERS
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return emplace(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(const K &key, const V &obj) {
+    return emplace(key, obj);
+  }
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    std::vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(args));
+    (result.push_back(insert(std::forward<Args>(args))), ...);
+    return result;
+  }
+
+  // Удаляет элемент с ключом key. Возвращает число удалённых (0 или 1);
+  // при гонке двух удалений одного ключа успех получает ровно одно
+  size_type erase(const K &key) {
+    epoch_guard guard;
+    node *preds[kMaxLevel];
+    node *succs[kMaxLevel];
+    if (!search(key, preds, succs)) return 0;
+    node *victim = succs[0];
+    for (int l = victim->levels - 1; l > 0; --l) {
+      uintptr_t next = victim->links()[l].load(std::memory_order_acquire);
+      while (!marked(next) &&
+             !victim->links()[l].compare_exchange_weak(next, next | 1)) {
+      }
+    }
+    uintptr_t next = victim->links()[0].load(std::memory_order_acquire);
+    while (true) {
+      if (marked(next)) return 0;
+      if (victim->links()[0].compare_exchange_weak(next, next | 1)) break;
+    }
+    size_.fetch_sub(1, std::memory_order_relaxed);
+    // Если вставка ещё достраивает башню, освобождение делегируется ей
+    if (victim->state.exchange(kErased) == kLinked) {
+      search(key, preds, succs);
+      epoch_domain::instance().retire(victim, &destroy);
+    }
+    return 1;
+  }
+
+  void erase(iterator pos) {
+    if (pos.node_) erase(pos.node_->value.first);
+  }
+
+  // Не потокобезопасна: удаляет все узлы сразу
+  void clear() {
+    node *curr = ptr(head_[0].load(std::memory_order_acquire));
+    while (curr) {
+      node *next = ptr(curr->links()[0].load(std::memory_order_relaxed));
+      destroy(curr);
+      curr = next;
+    }
+    for (int l = 0; l < kMaxLevel; ++l) head_[l].store(0);
+    size_.store(0);
+  }
+
+ private:
+  using link_type = std::atomic<uintptr_t>;
+
+  // Состояние башни: вставка и удаление договариваются, кто освободит узел
+  enum tower_state : int { kLinking, kLinked, kErased };
+
+  // Ссылки уровней лежат сразу за узлом в той же аллокации
+  struct alignas(link_type) node {
+    template <typename... Args>
+    node(int height, Args &&...args)
+        : value(std::forward<Args>(args)...), levels(height), state(kLinking) {}
+
+    link_type *links() { return reinterpret_cast<link_type *>(this + 1); }
+
+    value_type value;
+    int levels;
+    std::atomic<int> state;
+  };
+
+  static node *ptr(uintptr_t link) {
+    return reinterpret_cast<node *>(link & ~uintptr_t(1));
+  }
+  static bool marked(uintptr_t link) { return link & 1; }
+  static uintptr_t pack(node *n) { return reinterpret_cast<uintptr_t>(n); }
+
+  template <typename... Args>
+  static node *create(int height, Args &&...args) {
+    void *memory = ::operator new(sizeof(node) + height * sizeof(link_type));
+    node *n = new (memory) node(height, std::forward<Args>(args)...);
+    for (int l = 0; l < height; ++l) new (n->links() + l) link_type(0);
+    return n;
+  }
+
+  static void destroy(void *memory) {
+    node *n = static_cast<node *>(memory);
+    for (int l = 0; l < n->levels; ++l) n->links()[l].~link_type();
+    n->~node();
+    ::operator delete(memory);
+  }
+
+  // Высота башни: уровень выше с вероятностью 1/4
+  static int randomLevel() {
+    int level = 1;
+    uint64_t bits = thread_random();
+    while (level < kMaxLevel && (bits & 3) == 0) {
+      ++level;
+      bits >>= 2;
+    }
+    return level;
+  }
+
+  bool compare(const K &a, const K &b) const { return comp_(a, b); }
+
+  link_type &link(node *pred, int level) {
+    return pred ? pred->links()[level] : head_[level];
+  }
+
+  // Первый не удалённый узел начиная с n
+  static node *firstLive(node *n) {
+    while (n && marked(n->links()[0].load(std::memory_order_acquire))) {
+      n = ptr(n->links()[0].load(std::memory_order_acquire));
+    }
+    return n;
+  }
+
+  static node *nextLive(node *n) {
+    return firstLive(ptr(n->links()[0].load(std::memory_order_acquire)));
+  }
+
+  // Поиск с вырезанием помеченных узлов. Заполняет для каждого уровня
+  // последний узел с ключом меньше key (nullptr - голова) и следующий за
+  // ним. Возвращает true, если succs[0] содержит key
+  bool search(const K &key, node **preds, node **succs) {
+    bool restart = true;
+    while (restart) {
+      restart = false;
+      node *pred = nullptr;
+      for (int l = kMaxLevel - 1; l >= 0 && !restart; --l) {
+        node *curr = ptr(link(pred, l).load(std::memory_order_acquire));
+        while (curr) {
+          uintptr_t succ = curr->links()[l].load(std::memory_order_acquire);
+          if (marked(succ)) {
+            uintptr_t expected = pack(curr);
+            if (!link(pred, l).compare_exchange_strong(expected,
+                                                       pack(ptr(succ)))) {
+              restart = true;
+              break;
+            }
+            curr = ptr(succ);
+          } else if (compare(curr->value.first, key)) {
+            pred = curr;
+            curr = ptr(succ);
+          } else {
+            break;
+          }
+        }
+        preds[l] = pred;
+        succs[l] = curr;
+      }
+    }
+    return succs[0] && !compare(key, succs[0]->value.first);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(const K &key, Args &&...args) {
+    epoch_guard guard;
+    node *preds[kMaxLevel];
+    node *succs[kMaxLevel];
+    node *fresh = nullptr;
+    while (true) {
+      if (search(key, preds, succs)) {
+        if (fresh) destroy(fresh);
+        return {iterator(succs[0]), false};
+      }
+      if (!fresh) {
+        fresh = create(randomLevel(), std::piecewise_construct,
+                       std::forward_as_tuple(key),
+                       std::forward_as_tuple(std::forward<Args>(args)...));
+      }
+      for (int l = 0; l < fresh->levels; ++l) {
+        fresh->links()[l].store(pack(succs[l]), std::memory_order_relaxed);
+      }
+      uintptr_t expected = pack(succs[0]);
+      if (link(preds[0], 0).compare_exchange_strong(expected, pack(fresh))) {
+        break;
+      }
+    }
+    size_.fetch_add(1, std::memory_order_relaxed);
+    linkTower(fresh, preds, succs);
+    return {iterator(fresh), true};
+  }
+
+  // Достраивает верхние уровни башни. Если узел тем временем удалили,
+  // останавливается, а освобождение берёт на себя тот, кто закончит вторым
+  void linkTower(node *fresh, node **preds, node **succs) {
+    const K &key = fresh->value.first;
+    for (int l = 1; l < fresh->levels; ++l) {
+      bool linked = false;
+      while (!linked) {
+        uintptr_t next = fresh->links()[l].load(std::memory_order_acquire);
+        if (marked(next)) break;
+        if (ptr(next) != succs[l] &&
+            !fresh->links()[l].compare_exchange_strong(next, pack(succs[l]))) {
+          break;
+        }
+        uintptr_t expected = pack(succs[l]);
+        linked = link(preds[l], l).compare_exchange_strong(expected,
+                                                           pack(fresh));
+        if (!linked && (!search(key, preds, succs) || succs[0] != fresh)) {
+          break;
+        }
+      }
+      if (!linked) break;
+    }
+    if (fresh->state.exchange(kLinked) == kErased) {
+      search(key, preds, succs);
+      epoch_domain::instance().retire(fresh, &destroy);
+    }
+  }
+
+  // Поиск только для чтения: помеченные узлы пропускаются без записи
+  node *lowerNode(const K &key) const {
+    const link_type *links = head_;
+    node *curr = nullptr;
+    for (int l = kMaxLevel - 1; l >= 0; --l) {
+      curr = ptr(links[l].load(std::memory_order_acquire));
+      while (curr) {
+        uintptr_t succ = curr->links()[l].load(std::memory_order_acquire);
+        if (!marked(succ) && !compare(curr->value.first, key)) break;
+        if (!marked(succ)) links = curr->links();
+        curr = ptr(succ);
+      }
+    }
+    return curr;
+  }
+
+  node *exact(const K &key) const {
+    node *n = lowerNode(key);
+    return n && !compare(key, n->value.first) ? n : nullptr;
+  }
+
+  node *upperNode(const K &key) const {
+    node *n = lowerNode(key);
+    return n && !compare(key, n->value.first) ? nextLive(n) : n;
+  }
+
+  mutable link_type head_[kMaxLevel];
+  std::atomic<size_type> size_;
+  // Только читается, поэтому потоки вызывают его без синхронизации
+  key_compare comp_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_SKIPLIST_MAP_H_
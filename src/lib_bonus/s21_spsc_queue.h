@@ -0,0 +1,191 @@
+#ifndef CPP2_S21_CONTAINERS_S21_SPSC_QUEUE_H_
+#define CPP2_S21_CONTAINERS_S21_SPSC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_concurrency.h"
+
+namespace s21 {
+// Ограниченная очередь для одного потока-производителя и одного
+// потока-потребителя на кольцевом буфере. Все операции wait-free: без
+// блокировок и повторов, каждая делает конечное число шагов.
+//
+// tail_ пишет только производитель, head_ - только потребитель; счётчики
+// растут неограниченно, позиция в буфере берётся маской. Каждая сторона
+// держит в своей кэш-линии копию чужого индекса и перечитывает его, только
+// когда по копии очередь выглядит полной (пустой), - так в обычном режиме
+// стороны не трогают кэш-линии друг друга. Пакетные варианты публикуют
+// индекс один раз на весь пакет.
+//
+// try_push* вызывает только производитель, try_pop* - только потребитель.
+template <typename T>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  // Ёмкость округляется вверх до степени двойки
+  explicit spsc_queue(size_type capacity)
+      : capacity_(roundUp(capacity)), mask_(capacity_ - 1) {
+    slots_ = static_cast<value_type *>(::operator new(
+        capacity_ * sizeof(value_type), std::align_val_t(alignof(T))));
+  }
+
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+
+  ~spsc_queue() {
+    size_type head = consumer_.head.load(std::memory_order_relaxed);
+    size_type tail = producer_.tail.load(std::memory_order_relaxed);
+    for (; head != tail; ++head) slots_[head & mask_].~value_type();
+    ::operator delete(slots_, std::align_val_t(alignof(T)));
+  }
+
+  // PRODUCER
+  bool try_push(const value_type &value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  // Возвращает false, если очередь полна
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    size_type tail = producer_.tail.load(std::memory_order_relaxed);
+    if (freeSlots(tail, 1) == 0) return false;
+    new (slots_ + (tail & mask_)) value_type(std::forward<Args>(args)...);
+    producer_.tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Кладёт элементы из [first, last), сколько поместится, и публикует их
+  // одной записью tail_. Возвращает число положенных элементов
+  template <typename InputIt>
+  size_type try_push_batch(InputIt first, InputIt last) {
+    size_type tail = producer_.tail.load(std::memory_order_relaxed);
+    size_type wanted = capacity_;
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      size_type length = std::distance(first, last);
+      wanted = length < capacity_ ? length : capacity_;
+    }
+    size_type room = freeSlots(tail, wanted);
+    size_type count = 0;
+    try {
+      for (; count < room && first != last; ++count, ++first) {
+        new (slots_ + ((tail + count) & mask_)) value_type(*first);
+      }
+    } catch (...) {
+      // Уже созданные элементы публикуются, чтобы их не потерять
+      producer_.tail.store(tail + count, std::memory_order_release);
+      throw;
+    }
+    if (count != 0) {
+      producer_.tail.store(tail + count, std::memory_order_release);
+    }
+    return count;
+  }
+
+  // CONSUMER
+  // Возвращает false, если очередь пуста
+  bool try_pop(value_type &out) {
+    size_type head = consumer_.head.load(std::memory_order_relaxed);
+    if (readySlots(head, 1) == 0) return false;
+    value_type &slot = slots_[head & mask_];
+    out = std::move(slot);
+    slot.~value_type();
+    consumer_.head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Забирает до max_count элементов в out и освобождает их одной записью
+  // head_. Возвращает число забранных элементов
+  template <typename OutputIt>
+  size_type try_pop_batch(OutputIt out, size_type max_count) {
+    size_type head = consumer_.head.load(std::memory_order_relaxed);
+    size_type ready = readySlots(head, max_count);
+    size_type count = ready < max_count ? ready : max_count;
+    size_type i = 0;
+    try {
+      for (; i < count; ++i, ++out) {
+        value_type &slot = slots_[(head + i) & mask_];
+        *out = std::move(slot);
+        slot.~value_type();
+      }
+    } catch (...) {
+      // Разрушенные слоты освобождаются, элемент, на котором бросило,
+      // остаётся в очереди
+      consumer_.head.store(head + i, std::memory_order_release);
+      throw;
+    }
+    if (count != 0) {
+      consumer_.head.store(head + count, std::memory_order_release);
+    }
+    return count;
+  }
+
+  // CAPACITY
+  // Точны только из потока производителя или потребителя при
+  // остановленной второй стороне, иначе - моментальный снимок
+  size_type size_approx() const noexcept {
+    size_type tail = producer_.tail.load(std::memory_order_acquire);
+    size_type head = consumer_.head.load(std::memory_order_acquire);
+    return tail - head;
+  }
+  bool empty() const noexcept { return size_approx() == 0; }
+  size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  static size_type roundUp(size_type capacity) {
+    if (capacity == 0) {
+      throw std::invalid_argument("spsc_queue capacity must be positive");
+    }
+    size_type rounded = 1;
+    while (rounded < capacity) rounded *= 2;
+    return rounded;
+  }
+
+  // Свободное место с точки зрения производителя. head_ перечитывается,
+  // только если по закэшированному значению места меньше wanted
+  size_type freeSlots(size_type tail, size_type wanted) {
+    size_type room = capacity_ - (tail - producer_.cached_head);
+    if (room < wanted) {
+      producer_.cached_head = consumer_.head.load(std::memory_order_acquire);
+      room = capacity_ - (tail - producer_.cached_head);
+    }
+    return room;
+  }
+
+  // Готовые элементы с точки зрения потребителя
+  size_type readySlots(size_type head, size_type wanted) {
+    size_type ready = consumer_.cached_tail - head;
+    if (ready < wanted) {
+      consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+      ready = consumer_.cached_tail - head;
+    }
+    return ready;
+  }
+
+  // Данные каждой стороны занимают свою кэш-линию
+  struct alignas(kCacheLine) producer_side {
+    std::atomic<size_type> tail{0};
+    size_type cached_head = 0;
+  };
+
+  struct alignas(kCacheLine) consumer_side {
+    std::atomic<size_type> head{0};
+    size_type cached_tail = 0;
+  };
+
+  const size_type capacity_;
+  const size_type mask_;
+  value_type *slots_;
+  producer_side producer_;
+  consumer_side consumer_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_SPSC_QUEUE_H_
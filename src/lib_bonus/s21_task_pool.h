@@ -0,0 +1,240 @@
+#ifndef CPP2_S21_CONTAINERS_S21_TASK_POOL_H_
+#define CPP2_S21_CONTAINERS_S21_TASK_POOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../lib/s21_deque.h"
+#include "s21_concurrency.h"
+#include "s21_ws_deque.h"
+
+namespace s21 {
+class task_pool;
+
+// Группа задач для fork-join: spawn запускает задачу в пуле, sync ждёт
+// завершения всех задач группы. Ожидающий поток не спит, а сам выполняет
+// задачи пула, поэтому вложенные группы (задача, порождающая задачи) не
+// занимают потоки ожиданием. Первое исключение из задач группы
+// перебрасывается из sync.
+class task_group {
+ public:
+  explicit task_group(task_pool &pool) : pool_(pool) {}
+
+  task_group(const task_group &) = delete;
+  task_group &operator=(const task_group &) = delete;
+
+  // Группа должна дождаться своих задач: они ссылаются на неё
+  ~task_group() { wait(); }
+
+  template <typename F>
+  void spawn(F &&f);
+
+  // Ждёт все задачи группы и перебрасывает первое исключение из них
+  void sync() {
+    wait();
+    std::exception_ptr error;
+    {
+      std::lock_guard<std::mutex> guard(error_lock_);
+      std::swap(error, error_);
+    }
+    if (error) std::rethrow_exception(error);
+  }
+
+ private:
+  friend class task_pool;
+
+  void wait();
+
+  void fail(std::exception_ptr error) {
+    std::lock_guard<std::mutex> guard(error_lock_);
+    if (!error_) error_ = std::move(error);
+  }
+
+  task_pool &pool_;
+  std::atomic<size_t> pending_{0};
+  std::mutex error_lock_;
+  std::exception_ptr error_;
+};
+
+// Пул потоков с кражей работы. У каждого рабочего потока свой ws_deque:
+// задачи, порождённые в рабочем потоке, кладутся в его дек и снимаются
+// оттуда в обратном порядке (последняя порождённая - самая «горячая» в
+// кэше), а простаивающие потоки крадут самые старые задачи у случайной
+// жертвы - обычно это крупные куски работы. Задачи из посторонних потоков
+// попадают в общую очередь под мьютексом.
+//
+// Без работы поток ждёт с нарастанием (s21::backoff): короткое вращение,
+// уступка процессора, затем сон до 1 мс.
+class task_pool {
+ public:
+  using size_type = size_t;
+
+  // По умолчанию - по потоку на ядро
+  explicit task_pool(size_type workers = std::thread::hardware_concurrency())
+      : queues_(std::max<size_type>(workers, 1)) {
+    for (auto &queue : queues_) queue = std::make_unique<ws_deque<task *>>();
+    threads_.reserve(queues_.size());
+    for (size_type i = 0; i < queues_.size(); ++i) {
+      threads_.emplace_back([this, i] { work(i); });
+    }
+  }
+
+  task_pool(const task_pool &) = delete;
+  task_pool &operator=(const task_pool &) = delete;
+
+  // Все группы к этому моменту должны дождаться своих задач
+  ~task_pool() {
+    stop_.store(true, std::memory_order_release);
+    for (auto &thread : threads_) thread.join();
+  }
+
+  size_type size() const noexcept { return queues_.size(); }
+
+  // Выполняет функции параллельно и возвращается, когда все завершатся
+  template <typename F, typename... Rest>
+  void parallel_invoke(F &&f, Rest &&...rest) {
+    task_group group(*this);
+    (group.spawn(std::forward<Rest>(rest)), ...);
+    try {
+      std::forward<F>(f)();
+    } catch (...) {
+      group.fail(std::current_exception());
+    }
+    group.sync();
+  }
+
+ private:
+  friend class task_group;
+
+  struct task {
+    explicit task(task_group &owner) : group(owner) {}
+    virtual ~task() = default;
+    virtual void run() = 0;
+
+    task_group &group;
+  };
+
+  template <typename F>
+  struct task_impl : task {
+    template <typename G>
+    task_impl(task_group &owner, G &&f) : task(owner), fn(std::forward<G>(f)) {}
+    void run() override { fn(); }
+
+    F fn;
+  };
+
+  // Рабочий поток, в котором выполняется код, и его пул
+  struct worker_slot {
+    task_pool *pool = nullptr;
+    size_type index = 0;
+  };
+
+  static worker_slot &current() {
+    static thread_local worker_slot slot;
+    return slot;
+  }
+
+  void submit(task *job) {
+    worker_slot &self = current();
+    if (self.pool == this) {
+      queues_[self.index]->push(job);
+      return;
+    }
+    std::lock_guard<std::mutex> guard(injected_lock_);
+    injected_.push_back(job);
+    injected_count_.fetch_add(1, std::memory_order_release);
+  }
+
+  // Выполняет задачу и отмечает её завершение в группе
+  static void execute(task *job) {
+    task_group &group = job->group;
+    try {
+      job->run();
+    } catch (...) {
+      group.fail(std::current_exception());
+    }
+    delete job;
+    group.pending_.fetch_sub(1, std::memory_order_acq_rel);
+  }
+
+  // Свой дек, затем общая очередь, затем кража у случайных жертв
+  task *find() {
+    worker_slot &self = current();
+    bool inside = self.pool == this;
+    if (inside) {
+      if (auto job = queues_[self.index]->take()) return *job;
+    }
+    if (injected_count_.load(std::memory_order_acquire) != 0) {
+      std::lock_guard<std::mutex> guard(injected_lock_);
+      if (!injected_.empty()) {
+        task *job = injected_.front();
+        injected_.pop_front();
+        injected_count_.fetch_sub(1, std::memory_order_relaxed);
+        return job;
+      }
+    }
+    size_type count = queues_.size();
+    for (size_type attempt = 0; attempt < count; ++attempt) {
+      size_type victim = thread_random() % count;
+      if (inside && victim == self.index) continue;
+      if (auto job = queues_[victim]->steal()) return *job;
+    }
+    return nullptr;
+  }
+
+  // Выполняет одну задачу, если нашлась
+  bool runOne() {
+    task *job = find();
+    if (!job) return false;
+    execute(job);
+    return true;
+  }
+
+  void work(size_type index) {
+    current() = worker_slot{this, index};
+    backoff idle;
+    while (!stop_.load(std::memory_order_acquire)) {
+      if (runOne()) {
+        idle.reset();
+      } else {
+        idle.wait();
+      }
+    }
+  }
+
+  std::vector<std::unique_ptr<ws_deque<task *>>> queues_;
+  std::vector<std::thread> threads_;
+  std::atomic<bool> stop_{false};
+  std::mutex injected_lock_;
+  deque<task *> injected_;
+  std::atomic<size_type> injected_count_{0};
+};
+
+template <typename F>
+void task_group::spawn(F &&f) {
+  using job_type = task_pool::task_impl<std::decay_t<F>>;
+  auto *job = new job_type(*this, std::forward<F>(f));
+  pending_.fetch_add(1, std::memory_order_relaxed);
+  pool_.submit(job);
+}
+
+inline void task_group::wait() {
+  backoff idle;
+  while (pending_.load(std::memory_order_acquire) != 0) {
+    if (pool_.runOne()) {
+      idle.reset();
+    } else {
+      idle.wait();
+    }
+  }
+}
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_TASK_POOL_H_
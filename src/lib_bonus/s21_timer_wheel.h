@@ -0,0 +1,268 @@
+#ifndef CPP2_S21_CONTAINERS_S21_TIMER_WHEEL_H_
+#define CPP2_S21_CONTAINERS_S21_TIMER_WHEEL_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "s21_intrusive_list.h"
+
+namespace s21 {
+// Иерархическое колесо таймеров. Время измеряется в тиках (например, в
+// миллисекундах) и только растёт. Колёс kLevels, в каждом kSlots ячеек:
+// ячейка нижнего колеса - один тик, ячейка следующего - целый оборот
+// предыдущего. Таймер кладётся в колесо по старшему биту, в котором его срок
+// расходится с текущим временем, поэтому schedule и cancel работают за O(1)
+// независимо от числа таймеров. Когда нижнее колесо проходит оборот,
+// ячейка верхнего колеса раскладывается по нижним (каскад). Сроки дальше
+// 2^32 тиков ждут в отдельном списке до оборота верхнего колеса.
+//
+// Ячейки - интрузивные списки, узлы таймеров берутся из собственного пула
+// и переиспользуются, поэтому отмена - это отцепление узла без поиска и
+// без освобождения памяти. Ручка таймера хранит поколение узла: ручка
+// сработавшего или отменённого таймера просто перестаёт действовать.
+//
+//   s21::timer_wheel<> timers;
+//   auto handle = timers.schedule_after(30000, [&] { conn.close(); });
+//   timers.cancel(handle);  // ответ пришёл вовремя
+//   timers.advance(now_ms);
+template <typename Callback = std::function<void()>>
+class timer_wheel {
+  struct node;
+
+ public:
+  using time_type = uint64_t;
+  using callback_type = Callback;
+  using size_type = size_t;
+
+  static constexpr size_type kLevelBits = 8;
+  static constexpr size_type kSlots = size_type{1} << kLevelBits;
+  static constexpr size_type kLevels = 4;
+
+  // Ручка запланированного таймера для отмены. Ручка по умолчанию и ручка
+  // сработавшего или отменённого таймера ни на что не указывают
+  class handle {
+   public:
+    handle() = default;
+
+   private:
+    friend class timer_wheel;
+
+    handle(node *target, uint32_t generation)
+        : node_(target), generation_(generation) {}
+
+    node *node_ = nullptr;
+    uint32_t generation_ = 0;
+  };
+
+  explicit timer_wheel(time_type start = 0) : now_(start) {}
+
+  timer_wheel(const timer_wheel &) = delete;
+  timer_wheel &operator=(const timer_wheel &) = delete;
+
+  // Узлы в списках отцепляются до разрушения пула
+  ~timer_wheel() { clear(); }
+
+  // Время последнего обработанного тика
+  time_type now() const noexcept { return now_; }
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  // Планирует вызов на тик when. Срок, который уже прошёл, переносится на
+  // следующий тик
+  template <typename F>
+  handle schedule(time_type when, F &&callback) {
+    callback_type fn(std::forward<F>(callback));
+    node *timer = acquire();
+    timer->expires = when > now_ ? when : now_ + 1;
+    timer->callback = std::move(fn);
+    place(*timer);
+    ++size_;
+    return handle(timer, timer->generation);
+  }
+
+  template <typename F>
+  handle schedule_after(time_type delay, F &&callback) {
+    return schedule(now_ + delay, std::forward<F>(callback));
+  }
+
+  // Ждёт ли таймер срабатывания
+  bool pending(const handle &timer) const noexcept {
+    return timer.node_ && timer.node_->generation == timer.generation_;
+  }
+
+  // Отменяет таймер. false - таймер уже сработал или отменён
+  bool cancel(const handle &timer) {
+    if (!pending(timer)) return false;
+    timer.node_->hook.unlink();
+    release(*timer.node_);
+    return true;
+  }
+
+  // Отменяет все таймеры
+  void clear() {
+    for (auto &wheel : wheels_) {
+      for (auto &slot : wheel) releaseAll(slot);
+    }
+    releaseAll(overflow_);
+    releaseAll(ready_);
+  }
+
+  // Продвигает время до now и вызывает таймеры со сроком не позже now.
+  // Таймеры одного тика снимаются из ячейки целиком и вызываются пачкой,
+  // порядок внутри тика не задан. Обратный вызов может планировать и
+  // отменять таймеры, в том числе ещё не вызванные из той же пачки.
+  // Возвращает число вызванных таймеров.
+  //
+  // Пустые ячейки пропускаются, поэтому длинный шаг по времени не
+  // перебирает тики по одному. Если обратный вызов бросил исключение,
+  // оставшаяся пачка будет вызвана следующим advance
+  size_type advance(time_type now) {
+    size_type fired = fireReady();
+    while (now_ < now) {
+      if (size_ == 0) {
+        now_ = now;
+        break;
+      }
+      time_type tick = nextTick(now);
+      now_ = tick;
+      if ((tick & kMask) == 0) cascade(tick);
+      ready_.splice(ready_.end(), wheels_[0][tick & kMask]);
+      fired += fireReady();
+    }
+    return fired;
+  }
+
+ private:
+  static constexpr time_type kMask = kSlots - 1;
+  static constexpr size_type kChunk = 1024;
+
+  struct node {
+    list_hook hook;
+    time_type expires = 0;
+    uint32_t generation = 0;
+    node *next_free = nullptr;
+    callback_type callback;
+  };
+
+  using bucket = intrusive_list<node, &node::hook>;
+
+  // Узлы не разрушаются до конца жизни колеса, поэтому поколение в узле
+  // можно читать по любой старой ручке
+  node *acquire() {
+    if (!free_) {
+      chunks_.push_back(std::make_unique<node[]>(kChunk));
+      node *chunk = chunks_.back().get();
+      for (size_type i = kChunk; i-- > 0;) {
+        chunk[i].next_free = free_;
+        free_ = &chunk[i];
+      }
+    }
+    node *timer = free_;
+    free_ = timer->next_free;
+    return timer;
+  }
+
+  void release(node &timer) {
+    timer.callback = callback_type();
+    ++timer.generation;
+    timer.next_free = free_;
+    free_ = &timer;
+    --size_;
+  }
+
+  void releaseAll(bucket &slot) {
+    while (!slot.empty()) {
+      node &timer = slot.front();
+      slot.pop_front();
+      release(timer);
+    }
+  }
+
+  // Колесо - по старшему блоку битов, в котором срок расходится с now_
+  void place(node &timer) {
+    time_type diff = timer.expires ^ now_;
+    for (size_type level = 0; level < kLevels; ++level) {
+      if ((diff >> (kLevelBits * (level + 1))) == 0) {
+        size_type slot = (timer.expires >> (kLevelBits * level)) & kMask;
+        wheels_[level][slot].push_back(timer);
+        return;
+      }
+    }
+    overflow_.push_back(timer);
+  }
+
+  // Ближайший тик не позже limit, на котором есть работа: занятая ячейка
+  // нижнего колеса или начало ячейки верхнего колеса, которую пора
+  // разложить. Пустые ячейки пропускаются на всех уровнях
+  time_type nextTick(time_type limit) const {
+    time_type tick = now_ + 1;
+    for (size_type level = 0; level < kLevels; ++level) {
+      size_type shift = kLevelBits * level;
+      size_type slot = (tick >> shift) & kMask;
+      // Начало оборота этого колеса - каскад из следующего
+      if (slot == 0) break;
+      while (slot < kSlots && wheels_[level][slot].empty()) ++slot;
+      tick = (tick >> (shift + kLevelBits) << (shift + kLevelBits)) +
+             (time_type{slot} << shift);
+      if (slot < kSlots) break;
+    }
+    return tick < limit ? tick : limit;
+  }
+
+  // Раскладывает заново ячейки верхних колёс, чей оборот начинается на
+  // тике tick, начиная с самого верхнего
+  void cascade(time_type tick) {
+    size_type top = 1;
+    while (top < kLevels && ((tick >> (kLevelBits * top)) & kMask) == 0) {
+      ++top;
+    }
+    if (top == kLevels) {
+      redistribute(overflow_);
+      --top;
+    }
+    for (size_type level = top; level > 0; --level) {
+      redistribute(wheels_[level][(tick >> (kLevelBits * level)) & kMask]);
+    }
+  }
+
+  void redistribute(bucket &slot) {
+    bucket moved;
+    moved.splice(moved.end(), slot);
+    while (!moved.empty()) {
+      node &timer = moved.front();
+      moved.pop_front();
+      place(timer);
+    }
+  }
+
+  // Вызывает таймеры из ready_. Узел возвращается в пул до вызова, чтобы
+  // обратный вызов мог сразу переиспользовать его для нового таймера
+  size_type fireReady() {
+    size_type fired = 0;
+    while (!ready_.empty()) {
+      node &timer = ready_.front();
+      ready_.pop_front();
+      callback_type callback = std::move(timer.callback);
+      release(timer);
+      ++fired;
+      callback();
+    }
+    return fired;
+  }
+
+  std::vector<std::unique_ptr<node[]>> chunks_;
+  node *free_ = nullptr;
+  std::array<std::array<bucket, kSlots>, kLevels> wheels_;
+  bucket overflow_;
+  bucket ready_;
+  time_type now_;
+  size_type size_ = 0;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_TIMER_WHEEL_H_
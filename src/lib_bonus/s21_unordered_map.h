@@ -0,0 +1,104 @@
+#ifndef CPP2_S21_CONTAINERS_S21_UNORDERED_MAP_H_
+#define CPP2_S21_CONTAINERS_S21_UNORDERED_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+template <typename K, typename V, typename Hash = std::hash<K>,
+          typename KeyEqual = std::equal_to<K>>
+class unordered_map
+    : public hash_table<K, std::pair<const K, V>, Hash, KeyEqual> {
+  using table_type = hash_table<K, std::pair<const K, V>, Hash, KeyEqual>;
+
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = typename table_type::value_type;
+  using size_type = typename table_type::size_type;
+  using iterator = typename table_type::iterator;
+  using const_iterator = typename table_type::const_iterator;
+
+  // CONSTRUCTORS
+  unordered_map() : table_type(){};
+  // Не меньше bucket_count слотов и свои экземпляры Hash и KeyEqual
+  explicit unordered_map(size_type bucket_count, const Hash &hash = Hash(),
+                         const KeyEqual &equal = KeyEqual())
+      : table_type(hash, equal) {
+    this->rehash(bucket_count);
+  }
+  unordered_map(std::initializer_list<value_type> const &items)
+      : table_type() {
+    this->reserve(items.size());
+    for (const auto &item : items) insert(item);
+  };
+  unordered_map(const unordered_map &m) : table_type(m){};
+  unordered_map(unordered_map &&m) noexcept : table_type(std::move(m)){};
+
+  // DESTRUCTOR
+  ~unordered_map() = default;
+
+  unordered_map &operator=(const unordered_map &m) {
+    table_type::operator=(m);
+    return *this;
+  }
+
+  unordered_map &operator=(unordered_map &&m) noexcept {
+    table_type::operator=(std::move(m));
+    return *this;
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return this->emplaceKey(value.first, value);
+  }
+
+  std::pair<iterator, bool> insert(const K &key, const V &obj) {
+    return this->emplaceKey(key, key, obj);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const K &key, const V &obj) {
+    auto res = this->emplaceKey(key, key, obj);
+    if (!res.second) res.first->second = obj;
+    return res;
+  }
+
+  V &operator[](const K &key) {
+    return this->emplaceKey(key, std::piecewise_construct,
+                            std::forward_as_tuple(key), std::tuple<>())
+        .first->second;
+  }
+
+  V &at(const K &key) {
+    auto it = this->find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("Key not found");
+    }
+    return it->second;
+  }
+
+  const V &at(const K &key) const {
+    auto it = this->find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("Key not found");
+    }
+    return it->second;
+  }
+
+  template <class... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    std::vector<std::pair<iterator, bool>> vec;
+    this->reserve(this->size() + sizeof...(args));
+    for (const auto &arg : {args...}) {
+      vec.push_back(insert(arg));
+    }
+    return vec;
+  }
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_UNORDERED_MAP_H_
@@ -0,0 +1,81 @@
+#ifndef CPP2_S21_CONTAINERS_S21_UNORDERED_SET_H_
+#define CPP2_S21_CONTAINERS_S21_UNORDERED_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+template <typename K, typename Hash = std::hash<K>,
+          typename KeyEqual = std::equal_to<K>>
+class unordered_set : public hash_table<K, K, Hash, KeyEqual> {
+  using table_type = hash_table<K, K, Hash, KeyEqual>;
+
+ public:
+  using key_type = K;
+  using value_type = K;
+  using size_type = typename table_type::size_type;
+  // Ключи менять нельзя, поэтому оба итератора константные
+  using iterator = typename table_type::const_iterator;
+  using const_iterator = typename table_type::const_iterator;
+
+  // CONSTRUCTORS
+  unordered_set() : table_type(){};
+  // Не меньше bucket_count слотов и свои экземпляры Hash и KeyEqual
+  explicit unordered_set(size_type bucket_count, const Hash &hash = Hash(),
+                         const KeyEqual &equal = KeyEqual())
+      : table_type(hash, equal) {
+    this->rehash(bucket_count);
+  }
+  unordered_set(std::initializer_list<value_type> const &items)
+      : table_type() {
+    this->reserve(items.size());
+    for (const auto &item : items) insert(item);
+  };
+  unordered_set(const unordered_set &s) : table_type(s){};
+  unordered_set(unordered_set &&s) noexcept : table_type(std::move(s)){};
+
+  // DESTRUCTOR
+  ~unordered_set() = default;
+
+  unordered_set &operator=(const unordered_set &s) {
+    table_type::operator=(s);
+    return *this;
+  }
+
+  unordered_set &operator=(unordered_set &&s) noexcept {
+    table_type::operator=(std::move(s));
+    return *this;
+  }
+
+  iterator begin() const noexcept { return table_type::begin(); }
+  iterator end() const noexcept { return table_type::end(); }
+
+  iterator find(const K &key) const { return table_type::find(key); }
+
+  template <typename Other, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  iterator find(const Other &key) const {
+    return table_type::find(key);
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return this->emplaceKey(value, value);
+  }
+
+  template <class... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    std::vector<std::pair<iterator, bool>> vec;
+    this->reserve(this->size() + sizeof...(args));
+    for (const auto &arg : {args...}) {
+      vec.push_back(insert(arg));
+    }
+    return vec;
+  }
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_UNORDERED_SET_H_
@@ -0,0 +1,554 @@
+#ifndef CPP2_S21_CONTAINERS_S21_UNROLLED_LIST_H_
+#define CPP2_S21_CONTAINERS_S21_UNROLLED_LIST_H_
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Развёрнутый список: двусвязный список блоков, в каждом до BlockSize
+// элементов подряд. Обход читает память блоками, как vector, а вставка и
+// удаление сдвигают элементы только внутри одного блока. Полный блок при
+// вставке делится пополам (на краях списка вместо деления заводится новый
+// блок), полупустой блок при удалении сливается с соседом.
+//
+// Интерфейс повторяет s21::list. Вставка и удаление делают
+// недействительными итераторы на элементы затронутых блоков; splice всего
+// списка перевешивает блоки целиком.
+template <typename T, size_t BlockSize = std::max<size_t>(8, 512 / sizeof(T))>
+class unrolled_list {
+  static_assert(BlockSize >= 2, "block must hold at least two elements");
+
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+
+ private:
+  // Звено цепочки блоков. Заголовок списка - звено без элементов, он
+  // замыкает цепочку в кольцо и служит позицией end()
+  struct link {
+    link *prev;
+    link *next;
+    size_type count;
+  };
+
+  struct block : link {
+    block() : link{nullptr, nullptr, 0} {}
+
+    value_type *slot(size_type i) {
+      return std::launder(reinterpret_cast<value_type *>(storage)) + i;
+    }
+
+    alignas(value_type) unsigned char storage[BlockSize * sizeof(value_type)];
+  };
+
+  static block *asBlock(link *n) { return static_cast<block *>(n); }
+
+ public:
+  class const_iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = unrolled_list::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    const_iterator() : node_(nullptr), position_(0) {}
+
+    reference operator*() const { return *asBlock(node_)->slot(position_); }
+    pointer operator->() const { return asBlock(node_)->slot(position_); }
+
+    const_iterator &operator++() {
+      increment();
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator tmp(*this);
+      increment();
+      return tmp;
+    }
+
+    const_iterator &operator--() {
+      decrement();
+      return *this;
+    }
+
+    const_iterator operator--(int) {
+      const_iterator tmp(*this);
+      decrement();
+      return tmp;
+    }
+
+    bool operator==(const const_iterator &other) const {
+      return node_ == other.node_ && position_ == other.position_;
+    }
+    bool operator!=(const const_iterator &other) const {
+      return !(*this == other);
+    }
+
+   protected:
+    friend class unrolled_list;
+
+    const_iterator(link *n, size_type position)
+        : node_(n), position_(position) {}
+
+    void increment() {
+      if (++position_ == node_->count) {
+        node_ = node_->next;
+        position_ = 0;
+      }
+    }
+
+    void decrement() {
+      if (position_ == 0) {
+        node_ = node_->prev;
+        position_ = node_->count;
+      }
+      --position_;
+    }
+
+    link *node_;
+    size_type position_;
+  };
+
+  class iterator : public const_iterator {
+   public:
+    using pointer = value_type *;
+    using reference = value_type &;
+
+    iterator() : const_iterator() {}
+
+    reference operator*() const {
+      return *asBlock(this->node_)->slot(this->position_);
+    }
+    pointer operator->() const {
+      return asBlock(this->node_)->slot(this->position_);
+    }
+
+    iterator &operator++() {
+      this->increment();
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator tmp(*this);
+      this->increment();
+      return tmp;
+    }
+
+    iterator &operator--() {
+      this->decrement();
+      return *this;
+    }
+
+    iterator operator--(int) {
+      iterator tmp(*this);
+      this->decrement();
+      return tmp;
+    }
+
+   private:
+    friend class unrolled_list;
+
+    iterator(link *n, size_type position) : const_iterator(n, position) {}
+  };
+
+  // CONSTRUCTORS
+  unrolled_list() noexcept : header_{&header_, &header_, 0}, size_(0) {}
+
+  explicit unrolled_list(size_type n) : unrolled_list() {
+    for (size_type i = 0; i < n; ++i) push_back(value_type());
+  }
+
+  unrolled_list(std::initializer_list<value_type> const &items)
+      : unrolled_list() {
+    for (const auto &item : items) push_back(item);
+  }
+
+  unrolled_list(const unrolled_list &other) : unrolled_list() {
+    for (const auto &item : other) push_back(item);
+  }
+
+  unrolled_list(unrolled_list &&other) noexcept : unrolled_list() {
+    swap(other);
+  }
+
+  // DESTRUCTOR
+  ~unrolled_list() { clear(); }
+
+  unrolled_list &operator=(const unrolled_list &other) {
+    if (this != &other) {
+      unrolled_list copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  unrolled_list &operator=(unrolled_list &&other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  bool operator==(const unrolled_list &other) const {
+    return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+  }
+  bool operator!=(const unrolled_list &other) const {
+    return !(*this == other);
+  }
+
+  // ELEMENT ACCESS
+  reference front() {
+    if (empty()) throw std::out_of_range("List is empty");
+    return *asBlock(header_.next)->slot(0);
+  }
+  const_reference front() const {
+    return const_cast<unrolled_list *>(this)->front();
+  }
+
+  reference back() {
+    if (empty()) throw std::out_of_range("List is empty");
+    return *asBlock(header_.prev)->slot(header_.prev->count - 1);
+  }
+  const_reference back() const {
+    return const_cast<unrolled_list *>(this)->back();
+  }
+
+  // ITERATORS
+  iterator begin() noexcept { return iterator(header_.next, 0); }
+  iterator end() noexcept { return iterator(&header_, 0); }
+  const_iterator begin() const noexcept {
+    return const_iterator(header_.next, 0);
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(const_cast<link *>(&header_), 0);
+  }
+
+  // CAPACITY
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+  }
+  // Число элементов в одном блоке
+  static constexpr size_type block_size() noexcept { return BlockSize; }
+
+  // MODIFIERS
+  void clear() noexcept {
+    for (link *n = header_.next; n != &header_;) {
+      link *next = n->next;
+      destroyBlock(asBlock(n));
+      n = next;
+    }
+    header_.prev = header_.next = &header_;
+    size_ = 0;
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplaceAt(pos.node_, pos.position_, value);
+  }
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplaceAt(pos.node_, pos.position_, std::move(value));
+  }
+
+  // Возвращает итератор на элемент, следующий за удалённым
+  iterator erase(const_iterator pos) {
+    return eraseAt(asBlock(pos.node_), pos.position_);
+  }
+
+  void push_back(const_reference value) { emplaceAt(&header_, 0, value); }
+  void push_back(value_type &&value) {
+    emplaceAt(&header_, 0, std::move(value));
+  }
+
+  void push_front(const_reference value) {
+    emplaceAt(header_.next, 0, value);
+  }
+  void push_front(value_type &&value) {
+    emplaceAt(header_.next, 0, std::move(value));
+  }
+
+  void pop_back() {
+    if (!empty()) eraseAt(asBlock(header_.prev), header_.prev->count - 1);
+  }
+
+  void pop_front() {
+    if (!empty()) eraseAt(asBlock(header_.next), 0);
+  }
+
+  void swap(unrolled_list &other) noexcept {
+    std::swap(header_, other.header_);
+    std::swap(size_, other.size_);
+    fixHeader();
+    other.fixHeader();
+  }
+
+  void merge(unrolled_list &other) {
+    merge(other, [](const_reference a, const_reference b) { return a < b; });
+  }
+
+  // Значения переносятся в новые блоки за один проход. При равенстве
+  // первым остаётся элемент этого списка
+  template <typename Compare>
+  void merge(unrolled_list &other, Compare comp) {
+    if (this == &other || other.empty()) return;
+    unrolled_list merged;
+    auto a = begin(), b = other.begin();
+    while (a != end() && b != other.end()) {
+      if (comp(*b, *a)) {
+        merged.push_back(std::move(*b++));
+      } else {
+        merged.push_back(std::move(*a++));
+      }
+    }
+    for (; a != end(); ++a) merged.push_back(std::move(*a));
+    for (; b != other.end(); ++b) merged.push_back(std::move(*b));
+    swap(merged);
+    other.clear();
+  }
+
+  // Переносит все элементы other перед pos. Блоки other перевешиваются
+  // целиком; если pos в середине блока, блок сначала делится в этой точке
+  void splice(const_iterator pos, unrolled_list &other) {
+    if (this == &other || other.empty()) return;
+    link *before = pos.node_;
+    if (pos.position_ != 0) {
+      before = splitAt(asBlock(pos.node_), pos.position_);
+    }
+    link *first = other.header_.next, *last = other.header_.prev;
+    first->prev = before->prev;
+    last->next = before;
+    before->prev->next = first;
+    before->prev = last;
+    size_ += other.size_;
+    other.header_.prev = other.header_.next = &other.header_;
+    other.size_ = 0;
+  }
+
+  // Разворачивает порядок блоков и элементы внутри каждого блока
+  void reverse() noexcept {
+    link *n = &header_;
+    do {
+      std::swap(n->prev, n->next);
+      if (n != &header_) {
+        std::reverse(asBlock(n)->slot(0), asBlock(n)->slot(n->count));
+      }
+      n = n->prev;
+    } while (n != &header_);
+  }
+
+  // Удаляет подряд идущие равные элементы, уплотняя блоки на месте
+  void unique() {
+    if (size_ < 2) return;
+    iterator write = begin();
+    for (iterator read = std::next(begin()); read != end(); ++read) {
+      if (!(*read == *write)) {
+        ++write;
+        if (write != read) *write = std::move(*read);
+      }
+    }
+    truncate(++write);
+  }
+
+  void sort() {
+    sort([](const_reference a, const_reference b) { return a < b; });
+  }
+
+  // Устойчивая сортировка: элементы переносятся во временный vector,
+  // сортируются там и возвращаются в те же блоки
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size_ < 2) return;
+    std::vector<value_type> items;
+    items.reserve(size_);
+    for (auto &item : *this) items.push_back(std::move(item));
+    std::stable_sort(items.begin(), items.end(), comp);
+    auto it = items.begin();
+    for (auto &item : *this) item = std::move(*it++);
+  }
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    std::vector<value_type> items{std::forward<Args>(args)...};
+    iterator it(pos.node_, pos.position_);
+    for (auto item = items.rbegin(); item != items.rend(); ++item) {
+      it = emplaceAt(it.node_, it.position_, std::move(*item));
+    }
+    return it;
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (push_back(std::forward<Args>(args)), ...);
+  }
+
+  template <typename... Args>
+  void insert_many_front(Args &&...args) {
+    insert_many(begin(), std::forward<Args>(args)...);
+  }
+
+ private:
+  void fixHeader() noexcept {
+    if (size_ == 0) {
+      header_.prev = header_.next = &header_;
+    } else {
+      header_.next->prev = &header_;
+      header_.prev->next = &header_;
+    }
+  }
+
+  block *newBlockBefore(link *next) {
+    block *b = new block;
+    b->prev = next->prev;
+    b->next = next;
+    next->prev->next = b;
+    next->prev = b;
+    return b;
+  }
+
+  void destroyBlock(block *b) noexcept {
+    for (size_type i = 0; i < b->count; ++i) b->slot(i)->~value_type();
+    delete b;
+  }
+
+  // Выкидывает из цепочки блок, элементы которого уже разрушены или
+  // перенесены
+  void removeBlock(block *b) noexcept {
+    b->prev->next = b->next;
+    b->next->prev = b->prev;
+    delete b;
+  }
+
+  // Переносит элементы [from, from + n) блока src в конец блока dst
+  static void moveSlots(block *src, size_type from, size_type n, block *dst) {
+    for (size_type i = 0; i < n; ++i) {
+      value_type *item = src->slot(from + i);
+      new (dst->slot(dst->count + i)) value_type(std::move(*item));
+      item->~value_type();
+    }
+    dst->count += n;
+  }
+
+  // Отделяет элементы блока начиная с position в новый блок следом за ним
+  block *splitAt(block *b, size_type position) {
+    block *tail = newBlockBefore(b->next);
+    moveSlots(b, position, b->count - position, tail);
+    b->count = position;
+    return tail;
+  }
+
+  // Вставка перед (n, position); n == &header_ означает конец списка.
+  // Значение собирается до сдвигов, поэтому исключение из конструктора
+  // оставляет список нетронутым
+  template <typename... Args>
+  iterator emplaceAt(link *n, size_type position, Args &&...args) {
+    value_type value(std::forward<Args>(args)...);
+    if (n == &header_ && header_.prev != &header_) {
+      n = header_.prev;
+      position = n->count;
+    }
+    block *b;
+    if (n == &header_) {
+      b = newBlockBefore(&header_);
+    } else if (n->count < BlockSize) {
+      b = asBlock(n);
+    } else if (position == n->count) {
+      // Дописывание в полный блок: в начало следующего или в новый блок
+      link *next = n->next;
+      b = next != &header_ && next->count < BlockSize ? asBlock(next)
+                                                      : newBlockBefore(next);
+      position = 0;
+    } else if (position == 0) {
+      link *prev = n->prev;
+      b = prev != &header_ && prev->count < BlockSize ? asBlock(prev)
+                                                      : newBlockBefore(n);
+      position = b->count;
+    } else {
+      b = asBlock(n);
+      block *tail = splitAt(b, BlockSize / 2);
+      if (position > BlockSize / 2) {
+        position -= BlockSize / 2;
+        b = tail;
+      }
+    }
+    for (size_type i = b->count; i > position; --i) {
+      new (b->slot(i)) value_type(std::move(*b->slot(i - 1)));
+      b->slot(i - 1)->~value_type();
+    }
+    new (b->slot(position)) value_type(std::move(value));
+    ++b->count;
+    ++size_;
+    return iterator(b, position);
+  }
+
+  // Удаляет элемент и сливает блок с соседями, если вместе они
+  // умещаются в один блок, а сам блок заполнен меньше чем наполовину
+  iterator eraseAt(block *b, size_type position) {
+    b->slot(position)->~value_type();
+    for (size_type i = position + 1; i < b->count; ++i) {
+      new (b->slot(i - 1)) value_type(std::move(*b->slot(i)));
+      b->slot(i)->~value_type();
+    }
+    --b->count;
+    --size_;
+    if (b->count == 0) {
+      link *next = b->next;
+      removeBlock(b);
+      return iterator(next, 0);
+    }
+    if (b->count < BlockSize / 2) {
+      link *next = b->next;
+      if (next != &header_ && b->count + next->count <= BlockSize) {
+        moveSlots(asBlock(next), 0, next->count, b);
+        removeBlock(asBlock(next));
+      }
+      link *prev = b->prev;
+      if (prev != &header_ && prev->count + b->count <= BlockSize) {
+        position += prev->count;
+        moveSlots(b, 0, b->count, asBlock(prev));
+        removeBlock(b);
+        b = asBlock(prev);
+      }
+    }
+    if (position == b->count) return iterator(b->next, 0);
+    return iterator(b, position);
+  }
+
+  // Удаляет элементы от pos до конца списка
+  void truncate(iterator pos) {
+    if (pos == end()) return;
+    block *b = asBlock(pos.node_);
+    for (size_type i = pos.position_; i < b->count; ++i) {
+      b->slot(i)->~value_type();
+    }
+    size_ -= b->count - pos.position_;
+    b->count = pos.position_;
+    for (link *n = b->next; n != &header_;) {
+      link *next = n->next;
+      size_ -= n->count;
+      destroyBlock(asBlock(n));
+      n = next;
+    }
+    b->next = &header_;
+    header_.prev = b;
+    if (b->count == 0) removeBlock(b);
+  }
+
+  link header_;
+  size_type size_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_UNROLLED_LIST_H_
@@ -0,0 +1,171 @@
+#ifndef CPP2_S21_CONTAINERS_S21_WS_DEQUE_H_
+#define CPP2_S21_CONTAINERS_S21_WS_DEQUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+#include "s21_concurrency.h"
+
+namespace s21 {
+// Дек для кражи работы (Chase-Lev): владелец кладёт и забирает элементы с
+// нижнего конца, как со стека, остальные потоки крадут с верхнего. Владелец
+// спорит с ворами только за последний элемент, поэтому push и take почти
+// всегда обходятся без CAS.
+//
+// Кольцевой массив растёт вдвое, когда заполнен. Старые массивы остаются
+// жить до разрушения дека: вор мог успеть прочитать указатель на массив и
+// ещё читает из него. Вместе они занимают не больше последнего массива.
+//
+// Вор читает ячейку раньше, чем подтверждает кражу CAS-ом, поэтому T должен
+// быть тривиально копируемым (обычно это указатель на задачу).
+//
+// push и take вызывает только поток-владелец, steal - любой поток.
+template <typename T>
+class ws_deque {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "ws_deque elements must be trivially copyable");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  // Начальная ёмкость округляется вверх до степени двойки
+  explicit ws_deque(size_type capacity = 64)
+      : ring_(new ring(roundUp(capacity), nullptr)) {}
+
+  ws_deque(const ws_deque &) = delete;
+  ws_deque &operator=(const ws_deque &) = delete;
+
+  ~ws_deque() {
+    ring *current = ring_.load(std::memory_order_relaxed);
+    while (current) {
+      ring *previous = current->previous;
+      delete current;
+      current = previous;
+    }
+  }
+
+  // OWNER
+  void push(value_type value) {
+    int64_t bottom = bottom_.value.load(std::memory_order_relaxed);
+    int64_t top = top_.value.load(std::memory_order_acquire);
+    ring *slots = ring_.load(std::memory_order_relaxed);
+    if (bottom - top >= static_cast<int64_t>(slots->capacity)) {
+      slots = grow(slots, top, bottom);
+    }
+    slots->put(bottom, value);
+    // Запись индекса с release публикует ячейку ворам
+    bottom_.value.store(bottom + 1, std::memory_order_release);
+  }
+
+  // Забирает последний положенный элемент. Пусто - дек пуст или последний
+  // элемент украли
+  std::optional<value_type> take() {
+    int64_t bottom = bottom_.value.load(std::memory_order_relaxed) - 1;
+    ring *slots = ring_.load(std::memory_order_relaxed);
+    // Сначала занимаем ячейку уменьшением bottom_, потом смотрим на top_:
+    // seq_cst на обеих операциях не даёт чтению обогнать запись, и вор,
+    // пришедший позже, увидит уменьшенный bottom_
+    bottom_.value.store(bottom, std::memory_order_seq_cst);
+    int64_t top = top_.value.load(std::memory_order_seq_cst);
+    std::optional<value_type> out;
+    if (top <= bottom) {
+      out = slots->get(bottom);
+      if (top == bottom) {
+        // Последний элемент: спорим с ворами за top_
+        if (!top_.value.compare_exchange_strong(top, top + 1,
+                                                std::memory_order_seq_cst,
+                                                std::memory_order_relaxed)) {
+          out.reset();
+        }
+        bottom_.value.store(bottom + 1, std::memory_order_relaxed);
+      }
+    } else {
+      bottom_.value.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return out;
+  }
+
+  // THIEVES
+  // Крадёт самый старый элемент. Пусто - дек пуст или кражу перехватили
+  std::optional<value_type> steal() {
+    int64_t top = top_.value.load(std::memory_order_seq_cst);
+    int64_t bottom = bottom_.value.load(std::memory_order_seq_cst);
+    if (top >= bottom) return std::nullopt;
+    ring *slots = ring_.load(std::memory_order_acquire);
+    value_type value = slots->get(top);
+    if (!top_.value.compare_exchange_strong(top, top + 1,
+                                            std::memory_order_seq_cst,
+                                            std::memory_order_relaxed)) {
+      return std::nullopt;
+    }
+    return value;
+  }
+
+  // CAPACITY
+  // Моментальный снимок: при одновременных операциях может устареть
+  size_type size_approx() const noexcept {
+    int64_t bottom = bottom_.value.load(std::memory_order_acquire);
+    int64_t top = top_.value.load(std::memory_order_acquire);
+    return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+  }
+  bool empty() const noexcept { return size_approx() == 0; }
+  size_type capacity() const noexcept {
+    return ring_.load(std::memory_order_relaxed)->capacity;
+  }
+
+ private:
+  // Кольцевой массив. Ячейки атомарны: вор может читать ячейку, которую
+  // владелец в это время перезаписывает, - такое значение вор отбросит,
+  // проиграв CAS
+  struct ring {
+    ring(size_type size, ring *older)
+        : capacity(size),
+          mask(size - 1),
+          slots(new std::atomic<value_type>[size]),
+          previous(older) {}
+    ~ring() { delete[] slots; }
+
+    value_type get(int64_t index) const {
+      return slots[static_cast<size_type>(index) & mask].load(
+          std::memory_order_relaxed);
+    }
+    void put(int64_t index, value_type value) {
+      slots[static_cast<size_type>(index) & mask].store(
+          value, std::memory_order_relaxed);
+    }
+
+    const size_type capacity;
+    const size_type mask;
+    std::atomic<value_type> *slots;
+    ring *const previous;
+  };
+
+  struct alignas(kCacheLine) index {
+    std::atomic<int64_t> value{0};
+  };
+
+  static size_type roundUp(size_type capacity) {
+    size_type rounded = 2;
+    while (rounded < capacity) rounded *= 2;
+    return rounded;
+  }
+
+  // Копирует живые элементы [top, bottom) в массив вдвое больше
+  ring *grow(ring *old, int64_t top, int64_t bottom) {
+    ring *bigger = new ring(old->capacity * 2, old);
+    for (int64_t i = top; i < bottom; ++i) bigger->put(i, old->get(i));
+    ring_.store(bigger, std::memory_order_release);
+    return bigger;
+  }
+
+  index top_;
+  index bottom_;
+  std::atomic<ring *> ring_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_WS_DEQUE_H_
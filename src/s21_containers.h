@@ -4,8 +4,10 @@
 #include <iostream>
 #include <limits>
 
+#include "lib/s21_deque.h"
 #include "lib/s21_list.h"
 #include "lib/s21_map.h"
+#include "lib/s21_priority_queue.h"
 #include "lib/s21_queue.h"
 #include "lib/s21_set.h"
 #include "lib/s21_stack.h"
@@ -3,6 +3,26 @@
 
 #include "./s21_containers.h"
 #include "lib_bonus/s21_array.h"
+#include "lib_bonus/s21_blocking_queue.h"
+#include "lib_bonus/s21_btree_map.h"
+#include "lib_bonus/s21_btree_set.h"
+#include "lib_bonus/s21_concurrent_map.h"
+#include "lib_bonus/s21_counted_multiset.h"
+#include "lib_bonus/s21_indexed_heap.h"
+#include "lib_bonus/s21_intrusive_list.h"
+#include "lib_bonus/s21_lockfree_stack.h"
+#include "lib_bonus/s21_lru_cache.h"
+#include "lib_bonus/s21_mpmc_queue.h"
 #include "lib_bonus/s21_multiset.h"
+#include "lib_bonus/s21_persistent_map.h"
+#include "lib_bonus/s21_ring_buffer.h"
+#include "lib_bonus/s21_skiplist_map.h"
+#include "lib_bonus/s21_spsc_queue.h"
+#include "lib_bonus/s21_task_pool.h"
+#include "lib_bonus/s21_timer_wheel.h"
+#include "lib_bonus/s21_unordered_map.h"
+#include "lib_bonus/s21_unordered_set.h"
+#include "lib_bonus/s21_unrolled_list.h"
+#include "lib_bonus/s21_ws_deque.h"
 
 #endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_H_
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+#include "../s21_containers.h"
+
+TEST(deque, constructor_test_01) {
+  s21::deque<int> d;
+  EXPECT_TRUE(d.empty());
+  EXPECT_EQ(d.size(), 0U);
+  EXPECT_EQ(d.capacity(), 0U);
+  EXPECT_THROW(d.front(), std::out_of_range);
+  EXPECT_THROW(d.back(), std::out_of_range);
+  EXPECT_THROW(d.pop_front(), std::out_of_range);
+}
+
+TEST(deque, constructor_test_02) {
+  s21::deque<std::string> d{"a", "b", "c"};
+  s21::deque<std::string> copy(d);
+  s21::deque<std::string> moved(std::move(d));
+  EXPECT_TRUE(d.empty());
+  EXPECT_EQ(copy.size(), 3U);
+  EXPECT_EQ(moved.back(), "c");
+  copy = moved;
+  moved.pop_back();
+  EXPECT_EQ(copy.back(), "c");
+  d = std::move(moved);
+  EXPECT_EQ(d.size(), 2U);
+}
+
+TEST(deque, push_pop_both_ends) {
+  s21::deque<int> d;
+  std::deque<int> expected;
+  for (int i = 1; i < 200; ++i) {
+    if (i % 2 == 0) {
+      d.push_back(i);
+      expected.push_back(i);
+    } else {
+      d.push_front(i);
+      expected.push_front(i);
+    }
+    if (i % 5 == 0) {
+      d.pop_front();
+      expected.pop_front();
+    }
+    if (i % 7 == 0) {
+      d.pop_back();
+      expected.pop_back();
+    }
+  }
+  ASSERT_EQ(d.size(), expected.size());
+  for (size_t i = 0; i < d.size(); ++i) {
+    EXPECT_EQ(d[i], expected[i]);
+  }
+  EXPECT_EQ(d.front(), expected.front());
+  EXPECT_EQ(d.back(), expected.back());
+  EXPECT_THROW(d.at(d.size()), std::out_of_range);
+}
+
+TEST(deque, capacity_is_power_of_two) {
+  s21::deque<int> d;
+  d.reserve(100);
+  EXPECT_EQ(d.capacity(), 128U);
+  for (int i = 0; i < 128; ++i) d.push_back(i);
+  EXPECT_EQ(d.capacity(), 128U);
+  d.push_front(-1);
+  EXPECT_EQ(d.capacity(), 256U);
+  EXPECT_EQ(d.front(), -1);
+  EXPECT_EQ(d.back(), 127);
+}
+
+TEST(deque, emplace_move_only) {
+  s21::deque<std::unique_ptr<int>> d;
+  d.emplace_back(new int(1));
+  d.emplace_front(new int(0));
+  d.push_back(std::make_unique<int>(2));
+  for (int i = 3; i < 20; ++i) d.push_back(std::make_unique<int>(i));
+  EXPECT_EQ(*d.front(), 0);
+  EXPECT_EQ(*d.back(), 19);
+  d.pop_front();
+  EXPECT_EQ(*d.front(), 1);
+}
+
+TEST(deque, iterators) {
+  s21::deque<int> d;
+  for (int i = 0; i < 10; ++i) d.push_front(i);
+  std::sort(d.begin(), d.end());
+  int expected = 0;
+  for (int value : d) EXPECT_EQ(value, expected++);
+  const s21::deque<int>& view = d;
+  s21::deque<int>::const_iterator it = d.begin();
+  EXPECT_TRUE(it == view.begin());
+  EXPECT_EQ(view.end() - view.begin(), 10);
+  EXPECT_EQ(*(it + 3), 3);
+  EXPECT_EQ(it[9], 9);
+}
+
+namespace {
+// Копия бросает, когда кончился запас copies_left; перемещения нет, поэтому
+// рост дека копирует элементы. live хранит адреса живых объектов
+struct fragile {
+  static int copies_left;
+  static std::set<const fragile*> live;
+  explicit fragile(int v) : value(v) { live.insert(this); }
+  fragile(const fragile& other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy");
+    live.insert(this);
+  }
+  ~fragile() { EXPECT_EQ(live.erase(this), 1U); }
+  int value;
+};
+int fragile::copies_left = 0;
+std::set<const fragile*> fragile::live;
+}  // namespace
+
+TEST(deque, grow_throw_keeps_elements) {
+  {
+    s21::deque<fragile> d;
+    for (int i = 0; i < 8; ++i) d.emplace_back(i);
+    EXPECT_EQ(d.capacity(), 8U);
+    fragile::copies_left = 4;
+    EXPECT_THROW(d.emplace_back(8), std::runtime_error);
+    EXPECT_EQ(fragile::live.size(), 8U);
+    EXPECT_EQ(d.size(), 8U);
+    EXPECT_EQ(d.capacity(), 8U);
+    for (int i = 0; i < 8; ++i) {
+      EXPECT_EQ(fragile::live.count(&d[i]), 1U);
+      EXPECT_EQ(d[i].value, i);
+    }
+    fragile::copies_left = 8;
+    d.emplace_front(-1);
+    EXPECT_EQ(d.front().value, -1);
+    EXPECT_EQ(fragile::live.size(), 9U);
+  }
+  EXPECT_TRUE(fragile::live.empty());
+}
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <list>
+#include <string>
+#include <thread>
 
 #include "../s21_containers.h"
 
@@ -329,6 +331,58 @@ TEST(list, modifiers_sort_7) {
   }
 }
 
+TEST(list, modifiers_sort_8_stable_compare) {
+  s21::list<std::pair<int, int>> l;
+  for (int i = 0; i < 100; ++i) {
+    l.push_back({(i * 37) % 10, i});
+  }
+  l.sort([](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+    return a.first > b.first;
+  });
+  auto prev = *l.begin();
+  for (auto it = ++l.begin(); it != l.end(); ++it) {
+    EXPECT_GE(prev.first, (*it).first);
+    if (prev.first == (*it).first) {
+      EXPECT_LT(prev.second, (*it).second);
+    }
+    prev = *it;
+  }
+  EXPECT_EQ(l.size(), 100U);
+}
+
+TEST(list, modifiers_sort_9_iterators_stay_valid) {
+  s21::list<int> l = {5, 3, 9, 1, 7};
+  auto nine = ++(++l.begin());
+  auto end = l.end();
+  l.sort();
+  EXPECT_EQ(*nine, 9);
+  EXPECT_TRUE(nine.next() == end);
+  EXPECT_TRUE(l.end() == end);
+  EXPECT_EQ(*(--nine), 7);
+  EXPECT_EQ(l.back(), 9);
+  EXPECT_EQ(l.front(), 1);
+}
+
+TEST(list, modifiers_sort_10_large) {
+  std::list<int> stl_list;
+  s21::list<int> s21_list;
+  for (int i = 0; i < 10007; ++i) {
+    int value = (i * 7919) % 1013;
+    stl_list.push_back(value);
+    s21_list.push_back(value);
+  }
+  stl_list.sort();
+  s21_list.sort();
+  auto stl_it = stl_list.begin();
+  for (auto it = s21_list.begin(); it != s21_list.end(); ++it, ++stl_it) {
+    EXPECT_EQ(*it, *stl_it);
+  }
+  auto stl_back = stl_list.rbegin();
+  for (auto it = --s21_list.end(); it != s21_list.begin(); --it) {
+    EXPECT_EQ(*it, *stl_back++);
+  }
+}
+
 TEST(list, modifiers_swap_1) {
   std::list<int> a1 = {1, 2, 3};
   std::list<int> a2 = {3, 4, 5, 6};
@@ -649,6 +703,210 @@ TEST(list, modifiers_splice_3) {
   }
 }
 
+TEST(list, modifiers_splice_4_keeps_nodes) {
+  s21::list<int> a = {1, 2, 3};
+  s21::list<int> b = {4, 5};
+  auto four = b.begin();
+  a.splice(a.end(), b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_TRUE(b.begin() == b.end());
+  EXPECT_EQ(a.size(), 5U);
+  EXPECT_EQ(*four, 4);
+  EXPECT_TRUE(four.prev() == ++(++a.begin()));
+  EXPECT_EQ(a.back(), 5);
+  b.splice(b.begin(), a);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b.size(), 5U);
+  EXPECT_EQ(b.front(), 1);
+}
+
+TEST(list, modifiers_splice_5_single) {
+  s21::list<int> a = {1, 2, 3};
+  s21::list<int> b = {10, 20};
+  a.splice(++a.begin(), b, ++b.begin());
+  EXPECT_EQ(a.size(), 4U);
+  EXPECT_EQ(b.size(), 1U);
+  EXPECT_TRUE(a == s21::list<int>({1, 20, 2, 3}));
+  a.splice(a.begin(), a, --a.end());
+  EXPECT_TRUE(a == s21::list<int>({3, 1, 20, 2}));
+  a.splice(a.begin(), a, a.begin());
+  EXPECT_TRUE(a == s21::list<int>({3, 1, 20, 2}));
+  b.pop_back();
+  b.splice(b.end(), a, a.begin());
+  EXPECT_EQ(b.front(), 3);
+  EXPECT_EQ(b.size(), 1U);
+}
+
+TEST(list, modifiers_splice_6_range) {
+  s21::list<int> a = {1, 2, 3, 4, 5};
+  s21::list<int> b = {10, 20};
+  auto first = ++a.begin();
+  auto last = --a.end();
+  b.splice(++b.begin(), a, first, last);
+  EXPECT_TRUE(a == s21::list<int>({1, 5}));
+  EXPECT_TRUE(b == s21::list<int>({10, 2, 3, 4, 20}));
+  EXPECT_EQ(a.size(), 2U);
+  EXPECT_EQ(b.size(), 5U);
+  b.splice(b.end(), b, b.begin(), ++(++b.begin()));
+  EXPECT_TRUE(b == s21::list<int>({3, 4, 20, 10, 2}));
+  EXPECT_EQ(b.size(), 5U);
+  b.splice(b.begin(), b, b.begin(), b.begin());
+  EXPECT_EQ(b.front(), 3);
+}
+
+TEST(list, modifiers_merge_compare) {
+  s21::list<int> a = {9, 5, 5, 1};
+  s21::list<int> b = {10, 5, 2, 0};
+  auto five = ++b.begin();
+  a.merge(b, [](int x, int y) { return x > y; });
+  EXPECT_TRUE(b.empty());
+  EXPECT_TRUE(a == s21::list<int>({10, 9, 5, 5, 5, 2, 1, 0}));
+  EXPECT_TRUE(five.prev() == ++(++(++a.begin())));
+  s21::list<int> empty;
+  empty.merge(a);
+  EXPECT_EQ(empty.size(), 8U);
+  EXPECT_EQ(empty.back(), 0);
+}
+
+TEST(list, modifiers_swap_2_keeps_nodes) {
+  s21::list<int> a = {1, 2};
+  s21::list<int> b;
+  auto two = ++a.begin();
+  a.swap(b);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b.size(), 2U);
+  EXPECT_TRUE(two == --b.end());
+  a.push_back(7);
+  EXPECT_EQ(a.front(), 7);
+}
+
+TEST(list, pool_separate_pools) {
+  using pooled_list = s21::list<std::string, s21::pool_allocator<std::string>>;
+  s21::pool_allocator<int> alloc;
+  s21::pool_allocator<int> copy = alloc;
+  EXPECT_TRUE(alloc == copy);
+  EXPECT_FALSE(alloc == s21::pool_allocator<int>());
+  int* block = copy.allocate(1);
+  EXPECT_TRUE(alloc == copy);
+  alloc.deallocate(block, 1);
+  pooled_list a = {"a", "c"};
+  pooled_list b = {"b", "d", "e"};
+  a.merge(b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_TRUE(a == pooled_list({"a", "b", "c", "d", "e"}));
+  b.push_back("x");
+  b.splice(b.begin(), a, ++a.begin(), --a.end());
+  EXPECT_TRUE(b == pooled_list({"b", "c", "d", "x"}));
+  EXPECT_EQ(a.size(), 2U);
+  a.splice(a.end(), b);
+  EXPECT_EQ(a.size(), 6U);
+  EXPECT_EQ(a.back(), "x");
+  a.swap(b);
+  EXPECT_EQ(b.size(), 6U);
+  pooled_list moved(std::move(b));
+  b.clear();
+  for (int i = 0; i < 100; ++i) {
+    b.push_front(std::to_string(i));
+  }
+  EXPECT_EQ(b.front(), "99");
+  EXPECT_EQ(moved.size(), 6U);
+}
+
+// Узлы общего пула переходят между списками разных потоков без копирования
+// и освобождаются в любом потоке
+TEST(list, pool_shared_across_threads) {
+  s21::list<std::string> a;
+  const std::string* first = nullptr;
+  std::thread producer([&] {
+    s21::list<std::string> local;
+    for (int i = 0; i < 1000; ++i) {
+      local.push_back(std::to_string(i));
+    }
+    first = &local.front();
+    a.splice(a.end(), local);
+  });
+  producer.join();
+  EXPECT_EQ(a.size(), 1000U);
+  EXPECT_EQ(&a.front(), first);
+  std::thread consumer([&] {
+    s21::list<std::string> local;
+    local.merge(a);
+    EXPECT_EQ(&local.front(), first);
+    for (int i = 0; i < 500; ++i) {
+      local.push_back("x");
+    }
+  });
+  consumer.join();
+  EXPECT_TRUE(a.empty());
+}
+
+namespace {
+size_t list_allocations = 0;
+
+template <typename T>
+struct counting_allocator : std::allocator<T> {
+  template <typename U>
+  struct rebind {
+    using other = counting_allocator<U>;
+  };
+
+  counting_allocator() = default;
+  template <typename U>
+  counting_allocator(const counting_allocator<U>&) {}
+
+  T* allocate(size_t n) {
+    list_allocations++;
+    return std::allocator<T>::allocate(n);
+  }
+};
+
+struct no_default {
+  explicit no_default(int v) : value(v) {}
+  bool operator<(const no_default& other) const { return value < other.value; }
+  int value;
+};
+}  // namespace
+
+TEST(list, sentinel_no_allocations) {
+  using counted_list = s21::list<int, counting_allocator<int>>;
+  list_allocations = 0;
+  counted_list a;
+  counted_list b(std::move(a));
+  a = std::move(b);
+  a.swap(b);
+  EXPECT_EQ(list_allocations, 0U);
+  a.push_back(1);
+  a.push_back(2);
+  EXPECT_EQ(list_allocations, 2U);
+  b = std::move(a);
+  counted_list c(std::move(b));
+  EXPECT_EQ(list_allocations, 2U);
+  EXPECT_TRUE(a.empty());
+  EXPECT_TRUE(b.begin() == b.end());
+  b.push_front(0);
+  EXPECT_EQ(b.front(), 0);
+  EXPECT_EQ(c.size(), 2U);
+  EXPECT_EQ(c.back(), 2);
+  EXPECT_EQ(*--c.end(), 2);
+}
+
+TEST(list, sentinel_non_default_constructible) {
+  s21::list<no_default> l;
+  l.push_back(no_default(3));
+  l.push_front(no_default(1));
+  l.insert(--l.end(), no_default(2));
+  l.sort();
+  EXPECT_EQ(l.front().value, 1);
+  EXPECT_EQ(l.back().value, 3);
+  s21::list<no_default> other(std::move(l));
+  EXPECT_TRUE(l.empty());
+  EXPECT_EQ(other.size(), 3U);
+  l.swap(other);
+  EXPECT_EQ(l.size(), 3U);
+  EXPECT_TRUE(other.begin() == other.end());
+  EXPECT_THROW(*l.end(), std::out_of_range);
+}
+
 TEST(list, modifiers_unique_1) {
   std::list<int> l1 = {1, 2, 3, 4, 5};
   s21::list<int> l2 = {1, 2, 3, 4, 5};
@@ -950,4 +950,83 @@ TEST(map, merge_4) {
   s21_map_int_res.merge(s21_map_int_ref);
 
   EXPECT_EQ(s21_map_int_res.size(), 6U);
-}
\ No newline at end of file
+}
+
+TEST(map, custom_compare) {
+  s21::map<int, std::string, std::greater<int>> s21_map = {
+      {1, "one"}, {3, "three"}, {2, "two"}};
+
+  auto it = s21_map.begin();
+  EXPECT_EQ(it->first, 3);
+  ++it;
+  EXPECT_EQ(it->first, 2);
+  ++it;
+  EXPECT_EQ(it->first, 1);
+  EXPECT_EQ(s21_map.at(2), "two");
+  EXPECT_EQ(s21_map.lower_bound(4)->first, 3);
+}
+
+TEST(map, transparent_find) {
+  s21::map<std::string, int, std::less<>> s21_map = {
+      {"hello", 1}, {"hi", 2}, {"hola", 3}};
+  std::string_view key = "hi";
+
+  EXPECT_EQ(s21_map.find(key)->second, 2);
+  EXPECT_TRUE(s21_map.find(std::string_view("hey")) == s21_map.end());
+  EXPECT_TRUE(s21_map.contains(key));
+  EXPECT_FALSE(s21_map.contains(std::string_view("hey")));
+  EXPECT_EQ(s21_map.count(key), 1U);
+  EXPECT_EQ(s21_map.count(std::string_view("hey")), 0U);
+  EXPECT_EQ(s21_map.lower_bound(std::string_view("hk"))->first, "hola");
+}
+
+TEST(map, find_count_lower_bound) {
+  s21::map<int, double> s21_map = {{9, 1.4}, {23, 2.77}, {98, 3.9}};
+  std::map<int, double> std_map = {{9, 1.4}, {23, 2.77}, {98, 3.9}};
+
+  EXPECT_EQ(s21_map.find(23)->second, std_map.find(23)->second);
+  EXPECT_TRUE(s21_map.find(24) == s21_map.end());
+  EXPECT_EQ(s21_map.count(9), std_map.count(9));
+  EXPECT_EQ(s21_map.count(10), std_map.count(10));
+  EXPECT_EQ(s21_map.lower_bound(23)->first, std_map.lower_bound(23)->first);
+  EXPECT_EQ(s21_map.lower_bound(24)->first, std_map.lower_bound(24)->first);
+  EXPECT_TRUE(s21_map.lower_bound(99) == s21_map.end());
+}
+
+TEST(map, erase_many) {
+  s21::map<int, int> s21_map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < 200; ++i) {
+    int key = (i * 37) % 101;
+    s21_map.insert(key, i);
+    std_map.insert({key, i});
+  }
+  for (int i = 0; i < 60; ++i) {
+    int key = (i * 53) % 101;
+    s21_map.erase(key);
+    std_map.erase(key);
+  }
+  for (int key = 0; key < 101; ++key) {
+    EXPECT_EQ(s21_map.contains(key), std_map.count(key) == 1);
+  }
+  auto it = s21_map.begin();
+  for (const auto &item : std_map) {
+    EXPECT_EQ(it->first, item.first);
+    ++it;
+  }
+}
+
+TEST(map, insert_or_assign) {
+  s21::map<int, std::string> s21_map;
+
+  auto res = s21_map.insert_or_assign(1, "one");
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(s21_map.size(), 1U);
+  res = s21_map.insert_or_assign(2, "two");
+  EXPECT_TRUE(res.second);
+  res = s21_map.insert_or_assign(1, "uno");
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(res.first->second, "uno");
+  EXPECT_EQ(s21_map.size(), 2U);
+  EXPECT_EQ(s21_map.at(2), "two");
+}
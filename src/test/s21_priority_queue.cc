@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+
+namespace {
+// Снимает все элементы и сравнивает порядок с std::priority_queue
+template <typename Queue, typename Compare>
+void expect_same_order(Queue& q, std::vector<int> const& items,
+                       Compare comp) {
+  std::priority_queue<int, std::vector<int>, Compare> expected(
+      comp, std::vector<int>(items));
+  ASSERT_EQ(q.size(), expected.size());
+  while (!expected.empty()) {
+    ASSERT_EQ(q.top(), expected.top());
+    q.pop();
+    expected.pop();
+  }
+  EXPECT_TRUE(q.empty());
+}
+
+std::vector<int> random_items(int count) {
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> dist(-1000, 1000);
+  std::vector<int> items(count);
+  for (auto& item : items) {
+    item = dist(gen);
+  }
+  return items;
+}
+}  // namespace
+
+TEST(priority_queue, constructors) {
+  s21::priority_queue<int> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.size(), 0u);
+  EXPECT_THROW(empty.top(), std::out_of_range);
+  empty.pop();
+  EXPECT_TRUE(empty.empty());
+
+  s21::priority_queue<int> q{3, 1, 4, 1, 5, 9, 2, 6};
+  EXPECT_EQ(q.size(), 8u);
+  EXPECT_EQ(q.top(), 9);
+
+  s21::priority_queue<int> copy(q);
+  copy.pop();
+  EXPECT_EQ(copy.top(), 6);
+  EXPECT_EQ(q.top(), 9);
+
+  s21::priority_queue<int> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 7u);
+  q = moved;
+  EXPECT_EQ(q.top(), 6);
+  s21::priority_queue<int> other;
+  other = std::move(moved);
+  EXPECT_EQ(other.size(), 7u);
+}
+
+TEST(priority_queue, push_pop_matches_std) {
+  auto items = random_items(1000);
+  s21::priority_queue<int> quaternary;
+  s21::priority_queue<int, s21::vector<int>, std::less<int>, 2> binary;
+  for (int item : items) {
+    quaternary.push(item);
+    binary.push(item);
+  }
+  expect_same_order(quaternary, items, std::less<int>());
+  expect_same_order(binary, items, std::less<int>());
+}
+
+TEST(priority_queue, min_heap_and_arity) {
+  auto items = random_items(777);
+  s21::priority_queue<int, s21::vector<int>, std::greater<int>, 3> ternary;
+  s21::priority_queue<int, s21::vector<int>, std::greater<int>, 8> octal;
+  for (int item : items) {
+    ternary.emplace(item);
+    octal.emplace(item);
+  }
+  EXPECT_EQ(ternary.arity, 3u);
+  expect_same_order(ternary, items, std::greater<int>());
+  expect_same_order(octal, items, std::greater<int>());
+}
+
+TEST(priority_queue, heapify_from_range) {
+  auto items = random_items(500);
+  s21::priority_queue<int> from_range(items.begin(), items.end());
+  expect_same_order(from_range, items, std::less<int>());
+
+  s21::vector<int> storage;
+  for (int item : items) {
+    storage.push_back(item);
+  }
+  s21::priority_queue<int, s21::vector<int>, std::greater<int>> from_container(
+      std::greater<int>(), std::move(storage));
+  expect_same_order(from_container, items, std::greater<int>());
+}
+
+TEST(priority_queue, push_range) {
+  auto items = random_items(300);
+  s21::priority_queue<int> q;
+  // Большой диапазон перестраивает кучу, малый - всплывает поэлементно
+  q.push_range(std::vector<int>(items.begin(), items.begin() + 200));
+  q.push_range(items.begin() + 200, items.end());
+  expect_same_order(q, items, std::less<int>());
+}
+
+TEST(priority_queue, containers_and_move_only) {
+  auto items = random_items(200);
+  s21::priority_queue<int, s21::deque<int>> on_deque(items.begin(),
+                                                      items.end());
+  expect_same_order(on_deque, items, std::less<int>());
+
+  auto by_value = [](std::unique_ptr<int> const& a,
+                     std::unique_ptr<int> const& b) { return *a > *b; };
+  s21::priority_queue<std::unique_ptr<int>, s21::vector<std::unique_ptr<int>>,
+                      decltype(by_value)>
+      owners(by_value);
+  for (int i : {5, 2, 8, 1}) {
+    owners.push(std::make_unique<int>(i));
+  }
+  EXPECT_EQ(*owners.top(), 1);
+  owners.pop();
+  EXPECT_EQ(*owners.top(), 2);
+}
+
+TEST(priority_queue, swap_and_clear) {
+  s21::priority_queue<std::string> a{"b", "c", "a"};
+  s21::priority_queue<std::string> b{"z"};
+  a.swap(b);
+  EXPECT_EQ(a.size(), 1u);
+  EXPECT_EQ(a.top(), "z");
+  EXPECT_EQ(b.top(), "c");
+  b.clear();
+  EXPECT_TRUE(b.empty());
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <deque>
 #include <queue>
 
 #include "../s21_containers.h"
@@ -411,4 +412,69 @@ TEST(queue, insert_many_back) {
   EXPECT_EQ(queue.back(), "awesome");
   EXPECT_EQ(queue.front(), "You");
   EXPECT_EQ(queue.size(), 3);
-}
\ No newline at end of file
+}
+TEST(queue, reuses_buffer) {
+  s21::queue<std::string> q;
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 100; ++i) q.push(std::to_string(i));
+    for (int i = 0; i < 100; ++i) {
+      EXPECT_EQ(q.front(), std::to_string(i));
+      q.pop();
+    }
+  }
+  EXPECT_TRUE(q.empty());
+  q.push("a");
+  s21::queue<std::string> moved(std::move(q));
+  moved.push("b");
+  s21::queue<std::string> other;
+  other.swap(moved);
+  EXPECT_EQ(other.back(), "b");
+  other.pop();
+  EXPECT_EQ(other.front(), "b");
+}
+
+TEST(queue, containers) {
+  s21::queue<int, s21::list<int, std::allocator<int>>> listed{1, 2};
+  s21::queue<int, std::deque<int>> plain{3, 4};
+  listed.pop();
+  plain.pop();
+  EXPECT_EQ(listed.front(), 2);
+  EXPECT_EQ(plain.front(), 4);
+}
+
+TEST(queue, emplace_and_push_range) {
+  s21::queue<std::pair<std::string, int>> q;
+  q.emplace("one", 1);
+  q.push(std::make_pair(std::string("two"), 2));
+  EXPECT_EQ(q.front().first, "one");
+  EXPECT_EQ(q.back().second, 2);
+  s21::queue<int> numbers;
+  int items[] = {1, 2, 3};
+  numbers.push_range(items);
+  numbers.push_range(std::begin(items), std::end(items));
+  EXPECT_EQ(numbers.size(), 6U);
+  EXPECT_EQ(numbers.front(), 1);
+  EXPECT_EQ(numbers.back(), 3);
+}
+
+TEST(queue, wraps_around_ring) {
+  s21::queue<int> q;
+  std::queue<int> expected;
+  for (int i = 0; i < 1000; ++i) {
+    q.push(i);
+    expected.push(i);
+    if (i % 3 == 1) {
+      q.pop();
+      expected.pop();
+    }
+    ASSERT_EQ(q.front(), expected.front());
+    ASSERT_EQ(q.back(), expected.back());
+  }
+  s21::queue<int> copy(q);
+  while (!expected.empty()) {
+    EXPECT_EQ(copy.front(), expected.front());
+    copy.pop();
+    expected.pop();
+  }
+  EXPECT_EQ(q.size(), 667U);
+}
@@ -861,4 +861,58 @@ TEST(set, insert_many) {
   EXPECT_EQ(s.size(), 5);
   EXPECT_EQ(*s.begin(), "g");
   EXPECT_EQ(*(--s.end()), "w");
-}
\ No newline at end of file
+}
+
+TEST(set, custom_compare) {
+  s21::set<int, std::greater<int>> s21_set = {1, 5, 3, 4};
+  std::set<int, std::greater<int>> std_set = {1, 5, 3, 4};
+
+  auto s21_it = s21_set.begin();
+  for (auto std_it = std_set.begin(); std_it != std_set.end(); ++std_it) {
+    EXPECT_EQ(*s21_it, *std_it);
+    ++s21_it;
+  }
+  EXPECT_TRUE(s21_set.find(3) != s21_set.end());
+  EXPECT_EQ(*s21_set.lower_bound(2), *std_set.lower_bound(2));
+}
+
+namespace {
+// Компаратор с состоянием и без конструктора по умолчанию
+struct by_remainder {
+  explicit by_remainder(int m) : mod(m) {}
+  bool operator()(int a, int b) const { return a % mod < b % mod; }
+  int mod;
+};
+}  // namespace
+
+TEST(set, stateful_compare) {
+  s21::set<int, by_remainder> s(by_remainder(10));
+  s.insert(13);
+  s.insert(21);
+  s.insert(33);
+  s.insert(40);
+  EXPECT_EQ(s.size(), 3U);
+  EXPECT_EQ(*s.begin(), 40);
+  EXPECT_TRUE(s.contains(3));
+  EXPECT_EQ(s.key_comp().mod, 10);
+  s21::set<int, by_remainder> copy(s);
+  EXPECT_EQ(copy.key_comp().mod, 10);
+  copy.insert(5);
+  EXPECT_EQ(*--copy.end(), 5);
+  s21::set<int, by_remainder> other(by_remainder(7));
+  other.swap(copy);
+  EXPECT_EQ(other.key_comp().mod, 10);
+  EXPECT_EQ(copy.key_comp().mod, 7);
+}
+
+TEST(set, transparent_lookup) {
+  s21::set<std::string, std::less<>> s21_set({"t", "v", "p", "w"});
+  std::string_view key = "v";
+
+  EXPECT_EQ(*s21_set.find(key), "v");
+  EXPECT_TRUE(s21_set.find(std::string_view("a")) == s21_set.end());
+  EXPECT_TRUE(s21_set.contains(key));
+  EXPECT_EQ(s21_set.count(key), 1U);
+  EXPECT_EQ(s21_set.count(std::string_view("a")), 0U);
+  EXPECT_EQ(*s21_set.lower_bound(std::string_view("q")), "t");
+}
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <stack>
+#include <vector>
 
 #include "../s21_containers.h"
 
@@ -466,3 +468,82 @@ TEST(stack, insert_many_back) {
   EXPECT_EQ(stack.top(), 1);
   EXPECT_EQ(stack.size(), 3);
 }
+
+TEST(stack, reuses_buffer) {
+  s21::stack<std::string> s;
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 100; ++i) s.push(std::to_string(i));
+    for (int i = 99; i >= 0; --i) {
+      EXPECT_EQ(s.top(), std::to_string(i));
+      s.pop();
+    }
+  }
+  s.push("a");
+  s21::stack<std::string> copy(s);
+  s21::stack<std::string> moved(std::move(s));
+  moved.push("b");
+  copy.swap(moved);
+  EXPECT_EQ(copy.size(), 2U);
+  EXPECT_EQ(copy.top(), "b");
+  EXPECT_EQ(moved.top(), "a");
+}
+
+TEST(stack, containers) {
+  s21::stack<int, s21::list<int, std::allocator<int>>> listed{1, 2};
+  s21::stack<int, std::vector<int>> plain{3, 4};
+  s21::stack<int, s21::deque<int>> ring{5, 6};
+  EXPECT_EQ(listed.top(), 2);
+  EXPECT_EQ(plain.top(), 4);
+  EXPECT_EQ(ring.top(), 6);
+  plain.pop();
+  ring.pop();
+  listed.pop();
+  EXPECT_EQ(plain.top(), 3);
+  EXPECT_EQ(ring.top(), 5);
+  EXPECT_EQ(listed.top(), 1);
+}
+
+TEST(stack, emplace_and_push_range) {
+  s21::stack<std::pair<std::string, int>> s;
+  s.emplace("one", 1);
+  std::pair<std::string, int> two("two", 2);
+  s.push(std::move(two));
+  EXPECT_EQ(s.top().first, "two");
+  EXPECT_EQ(s.size(), 2U);
+  s21::stack<int> numbers;
+  std::vector<int> items = {1, 2, 3};
+  numbers.push_range(items);
+  numbers.push_range(items.rbegin(), items.rend());
+  EXPECT_EQ(numbers.size(), 6U);
+  EXPECT_EQ(numbers.top(), 1);
+  numbers.pop();
+  EXPECT_EQ(numbers.top(), 2);
+}
+
+TEST(stack, copy_is_independent) {
+  s21::stack<int> s{1, 2, 3};
+  s21::stack<int> copy;
+  copy.push(10);
+  copy = s;
+  EXPECT_EQ(copy.size(), 3U);
+  copy.pop();
+  EXPECT_EQ(copy.top(), 2);
+  EXPECT_EQ(s.top(), 3);
+  s21::stack<int> from_vector(s21::vector<int>{7, 8});
+  EXPECT_EQ(from_vector.top(), 8);
+}
+
+TEST(stack, pop_releases_element) {
+  auto shared = std::make_shared<int>(1);
+  s21::stack<std::shared_ptr<int>> s;
+  s.push(shared);
+  s.push(shared);
+  EXPECT_EQ(shared.use_count(), 3);
+  s.pop();
+  EXPECT_EQ(shared.use_count(), 2);
+  s.clear();
+  EXPECT_EQ(shared.use_count(), 1);
+  s.emplace(shared);
+  s21::stack<std::shared_ptr<int>> copy = s;
+  EXPECT_EQ(shared.use_count(), 3);
+}
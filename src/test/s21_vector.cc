@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "../s21_containers.h"
@@ -1059,3 +1061,48 @@ TEST(vector, modifiers_insert_many_7) {
   EXPECT_EQ(v[6], "words");
   EXPECT_EQ(v[7], "world");
 }
+
+namespace {
+struct no_default {
+  explicit no_default(int v) : value(std::make_shared<int>(v)) {}
+  std::shared_ptr<int> value;
+};
+}  // namespace
+
+TEST(vector, modifiers_destroy_elements) {
+  auto shared = std::make_shared<int>(1);
+  s21::vector<std::shared_ptr<int>> v;
+  for (int i = 0; i < 5; i++) {
+    v.push_back(shared);
+  }
+  EXPECT_EQ(shared.use_count(), 6);
+  v.pop_back();
+  v.erase(v.begin());
+  EXPECT_EQ(shared.use_count(), 4);
+  v.resize(1);
+  EXPECT_EQ(shared.use_count(), 2);
+  v.resize(3);
+  EXPECT_EQ(v.at(2), nullptr);
+  v.clear();
+  EXPECT_EQ(shared.use_count(), 1);
+  EXPECT_EQ(v.capacity(), 8);
+}
+
+TEST(vector, modifiers_emplace_in_place) {
+  s21::vector<no_default> v;
+  v.emplace_back(1);
+  v.emplace_back(2);
+  v.emplace_back(3);
+  EXPECT_EQ(*v.at(2).value, 3);
+  v.insert(v.begin(), v.at(1));
+  EXPECT_EQ(*v.at(0).value, 2);
+  EXPECT_EQ(*v.at(3).value, 3);
+  // Аргумент ссылается на элемент, который переезжает в новый буфер
+  s21::vector<std::string> words{"first"};
+  words.push_back(words.at(0));
+  words.emplace_back(words.at(1), 0, 3);
+  EXPECT_EQ(words.at(1), "first");
+  EXPECT_EQ(words.at(2), "fir");
+  words.shrink_to_fit();
+  EXPECT_EQ(words.capacity(), 3);
+}
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cstring>
+#include <string>
+#include <type_traits>
 
 #include "../s21_containersplus.h"
 
@@ -236,3 +239,52 @@ TEST(array, data_test_02) {
   s21::array<double, 5> arr{1.01, 2.02, 3.03, 4.04, 5.05};
   EXPECT_EQ(arr.data()[3], arr.at(3));
 }
+
+namespace {
+constexpr s21::array<int, 8> squares() {
+  s21::array<int, 8> table{};
+  for (size_t i = 0; i < table.size(); ++i) {
+    table[i] = static_cast<int>(i * i);
+  }
+  return table;
+}
+}  // namespace
+
+// Массив - агрегат без лишних полей, копируется как обычная память
+TEST(array, trivial_aggregate) {
+  static_assert(std::is_aggregate_v<s21::array<int, 4>>);
+  static_assert(std::is_trivially_copyable_v<s21::array<int, 4>>);
+  static_assert(sizeof(s21::array<int, 4>) == 4 * sizeof(int));
+  static_assert(!std::is_trivially_copyable_v<s21::array<std::string, 2>>);
+  s21::array<int, 4> arr = {1, 2, 3, 4};
+  s21::array<int, 4> copy;
+  std::memcpy(&copy, &arr, sizeof(arr));
+  EXPECT_EQ(copy[3], 4);
+  copy = arr;
+  EXPECT_EQ(copy.back(), 4);
+  s21::array<int, 4> zeros{};
+  for (int value : zeros) EXPECT_EQ(value, 0);
+}
+
+TEST(array, constexpr_table) {
+  constexpr s21::array<int, 8> table = squares();
+  static_assert(table[7] == 49);
+  static_assert(table.at(3) == 9);
+  static_assert(table.size() == 8 && !table.empty());
+  static_assert(*(table.end() - 1) == table.back());
+  const s21::array<int, 8> &ref = table;
+  int sum = 0;
+  for (int value : ref) sum += value;
+  EXPECT_EQ(sum, 140);
+  EXPECT_THROW(ref.at(8), std::out_of_range);
+}
+
+TEST(array, swap_elementwise) {
+  s21::array<std::string, 2> arr = {"a", "b"};
+  s21::array<std::string, 2> arr1 = {"c", "d"};
+  arr.swap(arr1);
+  EXPECT_EQ(arr[0], "c");
+  EXPECT_EQ(arr1[1], "b");
+  arr.front() = "e";
+  EXPECT_EQ(arr.data()[0], "e");
+}
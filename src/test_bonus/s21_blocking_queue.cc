@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+using namespace std::chrono_literals;
+
+// producers потоков кладут по items чисел, consumers потоков забирают их
+// пакетами до закрытия очереди. Сумма и количество должны сойтись
+void pipeline(int producers, int consumers, int items) {
+  s21::blocking_queue<int> q(16);
+  std::atomic<long long> sum{0};
+  std::atomic<int> received{0};
+  std::vector<std::thread> writers;
+  std::vector<std::thread> readers;
+  for (int p = 0; p < producers; ++p) {
+    writers.emplace_back([&] {
+      for (int i = 1; i <= items; ++i) EXPECT_TRUE(q.push(i));
+    });
+  }
+  for (int c = 0; c < consumers; ++c) {
+    readers.emplace_back([&] {
+      std::vector<int> out(8);
+      size_t got;
+      while ((got = q.pop_batch(out.begin(), out.size())) != 0) {
+        for (size_t i = 0; i < got; ++i) sum += out[i];
+        received += static_cast<int>(got);
+      }
+    });
+  }
+  for (auto &thread : writers) thread.join();
+  q.close();
+  for (auto &thread : readers) thread.join();
+  EXPECT_EQ(received.load(), producers * items);
+  EXPECT_EQ(sum.load(), 1LL * producers * items * (items + 1) / 2);
+  auto stats = q.statistics();
+  EXPECT_EQ(stats.pushed, static_cast<size_t>(producers * items));
+  EXPECT_EQ(stats.popped, stats.pushed);
+  EXPECT_LE(stats.max_depth, q.capacity());
+}
+}  // namespace
+
+TEST(blocking_queue, push_pop_in_order) {
+  s21::blocking_queue<std::string> q(3);
+  EXPECT_EQ(q.capacity(), 3U);
+  EXPECT_TRUE(q.push("a"));
+  EXPECT_TRUE(q.emplace(2, 'b'));
+  std::string c = "c";
+  EXPECT_TRUE(q.try_push(c));
+  EXPECT_FALSE(q.try_push("d"));
+  EXPECT_EQ(q.size(), 3U);
+  EXPECT_EQ(*q.pop(), "a");
+  std::string out;
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "bb");
+  EXPECT_EQ(*q.pop(), "c");
+  EXPECT_FALSE(q.try_pop(out));
+  auto stats = q.statistics();
+  EXPECT_EQ(stats.pushed, 3U);
+  EXPECT_EQ(stats.popped, 3U);
+  EXPECT_EQ(stats.max_depth, 3U);
+  EXPECT_EQ(stats.producer_waits, 0U);
+  EXPECT_EQ(stats.consumer_waits, 0U);
+}
+
+TEST(blocking_queue, pop_batch_drains_up_to_max) {
+  s21::blocking_queue<std::unique_ptr<int>> q(8);
+  for (int i = 0; i < 5; ++i) q.push(std::make_unique<int>(i));
+  std::vector<std::unique_ptr<int>> out(3);
+  EXPECT_EQ(q.pop_batch(out.begin(), out.size(), 0ms), 3U);
+  for (int i = 0; i < 3; ++i) EXPECT_EQ(*out[i], i);
+  EXPECT_EQ(q.pop_batch(out.begin(), out.size(), 0ms), 2U);
+  EXPECT_EQ(*out[0], 3);
+  EXPECT_EQ(*out[1], 4);
+  EXPECT_EQ(q.pop_batch(out.begin(), 0), 0U);
+}
+
+TEST(blocking_queue, pop_batch_times_out) {
+  s21::blocking_queue<int> q(4);
+  std::vector<int> out(4);
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(q.pop_batch(out.begin(), out.size(), 20ms), 0U);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+  auto stats = q.statistics();
+  EXPECT_EQ(stats.consumer_waits, 1U);
+  EXPECT_GE(stats.consumer_wait_time, 20ms);
+}
+
+TEST(blocking_queue, wake_batch_collects_elements) {
+  s21::blocking_queue<int> q(8, 4);
+  EXPECT_EQ(q.wake_batch(), 4U);
+  EXPECT_EQ(s21::blocking_queue<int>(2, 0).wake_batch(), 1U);
+  EXPECT_EQ(s21::blocking_queue<int>(2, 5).wake_batch(), 2U);
+  // Потребитель не просыпается, пока не наберётся пакет
+  std::thread producer([&] {
+    while (q.statistics().consumer_waits == 0) std::this_thread::yield();
+    for (int i = 0; i < 4; ++i) q.push(i);
+  });
+  std::vector<int> out(8);
+  EXPECT_EQ(q.pop_batch(out.begin(), out.size()), 4U);
+  producer.join();
+  // Неполный пакет забирается по истечении таймаута
+  producer = std::thread([&] {
+    while (q.statistics().consumer_waits == 1) std::this_thread::yield();
+    q.push(10);
+    q.push(11);
+  });
+  EXPECT_EQ(q.pop_batch(out.begin(), out.size(), 50ms), 2U);
+  producer.join();
+  EXPECT_EQ(out[0], 10);
+  EXPECT_EQ(out[1], 11);
+}
+
+TEST(blocking_queue, close_wakes_and_drains) {
+  s21::blocking_queue<int> q(2);
+  q.push(1);
+  q.push(2);
+  // Производитель ждёт места, потребитель - ничего: close будит обоих
+  std::thread producer([&] { EXPECT_FALSE(q.push(3)); });
+  while (q.statistics().producer_waits == 0) std::this_thread::yield();
+  q.close();
+  producer.join();
+  EXPECT_TRUE(q.closed());
+  EXPECT_FALSE(q.try_push(4));
+  EXPECT_EQ(*q.pop(), 1);
+  EXPECT_EQ(*q.pop(), 2);
+  EXPECT_FALSE(q.pop().has_value());
+  std::vector<int> out(2);
+  EXPECT_EQ(q.pop_batch(out.begin(), out.size()), 0U);
+  EXPECT_EQ(q.statistics().producer_waits, 1U);
+}
+
+TEST(blocking_queue, backpressure_blocks_producer) {
+  s21::blocking_queue<int> q(1);
+  q.push(0);
+  std::atomic<bool> pushed{false};
+  std::thread producer([&] {
+    q.push(1);
+    pushed = true;
+  });
+  while (q.statistics().producer_waits == 0) std::this_thread::yield();
+  EXPECT_FALSE(pushed.load());
+  EXPECT_EQ(*q.pop(), 0);
+  EXPECT_EQ(*q.pop(), 1);
+  producer.join();
+  EXPECT_TRUE(pushed.load());
+}
+
+TEST(blocking_queue, threads) {
+  pipeline(1, 1, 20000);
+  pipeline(4, 3, 5000);
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "../s21_containersplus.h"
+
+TEST(btree_map, constructor) {
+  s21::btree_map<int, std::string> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.begin() == m.end());
+  s21::btree_map<int, std::string> m2 = {{2, "b"}, {1, "a"}, {2, "c"}};
+  EXPECT_EQ(m2.size(), 2U);
+  EXPECT_EQ(m2.at(2), "b");
+  EXPECT_EQ(m2.begin()->first, 1);
+}
+
+TEST(btree_map, copy_move) {
+  s21::btree_map<int, int> m;
+  for (int i = 0; i < 1000; ++i) m.insert(i, i * 2);
+  s21::btree_map<int, int> copy(m);
+  s21::btree_map<int, int> moved(std::move(m));
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(copy.size(), 1000U);
+  EXPECT_EQ(moved.size(), 1000U);
+  EXPECT_EQ(copy.height(), moved.height());
+  copy[5] = -1;
+  EXPECT_EQ(moved[5], 10);
+  m = copy;
+  EXPECT_EQ(m.at(5), -1);
+  EXPECT_EQ(m.size(), 1000U);
+}
+
+TEST(btree_map, element_access) {
+  s21::btree_map<std::string, int> m;
+  m["a"] = 1;
+  EXPECT_EQ(m["a"], 1);
+  EXPECT_EQ(m["b"], 0);
+  EXPECT_EQ(m.size(), 2U);
+  EXPECT_THROW(m.at("c"), std::out_of_range);
+  const auto &cm = m;
+  EXPECT_EQ(cm.at("a"), 1);
+  EXPECT_THROW(cm.at("c"), std::out_of_range);
+}
+
+TEST(btree_map, insert_or_assign) {
+  s21::btree_map<int, std::string> m;
+  EXPECT_TRUE(m.insert_or_assign(1, "one").second);
+  EXPECT_FALSE(m.insert_or_assign(1, "uno").second);
+  EXPECT_FALSE(m.insert(1, "eins").second);
+  EXPECT_EQ(m.at(1), "uno");
+}
+
+TEST(btree_map, iteration_both_ways) {
+  s21::btree_map<int, int> m;
+  for (int i = 0; i < 5000; ++i) m.insert((i * 7919) % 5000, i);
+  int expected = 0;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    EXPECT_EQ(it->first, expected++);
+  }
+  EXPECT_EQ(expected, 5000);
+  auto it = m.end();
+  while (it != m.begin()) EXPECT_EQ((--it)->first, --expected);
+  EXPECT_EQ(expected, 0);
+}
+
+TEST(btree_map, height_is_logarithmic) {
+  s21::btree_map<long long, long long> m;
+  for (long long i = 0; i < 100000; ++i) m.insert(i, i);
+  EXPECT_LE(m.height(), 6U);
+  for (long long i = 0; i < 100000; i += 2) m.erase(i);
+  EXPECT_EQ(m.size(), 50000U);
+  EXPECT_LE(m.height(), 6U);
+}
+
+TEST(btree_map, bounds) {
+  s21::btree_map<int, int> m;
+  for (int i = 0; i < 1000; i += 10) m.insert(i, i);
+  EXPECT_EQ(m.lower_bound(20)->first, 20);
+  EXPECT_EQ(m.lower_bound(21)->first, 30);
+  EXPECT_EQ(m.lower_bound(-5)->first, 0);
+  EXPECT_TRUE(m.lower_bound(995) == m.end());
+  EXPECT_EQ(m.upper_bound(20)->first, 30);
+  EXPECT_TRUE(m.upper_bound(990) == m.end());
+  EXPECT_EQ(m.find(500)->second, 500);
+  EXPECT_TRUE(m.find(501) == m.end());
+  EXPECT_EQ(m.count(500), 1U);
+  EXPECT_FALSE(m.contains(501));
+}
+
+TEST(btree_map, matches_std_map) {
+  s21::btree_map<int, int> m;
+  std::map<int, int> expected;
+  std::mt19937 rng(21);
+  for (int i = 0; i < 50000; ++i) {
+    int key = rng() % 3000;
+    if (rng() % 3 == 0) {
+      EXPECT_EQ(m.erase(key), expected.erase(key));
+    } else {
+      m.insert_or_assign(key, i);
+      expected[key] = i;
+    }
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  auto it = m.begin();
+  for (const auto &item : expected) {
+    EXPECT_EQ(it->first, item.first);
+    EXPECT_EQ(it->second, item.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == m.end());
+  while (!m.empty()) m.erase(m.begin());
+  EXPECT_TRUE(m.begin() == m.end());
+  EXPECT_EQ(m.height(), 0U);
+}
+
+TEST(btree_map, string_values) {
+  s21::btree_map<std::string, std::string> m;
+  for (int i = 0; i < 2000; ++i) {
+    m.insert(std::to_string(i), std::string(40, 'a' + i % 26));
+  }
+  for (int i = 0; i < 2000; i += 3) m.erase(std::to_string(i));
+  EXPECT_EQ(m.size(), 1333U);
+  EXPECT_EQ(m.at("1"), std::string(40, 'b'));
+  EXPECT_FALSE(m.contains("999"));
+}
+
+TEST(btree_map, merge_swap) {
+  s21::btree_map<int, int> a = {{1, 1}, {2, 2}};
+  s21::btree_map<int, int> b = {{2, 20}, {3, 30}};
+  a.merge(b);
+  EXPECT_EQ(a.size(), 3U);
+  EXPECT_EQ(a.at(2), 2);
+  EXPECT_EQ(a.at(3), 30);
+  EXPECT_EQ(b.size(), 1U);
+  EXPECT_EQ(b.at(2), 20);
+  a.swap(b);
+  EXPECT_EQ(a.size(), 1U);
+  EXPECT_EQ(b.size(), 3U);
+  auto res = b.insert_many(std::make_pair(4, 4), std::make_pair(1, 5));
+  EXPECT_TRUE(res[0].second);
+  EXPECT_FALSE(res[1].second);
+}
+
+TEST(btree_map, transparent_lookup) {
+  s21::btree_map<std::string, int, std::less<>> m = {{"apple", 1}};
+  std::string_view key = "apple";
+  EXPECT_EQ(m.find(key)->second, 1);
+  EXPECT_TRUE(m.contains(key));
+  EXPECT_EQ(m.count(std::string_view("pear")), 0U);
+  const auto &cm = m;
+  EXPECT_EQ(cm.find(key)->second, 1);
+  EXPECT_TRUE(cm.contains(key));
+  EXPECT_EQ(cm.lower_bound(std::string_view("b")), cm.end());
+}
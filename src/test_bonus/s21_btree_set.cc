@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+
+#include "../s21_containersplus.h"
+
+TEST(btree_set, constructor) {
+  s21::btree_set<int> s;
+  EXPECT_TRUE(s.empty());
+  EXPECT_TRUE(s.begin() == s.end());
+  s21::btree_set<std::string> s2 = {"b", "a", "b", "c"};
+  EXPECT_EQ(s2.size(), 3U);
+  EXPECT_EQ(*s2.begin(), "a");
+}
+
+TEST(btree_set, insert_erase) {
+  s21::btree_set<int> s;
+  EXPECT_TRUE(s.insert(5).second);
+  EXPECT_FALSE(s.insert(5).second);
+  EXPECT_EQ(*s.find(5), 5);
+  s.erase(s.find(5));
+  EXPECT_TRUE(s.find(5) == s.end());
+  EXPECT_EQ(s.count(5), 0U);
+  EXPECT_TRUE(s.empty());
+}
+
+TEST(btree_set, matches_std_set) {
+  s21::btree_set<long long> s;
+  std::set<long long> expected;
+  for (long long i = 0; i < 20000; ++i) {
+    long long key = (i * 104729) % 7919;
+    if (i % 4 == 3) {
+      EXPECT_EQ(s.erase(key), expected.erase(key));
+    } else {
+      EXPECT_EQ(s.insert(key).second, expected.insert(key).second);
+    }
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  auto it = s.begin();
+  for (long long key : expected) EXPECT_EQ(*it++, key);
+  EXPECT_TRUE(it == s.end());
+}
+
+TEST(btree_set, bounds_descending) {
+  s21::btree_set<int, std::greater<int>> s;
+  for (int i = 0; i < 100; ++i) s.insert(i);
+  EXPECT_EQ(*s.begin(), 99);
+  EXPECT_EQ(*s.lower_bound(50), 50);
+  EXPECT_EQ(*s.upper_bound(50), 49);
+  EXPECT_TRUE(s.upper_bound(0) == s.end());
+  auto res = s.insert_many(100, 5);
+  EXPECT_TRUE(res[0].second);
+  EXPECT_FALSE(res[1].second);
+  EXPECT_EQ(*s.begin(), 100);
+}
+
+// Порядок задаётся состоянием компаратора; копия и обмен переносят его
+TEST(btree_set, stateful_compare) {
+  struct directed {
+    explicit directed(bool descending) : descending(descending) {}
+    bool operator()(int a, int b) const { return descending ? b < a : a < b; }
+    bool descending;
+  };
+  s21::btree_set<int, directed> s(directed(true));
+  for (int i = 0; i < 1000; ++i) s.insert(i);
+  EXPECT_EQ(*s.begin(), 999);
+  EXPECT_EQ(*s.upper_bound(500), 499);
+  EXPECT_TRUE(s.contains(7));
+  s21::btree_set<int, directed> copy(s);
+  EXPECT_TRUE(copy.key_comp().descending);
+  EXPECT_EQ(*copy.begin(), 999);
+  s21::btree_set<int, directed> ascending(directed(false));
+  ascending.insert(3);
+  ascending.insert(1);
+  ascending.swap(copy);
+  EXPECT_EQ(*copy.begin(), 1);
+  EXPECT_EQ(*ascending.begin(), 999);
+  EXPECT_EQ(ascending.erase(999), 1U);
+  EXPECT_EQ(*ascending.begin(), 998);
+}
+
+TEST(btree_set, sequential_fill) {
+  s21::btree_set<int> s;
+  for (int i = 0; i < 100000; ++i) s.insert(i);
+  EXPECT_LE(s.height(), 4U);
+  for (int i = 99999; i >= 0; --i) s.erase(i);
+  EXPECT_TRUE(s.empty());
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(concurrent_map, constructor) {
+  s21::concurrent_map<int, int> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.shard_count(), 64U);
+  s21::concurrent_map<int, int> m2(10);
+  EXPECT_EQ(m2.shard_count(), 16U);
+}
+
+TEST(concurrent_map, insert_find) {
+  s21::concurrent_map<std::string, int> m(4);
+  EXPECT_TRUE(m.insert("a", 1));
+  EXPECT_FALSE(m.insert("a", 2));
+  EXPECT_EQ(m.find("a").value(), 1);
+  EXPECT_FALSE(m.find("b").has_value());
+  EXPECT_TRUE(m.contains("a"));
+  EXPECT_FALSE(m.contains("b"));
+}
+
+TEST(concurrent_map, insert_or_assign) {
+  s21::concurrent_map<int, std::string> m(4);
+  EXPECT_TRUE(m.insert_or_assign(1, "one"));
+  EXPECT_FALSE(m.insert_or_assign(1, "uno"));
+  EXPECT_EQ(m.find(1).value(), "uno");
+  EXPECT_EQ(m.size(), 1U);
+}
+
+TEST(concurrent_map, erase_clear) {
+  s21::concurrent_map<int, int> m(4);
+  for (int i = 0; i < 100; ++i) m.insert(i, i);
+  EXPECT_EQ(m.erase(5), 1U);
+  EXPECT_EQ(m.erase(5), 0U);
+  EXPECT_EQ(m.size(), 99U);
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.insert(5, 5));
+}
+
+TEST(concurrent_map, visit) {
+  s21::concurrent_map<int, int> m(4);
+  m.insert(1, 10);
+  EXPECT_TRUE(m.visit(1, [](int &value) { value += 5; }));
+  EXPECT_FALSE(m.visit(2, [](int &value) { value += 5; }));
+  EXPECT_EQ(m.find(1).value(), 15);
+}
+
+TEST(concurrent_map, for_each) {
+  s21::concurrent_map<int, int> m(8);
+  for (int i = 1; i <= 100; ++i) m.insert(i, i * 2);
+  long keys = 0;
+  long values = 0;
+  m.for_each([&](const int &key, const int &value) {
+    keys += key;
+    values += value;
+  });
+  EXPECT_EQ(keys, 5050);
+  EXPECT_EQ(values, 10100);
+}
+
+TEST(concurrent_map, parallel_insert) {
+  s21::concurrent_map<int, int> m(16);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&m, t] {
+      for (int i = 0; i < 1000; ++i) m.insert(t * 1000 + i, t);
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(m.size(), 8000U);
+  for (int i = 0; i < 8000; ++i) EXPECT_EQ(m.find(i).value(), i / 1000);
+}
+
+TEST(concurrent_map, parallel_visit) {
+  s21::concurrent_map<int, int> m(4);
+  for (int key = 0; key < 10; ++key) m.insert(key, 0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&m] {
+      for (int i = 0; i < 1000; ++i) {
+        m.visit(i % 10, [](int &value) { ++value; });
+        m.find(i % 10);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  long total = 0;
+  m.for_each([&](const int &, const int &value) { total += value; });
+  EXPECT_EQ(total, 8000);
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(counted_multiset, constructor) {
+  s21::counted_multiset<int> s;
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.begin(), s.end());
+  s21::counted_multiset<std::string> s2{"b", "a", "b", "b"};
+  EXPECT_EQ(s2.size(), 4U);
+  EXPECT_EQ(s2.distinct(), 2U);
+  s21::counted_multiset<std::string> s3(s2);
+  EXPECT_EQ(s3.count("b"), 3U);
+  s21::counted_multiset<std::string> s4(std::move(s3));
+  EXPECT_TRUE(s3.empty());
+  EXPECT_EQ(s4.size(), 4U);
+  s3 = s4;
+  EXPECT_EQ(s3.count("a"), 1U);
+}
+
+TEST(counted_multiset, iteration_yields_every_copy) {
+  s21::counted_multiset<int> s{3, 1, 3, 2, 3, 1};
+  std::vector<int> forward(s.begin(), s.end());
+  EXPECT_EQ(forward, (std::vector<int>{1, 1, 2, 3, 3, 3}));
+  std::vector<int> backward;
+  for (auto it = s.end(); it != s.begin();) backward.push_back(*--it);
+  EXPECT_EQ(backward, (std::vector<int>{3, 3, 3, 2, 1, 1}));
+}
+
+TEST(counted_multiset, insert_erase) {
+  s21::counted_multiset<int> s;
+  auto res = s.insert(5);
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(*res.first, 5);
+  s.insert(5);
+  auto it = s.insert(5, 10);
+  EXPECT_EQ(std::distance(s.begin(), it), 2);
+  EXPECT_EQ(s.count(5), 12U);
+  EXPECT_EQ(s.distinct(), 1U);
+  s.insert(7, 0);
+  EXPECT_FALSE(s.contains(7));
+  s.erase(s.find(5));
+  EXPECT_EQ(s.count(5), 11U);
+  EXPECT_EQ(s.erase(5), 11U);
+  EXPECT_EQ(s.erase(5), 0U);
+  EXPECT_TRUE(s.empty());
+  s.insert(1);
+  s.erase(s.begin());
+  EXPECT_EQ(s.distinct(), 0U);
+  EXPECT_EQ(s.begin(), s.end());
+}
+
+TEST(counted_multiset, lookup) {
+  s21::counted_multiset<int> s;
+  s.insert_many(10, 20, 20, 30, 30, 30);
+  EXPECT_EQ(*s.find(20), 20);
+  EXPECT_EQ(s.find(25), s.end());
+  EXPECT_EQ(s.count(30), 3U);
+  EXPECT_EQ(s.count(40), 0U);
+  auto range = s.equal_range(20);
+  EXPECT_EQ(std::distance(range.first, range.second), 2);
+  EXPECT_EQ(*range.second, 30);
+  range = s.equal_range(25);
+  EXPECT_EQ(range.first, range.second);
+  EXPECT_EQ(*s.lower_bound(15), 20);
+  EXPECT_EQ(*s.upper_bound(20), 30);
+  EXPECT_EQ(s.upper_bound(30), s.end());
+}
+
+TEST(counted_multiset, transparent_lookup) {
+  const s21::counted_multiset<std::string, std::less<>> s{"a", "b", "b"};
+  EXPECT_EQ(s.count("b"), 2U);
+  EXPECT_EQ(*s.find("a"), "a");
+  EXPECT_EQ(*s.lower_bound("aa"), "b");
+}
+
+// Ключи эквивалентны по остатку от деления на modulus из компаратора
+TEST(counted_multiset, stateful_compare) {
+  struct by_remainder {
+    explicit by_remainder(int modulus) : modulus(modulus) {}
+    bool operator()(int a, int b) const { return a % modulus < b % modulus; }
+    int modulus;
+  };
+  s21::counted_multiset<int, by_remainder> s(by_remainder(10));
+  s.insert_many(3, 23, 13, 5, 15);
+  EXPECT_EQ(s.size(), 5U);
+  EXPECT_EQ(s.count(33), 3U);
+  auto range = s.equal_range(43);
+  EXPECT_EQ(std::distance(range.first, range.second), 3);
+  EXPECT_EQ(*range.second, 5);
+  range = s.equal_range(4);
+  EXPECT_EQ(range.first, range.second);
+  EXPECT_EQ(s.key_comp().modulus, 10);
+}
+
+TEST(counted_multiset, merge_swap) {
+  s21::counted_multiset<int> a{1, 2, 2};
+  s21::counted_multiset<int> b{2, 3};
+  a.merge(b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.size(), 5U);
+  EXPECT_EQ(a.count(2), 3U);
+  a.swap(b);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b.count(3), 1U);
+  b.clear();
+  EXPECT_EQ(b.size(), 0U);
+}
+
+TEST(counted_multiset, matches_std_multiset) {
+  s21::counted_multiset<int, std::greater<int>> s;
+  std::multiset<int, std::greater<int>> expected;
+  for (int i = 0; i < 3000; ++i) {
+    int key = (i * 7919) % 50;
+    if (i % 4 == 0 && s.contains(key)) {
+      s.erase(s.find(key));
+      expected.erase(expected.find(key));
+    } else {
+      s.insert(key);
+      expected.insert(key);
+    }
+  }
+  EXPECT_EQ(s.size(), expected.size());
+  EXPECT_TRUE(std::equal(s.begin(), s.end(), expected.begin(), expected.end()));
+  for (int key = 0; key < 50; ++key) {
+    EXPECT_EQ(s.count(key), expected.count(key));
+  }
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(indexed_heap, push_pop_order) {
+  s21::indexed_heap<int, double> h;
+  EXPECT_TRUE(h.empty());
+  EXPECT_THROW(h.top(), std::out_of_range);
+  EXPECT_THROW(h.pop(), std::out_of_range);
+  EXPECT_TRUE(h.push(3, 0.5));
+  EXPECT_TRUE(h.push(10, 0.1));
+  EXPECT_TRUE(h.push(0, 2.0));
+  EXPECT_FALSE(h.push(3, 0.0));
+  EXPECT_THROW(h.push(-1, 1.0), std::out_of_range);
+  EXPECT_EQ(h.size(), 3U);
+  EXPECT_EQ(h.top(), std::make_pair(10, 0.1));
+  h.pop();
+  EXPECT_FALSE(h.contains(10));
+  EXPECT_EQ(h.top().first, 3);
+  h.pop();
+  EXPECT_EQ(h.top().first, 0);
+  h.pop();
+  EXPECT_TRUE(h.empty());
+}
+
+TEST(indexed_heap, change_keys) {
+  s21::indexed_heap<int, int> h(8);
+  for (int key = 0; key < 8; ++key) h.push(key, 10 + key);
+  h.decrease_key(7, 1);
+  EXPECT_EQ(h.top().first, 7);
+  EXPECT_EQ(h.priority(7), 1);
+  h.increase_key(7, 100);
+  EXPECT_EQ(h.top().first, 0);
+  h.decrease_key(5, 15);
+  EXPECT_EQ(h.priority(5), 15);
+  EXPECT_THROW(h.decrease_key(0, 50), std::invalid_argument);
+  EXPECT_THROW(h.increase_key(0, 5), std::invalid_argument);
+  EXPECT_THROW(h.decrease_key(42, 0), std::out_of_range);
+  EXPECT_THROW(h.priority(-3), std::out_of_range);
+  EXPECT_FALSE(h.contains(42));
+}
+
+TEST(indexed_heap, erase) {
+  s21::indexed_heap<unsigned, int> h;
+  for (unsigned key = 0; key < 20; ++key) h.push(key, (key * 7) % 20);
+  EXPECT_TRUE(h.erase(0));
+  EXPECT_FALSE(h.erase(0));
+  EXPECT_FALSE(h.erase(100));
+  EXPECT_TRUE(h.erase(19));
+  EXPECT_TRUE(h.erase(10));
+  EXPECT_EQ(h.size(), 17U);
+  int previous = -1;
+  while (!h.empty()) {
+    EXPECT_GE(h.top().second, previous);
+    previous = h.top().second;
+    h.pop();
+  }
+}
+
+// Случайные операции сверяются с std::map ключ -> приоритет
+TEST(indexed_heap, matches_reference) {
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> key_dist(0, 199);
+  std::uniform_int_distribution<int> priority_dist(0, 999);
+  s21::indexed_heap<int, int, std::less<int>, 2> h;
+  std::map<int, int> expected;
+  for (int step = 0; step < 20000; ++step) {
+    int key = key_dist(gen);
+    int priority = priority_dist(gen);
+    switch (step % 5) {
+      case 0:
+      case 1:
+        EXPECT_EQ(h.push(key, priority),
+                  expected.emplace(key, priority).second);
+        break;
+      case 2:
+        if (expected.count(key)) {
+          if (priority <= expected[key]) {
+            h.decrease_key(key, priority);
+          } else {
+            h.increase_key(key, priority);
+          }
+          expected[key] = priority;
+        }
+        break;
+      case 3:
+        EXPECT_EQ(h.erase(key), expected.erase(key) == 1);
+        break;
+      default:
+        if (!expected.empty()) {
+          auto best = expected.begin();
+          for (auto it = expected.begin(); it != expected.end(); ++it) {
+            if (it->second < best->second) best = it;
+          }
+          EXPECT_EQ(h.top().second, best->second);
+          expected.erase(h.top().first);
+          h.pop();
+        }
+    }
+    ASSERT_EQ(h.size(), expected.size());
+  }
+}
+
+TEST(indexed_heap, dijkstra) {
+  // Рёбра (из, в, вес)
+  std::vector<std::vector<std::pair<int, int>>> graph(6);
+  auto edge = [&](int from, int to, int weight) {
+    graph[from].push_back({to, weight});
+    graph[to].push_back({from, weight});
+  };
+  edge(0, 1, 7);
+  edge(0, 2, 9);
+  edge(0, 5, 14);
+  edge(1, 2, 10);
+  edge(1, 3, 15);
+  edge(2, 3, 11);
+  edge(2, 5, 2);
+  edge(3, 4, 6);
+  edge(4, 5, 9);
+  std::vector<int> dist(6, -1);
+  s21::indexed_heap<int, int> frontier(graph.size());
+  frontier.push(0, 0);
+  while (!frontier.empty()) {
+    auto [vertex, d] = frontier.top();
+    frontier.pop();
+    dist[vertex] = d;
+    for (auto [to, weight] : graph[vertex]) {
+      if (dist[to] != -1) continue;
+      int candidate = d + weight;
+      if (!frontier.push(to, candidate) &&
+          candidate < frontier.priority(to)) {
+        frontier.decrease_key(to, candidate);
+      }
+    }
+  }
+  EXPECT_EQ(dist, (std::vector<int>{0, 7, 9, 20, 20, 11}));
+}
+
+TEST(indexed_heap, max_heap_clear_swap) {
+  s21::indexed_heap<long, std::string, std::greater<std::string>> h;
+  h.push(1, "apple");
+  h.push(2, "pear");
+  h.push(3, "fig");
+  EXPECT_EQ(h.top().second, "pear");
+  h.decrease_key(1, "zucchini");
+  EXPECT_EQ(h.top().first, 1);
+  s21::indexed_heap<long, std::string, std::greater<std::string>> other;
+  other.swap(h);
+  EXPECT_TRUE(h.empty());
+  EXPECT_EQ(other.size(), 3U);
+  other.clear();
+  EXPECT_TRUE(other.empty());
+  EXPECT_FALSE(other.contains(2));
+  EXPECT_TRUE(other.push(2, "kiwi"));
+  EXPECT_EQ(other.top().second, "kiwi");
+}
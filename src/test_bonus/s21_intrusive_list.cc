@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+struct timer {
+  explicit timer(int d, int i = 0) : deadline(d), id(i) {}
+
+  bool operator<(const timer &other) const { return deadline < other.deadline; }
+  bool operator==(const timer &other) const {
+    return deadline == other.deadline;
+  }
+
+  int deadline;
+  int id;
+  s21::list_hook hook;
+  s21::list_hook lru_hook;
+};
+
+using timer_list = s21::intrusive_list<timer, &timer::hook>;
+using lru_list = s21::intrusive_list<timer, &timer::lru_hook>;
+
+// Не standard-layout: виртуальные методы и база с данными
+struct named {
+  virtual ~named() = default;
+  virtual int weight() const { return 1; }
+  int tag = 0;
+};
+
+struct job : named {
+  explicit job(int w) : w_(w) {}
+  int weight() const override { return w_; }
+  s21::list_hook hook;
+
+ private:
+  int w_;
+};
+
+std::vector<int> deadlines(const timer_list &l) {
+  std::vector<int> result;
+  for (const auto &t : l) result.push_back(t.deadline);
+  return result;
+}
+}  // namespace
+
+TEST(intrusive_list, push_pop) {
+  timer a(1), b(2), c(3);
+  timer_list l;
+  EXPECT_TRUE(l.empty());
+  EXPECT_EQ(l.begin(), l.end());
+  EXPECT_THROW(l.front(), std::out_of_range);
+  l.push_back(b);
+  l.push_back(c);
+  l.push_front(a);
+  EXPECT_EQ(l.size(), 3U);
+  EXPECT_EQ(&l.front(), &a);
+  EXPECT_EQ(&l.back(), &c);
+  EXPECT_EQ(deadlines(l), (std::vector<int>{1, 2, 3}));
+  EXPECT_THROW(l.push_back(a), std::logic_error);
+  l.pop_front();
+  l.pop_back();
+  EXPECT_FALSE(a.hook.is_linked());
+  EXPECT_TRUE(b.hook.is_linked());
+  EXPECT_EQ(&l.front(), &b);
+  l.clear();
+  EXPECT_FALSE(b.hook.is_linked());
+  EXPECT_TRUE(l.empty());
+}
+
+TEST(intrusive_list, unlink_from_anywhere) {
+  timer a(1), b(2), c(3);
+  timer_list l;
+  l.push_back(a);
+  l.push_back(b);
+  l.push_back(c);
+  l.erase(b);
+  EXPECT_EQ(deadlines(l), (std::vector<int>{1, 3}));
+  c.hook.unlink();
+  EXPECT_EQ(deadlines(l), (std::vector<int>{1}));
+  auto it = l.insert(timer_list::iterator_to(a), c);
+  EXPECT_EQ(&*it, &c);
+  EXPECT_EQ(it->deadline, 3);
+  it = l.erase(it);
+  EXPECT_EQ(&*it, &a);
+  EXPECT_EQ(l.size(), 1U);
+}
+
+TEST(intrusive_list, auto_unlink_on_destruction) {
+  timer_list l;
+  timer a(1);
+  l.push_back(a);
+  {
+    auto b = std::make_unique<timer>(2);
+    l.push_back(*b);
+    timer copy(*b);
+    EXPECT_FALSE(copy.hook.is_linked());
+    EXPECT_EQ(l.size(), 2U);
+  }
+  EXPECT_EQ(l.size(), 1U);
+  EXPECT_EQ(&l.back(), &a);
+  auto c = std::make_unique<timer>(3);
+  {
+    timer_list scoped;
+    scoped.push_back(*c);
+  }
+  EXPECT_FALSE(c->hook.is_linked());
+}
+
+TEST(intrusive_list, two_hooks) {
+  timer a(1), b(2);
+  timer_list timers;
+  lru_list lru;
+  timers.push_back(a);
+  timers.push_back(b);
+  lru.push_back(b);
+  lru.push_back(a);
+  timers.erase(a);
+  EXPECT_EQ(&lru.back(), &a);
+  EXPECT_EQ(lru.size(), 2U);
+  EXPECT_EQ(timers.size(), 1U);
+}
+
+TEST(intrusive_list, iteration_and_reverse) {
+  std::vector<std::unique_ptr<timer>> pool;
+  timer_list l;
+  for (int i = 0; i < 5; ++i) {
+    pool.push_back(std::make_unique<timer>(i));
+    l.push_back(*pool.back());
+  }
+  l.reverse();
+  EXPECT_EQ(deadlines(l), (std::vector<int>{4, 3, 2, 1, 0}));
+  std::vector<int> backward;
+  for (auto it = l.end(); it != l.begin();) {
+    backward.push_back((--it)->deadline);
+  }
+  EXPECT_EQ(backward, (std::vector<int>{0, 1, 2, 3, 4}));
+  for (auto &t : l) t.deadline *= 10;
+  EXPECT_EQ(l.front().deadline, 40);
+}
+
+TEST(intrusive_list, splice_swap_move) {
+  timer a(1), b(2), c(3), d(4);
+  timer_list x, y;
+  x.push_back(a);
+  x.push_back(d);
+  y.push_back(b);
+  y.push_back(c);
+  x.splice(timer_list::iterator_to(d), y);
+  EXPECT_TRUE(y.empty());
+  EXPECT_EQ(deadlines(x), (std::vector<int>{1, 2, 3, 4}));
+  y.splice(y.end(), x, timer_list::iterator_to(c));
+  EXPECT_EQ(deadlines(y), (std::vector<int>{3}));
+  y.splice(y.begin(), x, x.begin(), timer_list::iterator_to(d));
+  EXPECT_EQ(deadlines(y), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(deadlines(x), (std::vector<int>{4}));
+  x.splice(x.begin(), x, timer_list::iterator_to(d));
+  EXPECT_EQ(deadlines(x), (std::vector<int>{4}));
+  x.swap(y);
+  EXPECT_EQ(deadlines(x), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(deadlines(y), (std::vector<int>{4}));
+  timer_list empty;
+  y.swap(empty);
+  EXPECT_TRUE(y.empty());
+  EXPECT_EQ(deadlines(empty), (std::vector<int>{4}));
+  timer_list moved(std::move(x));
+  EXPECT_TRUE(x.empty());
+  EXPECT_EQ(moved.size(), 3U);
+  x = std::move(moved);
+  EXPECT_EQ(x.size(), 3U);
+  EXPECT_TRUE(moved.empty());
+  EXPECT_THROW(moved.push_back(d), std::logic_error);
+}
+
+TEST(intrusive_list, sort_merge_unique) {
+  std::vector<std::unique_ptr<timer>> pool;
+  timer_list l;
+  for (int i = 0; i < 40; ++i) {
+    pool.push_back(std::make_unique<timer>((i * 7) % 5, i));
+    l.push_back(*pool.back());
+  }
+  l.sort();
+  const timer *prev = nullptr;
+  for (const auto &t : l) {
+    if (prev) {
+      EXPECT_LE(prev->deadline, t.deadline);
+      if (prev->deadline == t.deadline) {
+        EXPECT_LT(prev->id, t.id);
+      }
+    }
+    prev = &t;
+  }
+  l.unique();
+  EXPECT_EQ(deadlines(l), (std::vector<int>{0, 1, 2, 3, 4}));
+
+  timer a(1), b(5), c(2), d(6);
+  timer_list x, y;
+  x.push_back(a);
+  x.push_back(b);
+  y.push_back(c);
+  y.push_back(d);
+  x.merge(y);
+  EXPECT_TRUE(y.empty());
+  EXPECT_EQ(deadlines(x), (std::vector<int>{1, 2, 5, 6}));
+  x.sort([](const timer &p, const timer &q) { return q < p; });
+  EXPECT_EQ(deadlines(x), (std::vector<int>{6, 5, 2, 1}));
+}
+
+TEST(intrusive_list, non_standard_layout) {
+  job a(1), b(2), c(3);
+  s21::intrusive_list<job, &job::hook> l;
+  l.push_back(b);
+  l.push_front(a);
+  l.insert(l.end(), c);
+  int sum = 0;
+  for (const job &j : l) sum = sum * 10 + j.weight();
+  EXPECT_EQ(sum, 123);
+  l.sort([](const job &x, const job &y) { return x.weight() > y.weight(); });
+  EXPECT_EQ(&l.front(), &c);
+  EXPECT_EQ(l.back().weight(), 1);
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+// producers потоков кладут свои числа, consumers потоков снимают их, пока
+// не снимут все. Каждое число должно прийти ровно один раз
+void stress(int producers, int consumers, int items) {
+  s21::lockfree_stack<int> s;
+  std::vector<std::atomic<int>> seen(producers * items);
+  std::atomic<int> received{0};
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&, p] {
+      for (int i = 0; i < items; ++i) s.push(p * items + i);
+    });
+  }
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&] {
+      while (received.load() < producers * items) {
+        if (auto value = s.pop()) {
+          seen[*value]++;
+          received++;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  for (auto &count : seen) EXPECT_EQ(count.load(), 1);
+  EXPECT_TRUE(s.empty());
+}
+}  // namespace
+
+TEST(lockfree_stack, lifo_order) {
+  s21::lockfree_stack<std::string> s;
+  EXPECT_TRUE(s.empty());
+  EXPECT_FALSE(s.pop().has_value());
+  std::string a = "a";
+  s.push(a);
+  s.push(std::string("b"));
+  s.emplace(3, 'c');
+  EXPECT_FALSE(s.empty());
+  EXPECT_EQ(*s.pop(), "ccc");
+  EXPECT_EQ(*s.pop(), "b");
+  EXPECT_EQ(*s.pop(), "a");
+  EXPECT_FALSE(s.pop().has_value());
+  EXPECT_TRUE(s.empty());
+}
+
+TEST(lockfree_stack, move_only_and_destructor) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::lockfree_stack<std::shared_ptr<int>> s;
+    for (int i = 0; i < 10; ++i) s.push(counter);
+    EXPECT_EQ(counter.use_count(), 11);
+    EXPECT_EQ(s.pop()->get(), counter.get());
+  }
+  // Оставшиеся в стеке узлы удаляются деструктором, снятые - доменом эпох
+  EXPECT_EQ(counter.use_count(), 1);
+
+  s21::lockfree_stack<std::unique_ptr<int>> s;
+  s.push(std::make_unique<int>(7));
+  auto value = s.pop();
+  ASSERT_TRUE(value.has_value());
+  EXPECT_EQ(**value, 7);
+}
+
+// Пул буферов: каждый поток берёт буфер из стека или создаёт новый и
+// возвращает его обратно
+TEST(lockfree_stack, free_list) {
+  s21::lockfree_stack<std::unique_ptr<std::vector<char>>> pool;
+  std::atomic<int> created{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 2000; ++i) {
+        auto buffer = pool.pop();
+        if (!buffer) {
+          buffer = std::make_unique<std::vector<char>>(64);
+          created++;
+        }
+        (**buffer)[0] = 1;
+        pool.push(std::move(*buffer));
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  int pooled = 0;
+  while (pool.pop()) ++pooled;
+  EXPECT_EQ(pooled, created.load());
+  EXPECT_LE(created.load(), 4);
+}
+
+TEST(lockfree_stack, threads) {
+  stress(1, 1, 20000);
+  stress(4, 4, 5000);
+  stress(1, 4, 10000);
+}
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(lru_cache, evicts_least_recently_used) {
+  s21::lru_cache<int, std::string> cache(3);
+  EXPECT_TRUE(cache.put(1, "one"));
+  cache.put(2, "two");
+  cache.put(3, "three");
+  ASSERT_NE(cache.get(1), nullptr);
+  EXPECT_EQ(*cache.get(1), "one");
+  cache.put(4, "four");
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_EQ(cache.get(2), nullptr);
+  // peek не продвигает запись: следующей вытесняется 3
+  EXPECT_EQ(*cache.peek(3), "three");
+  cache.put(5, "five");
+  EXPECT_FALSE(cache.contains(3));
+  EXPECT_EQ(cache.size(), 3U);
+  auto stats = cache.statistics();
+  EXPECT_EQ(stats.hits, 2U);
+  EXPECT_EQ(stats.misses, 1U);
+  EXPECT_EQ(stats.evictions, 2U);
+  cache.reset_statistics();
+  EXPECT_EQ(cache.statistics().hits, 0U);
+}
+
+TEST(lru_cache, put_replaces_and_erase) {
+  s21::lru_cache<int, std::string> cache(2);
+  std::vector<int> evicted;
+  cache.on_evict(
+      [&](const int &key, std::string &) { evicted.push_back(key); });
+  cache.put(1, "one");
+  cache.put(2, "two");
+  cache.put(1, "uno");
+  cache.put(3, "three");
+  EXPECT_EQ(*cache.get(1), "uno");
+  EXPECT_EQ(evicted, std::vector<int>{2});
+  EXPECT_TRUE(cache.erase(1));
+  EXPECT_FALSE(cache.erase(1));
+  cache.clear();
+  EXPECT_TRUE(cache.empty());
+  // Удаление и очистка не считаются вытеснением
+  EXPECT_EQ(evicted, std::vector<int>{2});
+}
+
+TEST(lru_cache, capacity_in_bytes) {
+  s21::lru_cache<std::string, std::string> cache(
+      10, [](const std::string &, const std::string &value) {
+        return value.size();
+      });
+  std::vector<std::pair<std::string, std::string>> evicted;
+  cache.on_evict([&](const std::string &key, std::string &value) {
+    evicted.emplace_back(key, std::move(value));
+  });
+  cache.put("a", "1234");
+  cache.put("b", "1234");
+  EXPECT_EQ(cache.weight(), 8U);
+  cache.put("c", "123");
+  EXPECT_EQ(cache.weight(), 7U);
+  ASSERT_EQ(evicted.size(), 1U);
+  EXPECT_EQ(evicted[0].first, "a");
+  EXPECT_EQ(evicted[0].second, "1234");
+  // Рост записи вытесняет другие, но не её саму
+  cache.put("c", "123456789");
+  EXPECT_EQ(cache.size(), 1U);
+  EXPECT_TRUE(cache.contains("c"));
+  // Запись тяжелее ёмкости не сохраняется и убирает старое значение
+  EXPECT_FALSE(cache.put("c", "12345678901"));
+  EXPECT_TRUE(cache.empty());
+  EXPECT_EQ(cache.weight(), 0U);
+}
+
+// Вес защищённой записи slru меняется при замене значения
+TEST(lru_cache, slru_reweighs_protected_entry) {
+  s21::lru_cache<int, std::string, s21::cache_policy::slru> cache(
+      10, [](const int &, const std::string &value) { return value.size(); });
+  cache.put(1, "a");
+  cache.get(1);
+  cache.put(1, std::string(10, 'b'));
+  EXPECT_EQ(cache.weight(), 10U);
+  EXPECT_TRUE(cache.erase(1));
+  EXPECT_EQ(cache.weight(), 0U);
+  cache.put(2, "cc");
+  cache.put(3, "ddd");
+  ASSERT_NE(cache.get(2), nullptr);
+  EXPECT_EQ(*cache.get(2), "cc");
+  EXPECT_EQ(cache.size(), 2U);
+  EXPECT_EQ(cache.weight(), 5U);
+}
+
+// Однократный проход по множеству новых ключей не вымывает записи, к
+// которым обращались повторно
+TEST(lru_cache, slru_resists_scans) {
+  s21::lru_cache<int, int, s21::cache_policy::slru> slru(10);
+  s21::lru_cache<int, int> lru(10);
+  for (int key = 0; key < 5; ++key) {
+    slru.put(key, key);
+    lru.put(key, key);
+    slru.get(key);
+    lru.get(key);
+  }
+  for (int key = 100; key < 200; ++key) {
+    slru.put(key, key);
+    lru.put(key, key);
+  }
+  for (int key = 0; key < 5; ++key) {
+    EXPECT_TRUE(slru.contains(key));
+    EXPECT_FALSE(lru.contains(key));
+  }
+  EXPECT_EQ(slru.size(), 10U);
+  // Переполнение защищённого сегмента возвращает его хвост в испытательный
+  for (int key = 100; key < 110; ++key) {
+    slru.put(key, key);
+    slru.get(key);
+  }
+  EXPECT_EQ(slru.size(), 10U);
+  for (int key = 0; key < 5; ++key) EXPECT_FALSE(slru.contains(key));
+}
+
+TEST(lru_cache, lfu_evicts_least_frequent) {
+  s21::lru_cache<int, int, s21::cache_policy::lfu> cache(3);
+  cache.put(1, 1);
+  cache.put(2, 2);
+  cache.put(3, 3);
+  for (int i = 0; i < 3; ++i) cache.get(1);
+  cache.get(3);
+  cache.put(4, 4);
+  EXPECT_FALSE(cache.contains(2));
+  // У 4 одно обращение, у 3 - два
+  cache.put(5, 5);
+  EXPECT_FALSE(cache.contains(4));
+  EXPECT_TRUE(cache.contains(1));
+  EXPECT_TRUE(cache.contains(3));
+  // Среди равных по частоте вытесняется давняя запись
+  cache.get(5);
+  cache.put(6, 6);
+  EXPECT_FALSE(cache.contains(3));
+  EXPECT_EQ(cache.statistics().evictions, 3U);
+}
+
+template <typename Cache>
+void fillAndCheck(Cache &cache) {
+  for (int key = 0; key < 1000; ++key) {
+    cache.put(key, key * 2);
+    if (key % 3 == 0) cache.get(key / 2);
+  }
+  EXPECT_EQ(cache.size(), 100U);
+  int found = 0;
+  for (int key = 0; key < 1000; ++key) {
+    if (const int *value = cache.peek(key)) {
+      EXPECT_EQ(*value, key * 2);
+      ++found;
+    }
+  }
+  EXPECT_EQ(found, 100);
+}
+
+TEST(lru_cache, tree_index) {
+  s21::lru_cache<int, int, s21::cache_policy::lru, s21::map> by_map(100);
+  s21::lru_cache<int, int, s21::cache_policy::lfu, s21::btree_map> by_btree(
+      100);
+  s21::lru_cache<int, int, s21::cache_policy::slru> by_hash(100);
+  fillAndCheck(by_map);
+  fillAndCheck(by_btree);
+  fillAndCheck(by_hash);
+}
@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+// Сообщение несёт номер производителя и свой порядковый номер
+struct message {
+  int producer;
+  int seq;
+};
+
+struct throws_on_copy {
+  throws_on_copy() = default;
+  throws_on_copy(const throws_on_copy &) { throw std::runtime_error("copy"); }
+  throws_on_copy(throws_on_copy &&) noexcept = default;
+  throws_on_copy &operator=(const throws_on_copy &) = default;
+  throws_on_copy &operator=(throws_on_copy &&) noexcept = default;
+};
+
+// producers потоков кладут по items сообщений, consumers потоков забирают
+// их, проверяя, что сообщения каждого производителя идут по порядку
+void stress(int producers, int consumers, int items, bool batches) {
+  s21::mpmc_queue<message> q(64);
+  std::atomic<int> received{0};
+  std::atomic<bool> ordered{true};
+  std::vector<std::atomic<long long>> sums(producers);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&, p] {
+      if (!batches) {
+        for (int i = 0; i < items; ++i) q.push(message{p, i});
+        return;
+      }
+      std::vector<message> batch;
+      for (int i = 0; i < items;) {
+        batch.clear();
+        for (int k = i; k < items && k < i + 8; ++k) {
+          batch.push_back(message{p, k});
+        }
+        size_t done = q.try_push_batch(batch.begin(), batch.end());
+        if (done == 0) std::this_thread::yield();
+        i += static_cast<int>(done);
+      }
+    });
+  }
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&] {
+      std::vector<int> last(producers, -1);
+      std::vector<message> out(8);
+      while (received.load() < producers * items) {
+        size_t got = 0;
+        if (batches) {
+          got = q.try_pop_batch(out.begin(), out.size());
+        } else if (q.try_pop(out[0])) {
+          got = 1;
+        }
+        if (got == 0) std::this_thread::yield();
+        for (size_t i = 0; i < got; ++i) {
+          if (out[i].seq <= last[out[i].producer]) ordered = false;
+          last[out[i].producer] = out[i].seq;
+          sums[out[i].producer] += out[i].seq;
+        }
+        received += static_cast<int>(got);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_TRUE(ordered.load());
+  EXPECT_EQ(received.load(), producers * items);
+  for (auto &sum : sums) {
+    EXPECT_EQ(sum.load(), static_cast<long long>(items) * (items - 1) / 2);
+  }
+  EXPECT_TRUE(q.empty());
+}
+}  // namespace
+
+TEST(mpmc_queue, push_pop) {
+  s21::mpmc_queue<std::string> q(3);
+  EXPECT_EQ(q.capacity(), 4U);
+  std::string out;
+  EXPECT_FALSE(q.try_pop(out));
+  EXPECT_TRUE(q.try_push("a"));
+  EXPECT_TRUE(q.try_emplace(2, 'b'));
+  q.push("c");
+  q.emplace("d");
+  EXPECT_FALSE(q.try_push("e"));
+  EXPECT_EQ(q.size_approx(), 4U);
+  EXPECT_EQ(q.pop(), "a");
+  q.pop(out);
+  EXPECT_EQ(out, "bb");
+  EXPECT_TRUE(q.try_push("e"));
+  for (const char *expected : {"c", "d", "e"}) {
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out, expected);
+  }
+  EXPECT_TRUE(q.empty());
+  EXPECT_THROW(s21::mpmc_queue<int>(0), std::invalid_argument);
+}
+
+TEST(mpmc_queue, batches_and_leftovers) {
+  auto tracked = std::make_shared<int>(1);
+  {
+    s21::mpmc_queue<std::shared_ptr<int>> q(8);
+    std::vector<std::shared_ptr<int>> items(10, tracked);
+    EXPECT_EQ(q.try_push_batch(items.begin(), items.end()), 8U);
+    EXPECT_EQ(q.try_push_batch(items.begin(), items.end()), 0U);
+    std::vector<std::shared_ptr<int>> out(5);
+    EXPECT_EQ(q.try_pop_batch(out.begin(), 5), 5U);
+    EXPECT_EQ(q.try_push_batch(items.begin(), items.begin() + 2), 2U);
+    EXPECT_EQ(q.size_approx(), 5U);
+    EXPECT_EQ(tracked.use_count(), 1 + 10 + 5 + 5);
+  }
+  EXPECT_EQ(tracked.use_count(), 1);
+}
+
+// Длина однопроходного диапазона заранее не известна: пакет кончается на
+// last, а не на числе свободных ячеек
+TEST(mpmc_queue, batch_from_input_iterators) {
+  s21::mpmc_queue<int> q(8);
+  std::istringstream input("1 2 3");
+  std::istream_iterator<int> first(input), last;
+  EXPECT_EQ(q.try_push_batch(first, last), 3U);
+  EXPECT_EQ(q.size_approx(), 3U);
+  std::vector<int> out(8);
+  EXPECT_EQ(q.try_pop_batch(out.begin(), out.size()), 3U);
+  EXPECT_EQ(out[0], 1);
+  EXPECT_EQ(out[1], 2);
+  EXPECT_EQ(out[2], 3);
+  EXPECT_TRUE(q.empty());
+  std::istringstream more("4 5 6 7 8 9");
+  s21::mpmc_queue<int> small(4);
+  EXPECT_EQ(small.try_push_batch(std::istream_iterator<int>(more), last), 4U);
+  EXPECT_EQ(small.pop(), 4);
+}
+
+TEST(mpmc_queue, throwing_copy_keeps_queue_usable) {
+  s21::mpmc_queue<throws_on_copy> q(4);
+  throws_on_copy value;
+  EXPECT_THROW(q.try_push(value), std::runtime_error);
+  std::vector<throws_on_copy> items(2);
+  EXPECT_THROW(q.try_push_batch(items.begin(), items.end()),
+               std::runtime_error);
+  EXPECT_TRUE(q.try_push(throws_on_copy()));
+  throws_on_copy out;
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_FALSE(q.try_pop(out));
+}
+
+TEST(mpmc_queue, stress_single_items) {
+  stress(1, 1, 20000, false);
+  stress(4, 4, 5000, false);
+}
+
+TEST(mpmc_queue, stress_batches) {
+  stress(2, 3, 10000, true);
+  stress(3, 2, 10000, true);
+}
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <random>
+#include <set>
 #include <unordered_set>
+#include <vector>
 
 #include "../s21_containersplus.h"
 
@@ -652,3 +655,64 @@ TEST(multiset, range) {
   EXPECT_EQ(*mset.equal_range("a").first, *mset2.equal_range("a").first);
   EXPECT_EQ(*mset2.equal_range("a").second, *mset.equal_range("a").second);
 }
+
+TEST(multiset, count_missing) {
+  s21::multiset<int> mset({1, 1, 3, 5, 5, 5});
+  std::multiset<int> mset2({1, 1, 3, 5, 5, 5});
+  EXPECT_EQ(mset.count(5), mset2.count(5));
+  EXPECT_EQ(mset.count(4), mset2.count(4));
+}
+
+TEST(multiset, bounds_missing) {
+  s21::multiset<int> mset({-1, -19, 1, 1, 3, 5, 5, 8, 55, 100});
+  std::multiset<int> mset2({-1, -19, 1, 1, 3, 5, 5, 8, 55, 100});
+  EXPECT_EQ(*mset.lower_bound(4), *mset2.lower_bound(4));
+  EXPECT_EQ(*mset.upper_bound(4), *mset2.upper_bound(4));
+  EXPECT_EQ(*mset.upper_bound(1), *mset2.upper_bound(1));
+  EXPECT_TRUE(mset.lower_bound(101) == mset.end());
+}
+
+TEST(multiset, custom_compare) {
+  s21::multiset<int, std::greater<int>> mset({3, 1, 3, 2, 3});
+  std::multiset<int, std::greater<int>> mset2({3, 1, 3, 2, 3});
+  EXPECT_EQ(mset.size(), mset2.size());
+  EXPECT_EQ(*mset.begin(), *mset2.begin());
+  EXPECT_EQ(mset.count(3), mset2.count(3));
+  EXPECT_EQ(*mset.upper_bound(3), *mset2.upper_bound(3));
+}
+
+TEST(multiset, transparent_lookup) {
+  s21::multiset<std::string, std::less<>> mset({"a", "b", "b", "c"});
+  std::string_view key = "b";
+  EXPECT_EQ(*mset.find(key), "b");
+  EXPECT_TRUE(mset.contains(key));
+  EXPECT_EQ(mset.count(key), 2U);
+  EXPECT_EQ(*mset.lower_bound(key), "b");
+  EXPECT_EQ(*mset.upper_bound(key), "c");
+}
+
+// Случайные вставки и удаления дубликатов, сверка с std::multiset
+TEST(multiset, RandomAgainstStd) {
+  std::mt19937 gen(21);
+  s21::multiset<int> s;
+  std::multiset<int> expected;
+  for (int round = 0; round < 3000; ++round) {
+    int key = static_cast<int>(gen() % 20);
+    if (gen() % 2 && expected.count(key)) {
+      auto it = s.lower_bound(key);
+      for (size_t skip = gen() % expected.count(key); skip > 0; --skip) ++it;
+      s.erase(it);
+      expected.erase(expected.find(key));
+    } else {
+      s.insert(key);
+      expected.insert(key);
+    }
+    ASSERT_EQ(s.size(), expected.size());
+    ASSERT_EQ(s.count(key), expected.count(key));
+    if (expected.empty()) continue;
+    ASSERT_EQ(*s.begin(), *expected.begin());
+    std::vector<int> items;
+    for (auto it = s.begin(); it != s.end(); ++it) items.push_back(*it);
+    ASSERT_EQ(items, std::vector<int>(expected.begin(), expected.end()));
+  }
+}
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(persistent_map, constructor) {
+  s21::persistent_map<int, int> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.begin(), m.end());
+  s21::persistent_map<int, std::string> m2{{2, "b"}, {1, "a"}, {2, "c"}};
+  EXPECT_EQ(m2.size(), 2U);
+  EXPECT_EQ(m2.at(2), "b");
+  EXPECT_EQ(m2.begin()->first, 1);
+}
+
+TEST(persistent_map, versions_are_independent) {
+  s21::persistent_map<int, std::string> v0;
+  auto v1 = v0.insert(1, "one");
+  auto v2 = v1.insert(2, "two");
+  auto v3 = v2.insert_or_assign(1, "uno");
+  auto v4 = v3.erase(2);
+  EXPECT_TRUE(v0.empty());
+  EXPECT_EQ(v1.size(), 1U);
+  EXPECT_FALSE(v1.contains(2));
+  EXPECT_EQ(v2.size(), 2U);
+  EXPECT_EQ(v2.at(1), "one");
+  EXPECT_EQ(v3.at(1), "uno");
+  EXPECT_EQ(v3.at(2), "two");
+  EXPECT_EQ(v4.size(), 1U);
+  EXPECT_FALSE(v4.contains(2));
+  EXPECT_THROW(v4.at(2), std::out_of_range);
+}
+
+TEST(persistent_map, insert_existing) {
+  auto v1 = s21::persistent_map<int, int>().insert({1, 10});
+  auto v2 = v1.insert(1, 20);
+  EXPECT_EQ(v2.size(), 1U);
+  EXPECT_EQ(v2.at(1), 10);
+  auto v3 = v1.erase(5);
+  EXPECT_EQ(v3.size(), 1U);
+  EXPECT_EQ(v3.count(1), 1U);
+  EXPECT_EQ(v3.count(5), 0U);
+}
+
+TEST(persistent_map, matches_std_map) {
+  s21::persistent_map<int, int> m;
+  std::map<int, int> expected;
+  for (int i = 0; i < 2000; ++i) {
+    int key = (i * 7919) % 1000;
+    if (i % 3 == 0) {
+      m = m.erase(key);
+      expected.erase(key);
+    } else {
+      m = m.insert_or_assign(key, i);
+      expected[key] = i;
+    }
+  }
+  EXPECT_EQ(m.size(), expected.size());
+  auto it = expected.begin();
+  for (const auto &item : m) {
+    EXPECT_EQ(item.first, it->first);
+    EXPECT_EQ(item.second, it->second);
+    ++it;
+  }
+  EXPECT_EQ(it, expected.end());
+}
+
+TEST(persistent_map, bounds) {
+  s21::persistent_map<int, int> m;
+  for (int i = 0; i < 100; i += 10) m = m.insert(i, i);
+  EXPECT_EQ(m.find(30)->second, 30);
+  EXPECT_EQ(m.find(31), m.end());
+  EXPECT_EQ(m.lower_bound(20)->first, 20);
+  EXPECT_EQ(m.lower_bound(21)->first, 30);
+  EXPECT_EQ(m.lower_bound(95), m.end());
+  EXPECT_EQ(m.upper_bound(20)->first, 30);
+  EXPECT_EQ(m.upper_bound(-1)->first, 0);
+  EXPECT_EQ(m.upper_bound(90), m.end());
+  auto it = m.lower_bound(75);
+  std::vector<int> tail;
+  for (; it != m.end(); ++it) tail.push_back(it->first);
+  EXPECT_EQ(tail, (std::vector<int>{80, 90}));
+}
+
+TEST(persistent_map, custom_compare_swap) {
+  s21::persistent_map<int, int, std::greater<int>> a{{1, 1}, {3, 3}, {2, 2}};
+  std::vector<int> keys;
+  for (const auto &item : a) keys.push_back(item.first);
+  EXPECT_EQ(keys, (std::vector<int>{3, 2, 1}));
+  s21::persistent_map<int, int, std::greater<int>> b;
+  a.swap(b);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b.size(), 3U);
+  EXPECT_TRUE(b.clear().empty());
+  EXPECT_EQ(b.size(), 3U);
+}
+
+// Версии, полученные вставкой, удалением и clear, сохраняют компаратор
+TEST(persistent_map, stateful_compare) {
+  struct directed {
+    explicit directed(bool descending) : descending(descending) {}
+    bool operator()(int a, int b) const { return descending ? b < a : a < b; }
+    bool descending;
+  };
+  using map_type = s21::persistent_map<int, int, directed>;
+  map_type empty(directed(true));
+  map_type v1 = empty.insert(1, 1).insert(3, 3).insert(2, 2);
+  map_type v2 = v1.erase(2).insert_or_assign(5, 5);
+  std::vector<int> keys;
+  for (const auto &item : v2) keys.push_back(item.first);
+  EXPECT_EQ(keys, (std::vector<int>{5, 3, 1}));
+  EXPECT_EQ(v1.lower_bound(4)->first, 3);
+  EXPECT_TRUE(v2.clear().key_comp().descending);
+  map_type ascending(directed(false));
+  ascending.swap(v2);
+  EXPECT_TRUE(ascending.key_comp().descending);
+  EXPECT_FALSE(v2.key_comp().descending);
+}
+
+TEST(persistent_map, atomic_version) {
+  using table = s21::persistent_map<int, int>;
+  s21::atomic_version<table> current;
+  const int writers = 2, readers = 2, updates = 500;
+  std::atomic<bool> done{false};
+  std::vector<std::thread> pool;
+  for (int w = 0; w < writers; ++w) {
+    pool.emplace_back([&, w] {
+      for (int i = 0; i < updates; ++i) {
+        current.update(
+            [&](const table &t) { return t.insert(w * updates + i, i); });
+      }
+    });
+  }
+  for (int r = 0; r < readers; ++r) {
+    pool.emplace_back([&] {
+      while (!done.load()) {
+        table snapshot = current.load();
+        size_t seen = 0;
+        for (auto it = snapshot.begin(); it != snapshot.end(); ++it) ++seen;
+        EXPECT_EQ(seen, snapshot.size());
+      }
+    });
+  }
+  for (int w = 0; w < writers; ++w) pool[w].join();
+  done.store(true);
+  for (int r = 0; r < readers; ++r) pool[writers + r].join();
+  EXPECT_EQ(current.load().size(), size_t(writers * updates));
+  current.store(table());
+  EXPECT_TRUE(current.load().empty());
+}
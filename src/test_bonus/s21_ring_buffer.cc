@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+template <typename Buffer>
+std::vector<typename Buffer::value_type> items(const Buffer &b) {
+  return std::vector<typename Buffer::value_type>(b.begin(), b.end());
+}
+}  // namespace
+
+TEST(ring_buffer, constructor) {
+  s21::ring_buffer<int> runtime(5);
+  EXPECT_TRUE(runtime.empty());
+  EXPECT_EQ(runtime.capacity(), 5U);
+  EXPECT_THROW(runtime.front(), std::out_of_range);
+  EXPECT_THROW(runtime.pop_back(), std::out_of_range);
+  EXPECT_THROW(s21::ring_buffer<int>(0), std::invalid_argument);
+  s21::ring_buffer<int, 8> fixed;
+  EXPECT_EQ(fixed.capacity(), 8U);
+  EXPECT_EQ(fixed.policy(), s21::ring_policy::overwrite);
+  EXPECT_THROW((s21::ring_buffer<int, 8>(4)), std::invalid_argument);
+  s21::ring_buffer<std::string> filled(3, {"a", "b"});
+  EXPECT_EQ(filled.size(), 2U);
+  EXPECT_EQ(filled.back(), "b");
+}
+
+TEST(ring_buffer, overwrite_oldest) {
+  for (size_t capacity : {4U, 5U}) {
+    s21::ring_buffer<int> b(capacity);
+    for (int i = 0; i < 12; ++i) EXPECT_TRUE(b.push_back(i));
+    EXPECT_TRUE(b.full());
+    EXPECT_EQ(b.front(), 12 - static_cast<int>(capacity));
+    EXPECT_EQ(b.back(), 11);
+    for (size_t i = 0; i < capacity; ++i) {
+      EXPECT_EQ(b[i], static_cast<int>(12 - capacity + i));
+    }
+    EXPECT_THROW(b.at(capacity), std::out_of_range);
+  }
+}
+
+TEST(ring_buffer, reject_when_full) {
+  s21::ring_buffer<std::string, 3> b(s21::ring_policy::reject);
+  EXPECT_TRUE(b.push_back("a"));
+  EXPECT_TRUE(b.emplace_back(2, 'b'));
+  EXPECT_TRUE(b.push_back("c"));
+  EXPECT_FALSE(b.push_back("d"));
+  EXPECT_EQ(items(b), (std::vector<std::string>{"a", "bb", "c"}));
+  b.pop_front();
+  EXPECT_TRUE(b.push_back("d"));
+  b.pop_back();
+  EXPECT_EQ(items(b), (std::vector<std::string>{"bb", "c"}));
+}
+
+TEST(ring_buffer, two_spans) {
+  s21::ring_buffer<int, 8> b;
+  for (int i = 0; i < 11; ++i) b.push_back(i);
+  auto one = b.array_one();
+  auto two = b.array_two();
+  EXPECT_EQ(one.second + two.second, 8U);
+  EXPECT_EQ(one.first[0], 3);
+  EXPECT_EQ(two.first[0], 8);
+  int out[8];
+  std::memcpy(out, one.first, one.second * sizeof(int));
+  std::memcpy(out + one.second, two.first, two.second * sizeof(int));
+  for (int i = 0; i < 8; ++i) EXPECT_EQ(out[i], i + 3);
+  std::vector<int> copied(b.size());
+  EXPECT_EQ(b.copy_to(copied.begin()), 8U);
+  EXPECT_EQ(copied, items(b));
+  b.pop_front(5);
+  EXPECT_EQ(items(b), (std::vector<int>{8, 9, 10}));
+  EXPECT_EQ(b.array_two().second, 0U);
+  EXPECT_THROW(b.pop_front(4), std::out_of_range);
+}
+
+TEST(ring_buffer, iterators) {
+  s21::ring_buffer<int> b(6);
+  for (int i = 0; i < 9; ++i) b.push_back(10 - i);
+  std::sort(b.begin(), b.end());
+  EXPECT_EQ(items(b), (std::vector<int>{2, 3, 4, 5, 6, 7}));
+  s21::ring_buffer<int>::const_iterator it = b.begin();
+  EXPECT_EQ(*(it + 2), 4);
+  EXPECT_EQ(b.end() - it, 6);
+  for (auto &value : b) value *= 2;
+  EXPECT_EQ(b.front(), 4);
+}
+
+TEST(ring_buffer, copy_move_swap) {
+  s21::ring_buffer<std::unique_ptr<int>> heap(3);
+  heap.push_back(std::make_unique<int>(1));
+  heap.push_back(std::make_unique<int>(2));
+  int *first = heap.front().get();
+  s21::ring_buffer<std::unique_ptr<int>> moved(std::move(heap));
+  EXPECT_EQ(moved.front().get(), first);
+  EXPECT_EQ(heap.capacity(), 0U);
+  EXPECT_FALSE(heap.push_back(std::make_unique<int>(3)));
+  heap = std::move(moved);
+  EXPECT_EQ(heap.size(), 2U);
+
+  s21::ring_buffer<std::string, 4> a;
+  s21::ring_buffer<std::string, 4> b(s21::ring_policy::reject);
+  for (int i = 0; i < 6; ++i) a.push_back(std::to_string(i));
+  b.push_back("x");
+  a.swap(b);
+  EXPECT_EQ(items(a), (std::vector<std::string>{"x"}));
+  EXPECT_EQ(items(b), (std::vector<std::string>{"2", "3", "4", "5"}));
+  EXPECT_EQ(a.policy(), s21::ring_policy::reject);
+  s21::ring_buffer<std::string, 4> c(b);
+  b.clear();
+  EXPECT_EQ(c.front(), "2");
+  c = a;
+  EXPECT_EQ(c.size(), 1U);
+  s21::ring_buffer<std::string, 4> d(std::move(c));
+  EXPECT_EQ(d.back(), "x");
+  EXPECT_TRUE(c.empty());
+  EXPECT_EQ(c.capacity(), 4U);
+}
@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(skiplist_map, constructor) {
+  s21::skiplist_map<int, int> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.begin(), m.end());
+  s21::skiplist_map<int, std::string> m2{{3, "c"}, {1, "a"}, {2, "b"}};
+  EXPECT_EQ(m2.size(), 3U);
+  EXPECT_EQ(m2.begin()->second, "a");
+}
+
+TEST(skiplist_map, insert_find) {
+  s21::skiplist_map<std::string, int> m;
+  auto res = m.insert("a", 1);
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(res.first->second, 1);
+  res = m.insert({"a", 2});
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(res.first->second, 1);
+  EXPECT_EQ(m.find("a")->second, 1);
+  EXPECT_EQ(m.find("b"), m.end());
+  EXPECT_TRUE(m.contains("a"));
+  EXPECT_FALSE(m.contains("b"));
+  EXPECT_EQ(m.count("a"), 1U);
+  EXPECT_EQ(m.count("b"), 0U);
+  m.find("a")->second = 5;
+  EXPECT_EQ(m.find("a")->second, 5);
+}
+
+TEST(skiplist_map, element_access) {
+  s21::skiplist_map<int, std::string> m;
+  m[1] = "one";
+  EXPECT_EQ(m.at(1), "one");
+  EXPECT_EQ(m[2], "");
+  EXPECT_EQ(m.size(), 2U);
+  EXPECT_THROW(m.at(3), std::out_of_range);
+  const auto &cm = m;
+  EXPECT_EQ(cm.at(1), "one");
+}
+
+TEST(skiplist_map, ordered_iteration) {
+  s21::skiplist_map<int, int> m;
+  std::map<int, int> expected;
+  for (int i = 0; i < 1000; ++i) {
+    int key = (i * 7919) % 1000;
+    m.insert(key, i);
+    expected.emplace(key, i);
+  }
+  EXPECT_EQ(m.size(), expected.size());
+  auto it = expected.begin();
+  for (const auto &item : m) {
+    EXPECT_EQ(item.first, it->first);
+    EXPECT_EQ(item.second, it->second);
+    ++it;
+  }
+  EXPECT_EQ(it, expected.end());
+}
+
+TEST(skiplist_map, bounds) {
+  s21::skiplist_map<int, int> m;
+  for (int i = 0; i < 100; i += 10) m.insert(i, i);
+  EXPECT_EQ(m.lower_bound(20)->first, 20);
+  EXPECT_EQ(m.lower_bound(21)->first, 30);
+  EXPECT_EQ(m.lower_bound(-5)->first, 0);
+  EXPECT_EQ(m.lower_bound(95), m.end());
+  EXPECT_EQ(m.upper_bound(20)->first, 30);
+  EXPECT_EQ(m.upper_bound(90), m.end());
+  const auto &cm = m;
+  EXPECT_EQ(cm.lower_bound(45)->first, 50);
+  EXPECT_EQ(cm.upper_bound(45)->first, 50);
+}
+
+TEST(skiplist_map, erase) {
+  s21::skiplist_map<int, int> m;
+  for (int i = 0; i < 100; ++i) m.insert(i, i);
+  for (int i = 0; i < 100; i += 2) EXPECT_EQ(m.erase(i), 1U);
+  EXPECT_EQ(m.erase(0), 0U);
+  EXPECT_EQ(m.size(), 50U);
+  int expected = 1;
+  for (auto it = m.begin(); it != m.end(); ++it, expected += 2) {
+    EXPECT_EQ(it->first, expected);
+  }
+  m.erase(m.find(1));
+  EXPECT_FALSE(m.contains(1));
+  EXPECT_EQ(m.begin()->first, 3);
+  EXPECT_TRUE(m.insert(0, 0).second);
+  EXPECT_EQ(m.begin()->first, 0);
+}
+
+TEST(skiplist_map, iterator_outlives_erase) {
+  s21::skiplist_map<int, std::string> m;
+  m.insert(1, "one");
+  m.insert(2, "two");
+  auto it = m.find(1);
+  m.erase(1);
+  EXPECT_EQ(it->second, "one");
+  ++it;
+  EXPECT_EQ(it->first, 2);
+}
+
+TEST(skiplist_map, clear) {
+  s21::skiplist_map<int, int> m;
+  for (int i = 0; i < 100; ++i) m.insert(i, i);
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.begin(), m.end());
+  m.insert(1, 1);
+  EXPECT_EQ(m.size(), 1U);
+}
+
+TEST(skiplist_map, custom_compare) {
+  s21::skiplist_map<int, int, std::greater<int>> m;
+  m.insert_many(std::make_pair(1, 1), std::make_pair(3, 3),
+                std::make_pair(2, 2));
+  std::vector<int> keys;
+  for (const auto &item : m) keys.push_back(item.first);
+  EXPECT_EQ(keys, (std::vector<int>{3, 2, 1}));
+  EXPECT_EQ(m.lower_bound(4)->first, 3);
+}
+
+// Порядок задаётся состоянием компаратора, конструктора по умолчанию нет
+TEST(skiplist_map, stateful_compare) {
+  struct directed {
+    explicit directed(bool descending) : descending(descending) {}
+    bool operator()(int a, int b) const { return descending ? b < a : a < b; }
+    bool descending;
+  };
+  s21::skiplist_map<int, int, directed> m(directed(true));
+  for (int i = 0; i < 100; ++i) m.insert(std::make_pair(i, i));
+  std::vector<int> keys;
+  for (const auto &item : m) keys.push_back(item.first);
+  ASSERT_EQ(keys.size(), 100U);
+  EXPECT_EQ(keys.front(), 99);
+  EXPECT_EQ(keys.back(), 0);
+  EXPECT_TRUE(m.key_comp().descending);
+  EXPECT_EQ(m.upper_bound(50)->first, 49);
+  EXPECT_EQ(m.erase(50), 1U);
+  EXPECT_FALSE(m.contains(50));
+}
+
+TEST(skiplist_map, parallel_insert) {
+  s21::skiplist_map<int, int> m;
+  const int threads = 4, per_thread = 5000;
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; ++t) {
+    pool.emplace_back([&m, t] {
+      for (int i = 0; i < per_thread; ++i) m.insert(i * threads + t, t);
+    });
+  }
+  for (auto &th : pool) th.join();
+  EXPECT_EQ(m.size(), size_t(threads * per_thread));
+  int expected = 0;
+  for (const auto &item : m) EXPECT_EQ(item.first, expected++);
+  EXPECT_EQ(expected, threads * per_thread);
+}
+
+TEST(skiplist_map, parallel_insert_erase) {
+  s21::skiplist_map<int, int> m;
+  const int threads = 4, keys = 2000, rounds = 5;
+  std::vector<std::thread> pool;
+  std::vector<int> inserted(threads), erased(threads);
+  for (int t = 0; t < threads; ++t) {
+    pool.emplace_back([&, t] {
+      for (int r = 0; r < rounds; ++r) {
+        for (int i = 0; i < keys; ++i) {
+          if (m.insert(i, t).second) ++inserted[t];
+          if (m.lower_bound(i) == m.end()) continue;
+          if (m.erase((i + t * 7) % keys)) ++erased[t];
+        }
+      }
+    });
+  }
+  for (auto &th : pool) th.join();
+  int balance = 0;
+  for (int t = 0; t < threads; ++t) balance += inserted[t] - erased[t];
+  size_t live = 0;
+  int previous = -1;
+  for (const auto &item : m) {
+    EXPECT_LT(previous, item.first);
+    previous = item.first;
+    ++live;
+  }
+  EXPECT_EQ(live, size_t(balance));
+  EXPECT_EQ(m.size(), live);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(spsc_queue, push_pop) {
+  s21::spsc_queue<std::string> q(3);
+  EXPECT_EQ(q.capacity(), 4U);
+  EXPECT_TRUE(q.empty());
+  std::string out;
+  EXPECT_FALSE(q.try_pop(out));
+  EXPECT_TRUE(q.try_push("a"));
+  std::string b = "b";
+  EXPECT_TRUE(q.try_push(b));
+  EXPECT_TRUE(q.try_emplace(3, 'c'));
+  EXPECT_TRUE(q.try_push(std::string("d")));
+  EXPECT_FALSE(q.try_push("e"));
+  EXPECT_EQ(q.size_approx(), 4U);
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "a");
+  EXPECT_TRUE(q.try_push("e"));
+  for (const char *expected : {"b", "ccc", "d", "e"}) {
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out, expected);
+  }
+  EXPECT_FALSE(q.try_pop(out));
+  EXPECT_THROW(s21::spsc_queue<int>(0), std::invalid_argument);
+}
+
+TEST(spsc_queue, batches) {
+  s21::spsc_queue<int> q(8);
+  std::vector<int> items = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  EXPECT_EQ(q.try_push_batch(items.begin(), items.end()), 8U);
+  EXPECT_EQ(q.try_push_batch(items.begin(), items.end()), 0U);
+  std::vector<int> out(10);
+  EXPECT_EQ(q.try_pop_batch(out.begin(), 3), 3U);
+  EXPECT_EQ(out[2], 3);
+  EXPECT_EQ(q.try_push_batch(items.begin() + 8, items.end()), 2U);
+  EXPECT_EQ(q.try_pop_batch(out.begin(), 10), 7U);
+  EXPECT_EQ(std::vector<int>(out.begin(), out.begin() + 7),
+            (std::vector<int>{4, 5, 6, 7, 8, 9, 10}));
+  EXPECT_EQ(q.try_pop_batch(out.begin(), 10), 0U);
+}
+
+namespace {
+// Выходной итератор, который бросает после limit элементов
+struct limited_sink {
+  limited_sink &operator*() { return *this; }
+  limited_sink &operator++() { return *this; }
+  limited_sink &operator=(int value) {
+    if (items->size() == limit) throw std::runtime_error("full");
+    items->push_back(value);
+    return *this;
+  }
+  std::vector<int> *items;
+  size_t limit;
+};
+}  // namespace
+
+TEST(spsc_queue, pop_batch_throw_keeps_rest) {
+  s21::spsc_queue<int> q(8);
+  for (int i = 1; i <= 5; ++i) q.try_push(i);
+  std::vector<int> taken;
+  EXPECT_THROW(q.try_pop_batch(limited_sink{&taken, 2}, 5), std::runtime_error);
+  EXPECT_EQ(taken, (std::vector<int>{1, 2}));
+  EXPECT_EQ(q.size_approx(), 3U);
+  std::vector<int> out(5);
+  EXPECT_EQ(q.try_pop_batch(out.begin(), 5), 3U);
+  EXPECT_EQ(out[0], 3);
+  EXPECT_EQ(out[2], 5);
+}
+
+TEST(spsc_queue, destroys_leftovers) {
+  auto tracked = std::make_shared<int>(7);
+  {
+    s21::spsc_queue<std::shared_ptr<int>> q(4);
+    for (int i = 0; i < 3; ++i) q.try_push(tracked);
+    std::shared_ptr<int> out;
+    q.try_pop(out);
+    EXPECT_EQ(tracked.use_count(), 4);
+  }
+  EXPECT_EQ(tracked.use_count(), 1);
+}
+
+TEST(spsc_queue, two_threads_keep_order) {
+  constexpr int kItems = 200000;
+  s21::spsc_queue<int> q(64);
+  std::thread producer([&q] {
+    int next = 0;
+    std::vector<int> batch(16);
+    while (next < kItems) {
+      if (next % 3 == 0) {
+        if (!q.try_push(next)) {
+          std::this_thread::yield();
+          continue;
+        }
+        ++next;
+      } else {
+        int count = std::min(16, kItems - next);
+        for (int i = 0; i < count; ++i) batch[i] = next + i;
+        size_t pushed = q.try_push_batch(batch.begin(), batch.begin() + count);
+        if (pushed == 0) std::this_thread::yield();
+        next += static_cast<int>(pushed);
+      }
+    }
+  });
+  int expected = 0;
+  bool ordered = true;
+  std::vector<int> out(8);
+  while (expected < kItems) {
+    size_t got = q.try_pop_batch(out.begin(), out.size());
+    if (got == 0) std::this_thread::yield();
+    for (size_t i = 0; i < got; ++i) ordered &= out[i] == expected++;
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(q.empty());
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+long fib(s21::task_pool &pool, int n) {
+  if (n < 12) return n < 2 ? n : fib(pool, n - 1) + fib(pool, n - 2);
+  long a = 0;
+  long b = 0;
+  pool.parallel_invoke([&] { a = fib(pool, n - 1); },
+                       [&] { b = fib(pool, n - 2); });
+  return a + b;
+}
+
+void quickSort(s21::task_pool &pool, int *first, int *last) {
+  if (last - first < 256) {
+    std::sort(first, last);
+    return;
+  }
+  int pivot = first[(last - first) / 2];
+  int *middle1 =
+      std::partition(first, last, [pivot](int x) { return x < pivot; });
+  int *middle2 =
+      std::partition(middle1, last, [pivot](int x) { return x == pivot; });
+  pool.parallel_invoke([&] { quickSort(pool, first, middle1); },
+                       [&] { quickSort(pool, middle2, last); });
+}
+}  // namespace
+
+TEST(task_pool, fib) {
+  s21::task_pool pool(4);
+  EXPECT_EQ(pool.size(), 4U);
+  EXPECT_EQ(fib(pool, 25), 75025);
+}
+
+TEST(task_pool, quick_sort) {
+  s21::task_pool pool(3);
+  std::vector<int> items(100000);
+  std::mt19937 gen(21);
+  for (auto &item : items) item = static_cast<int>(gen() % 1000);
+  quickSort(pool, items.data(), items.data() + items.size());
+  EXPECT_TRUE(std::is_sorted(items.begin(), items.end()));
+}
+
+TEST(task_pool, group_spawn_and_sync) {
+  s21::task_pool pool(2);
+  std::atomic<int> done{0};
+  s21::task_group group(pool);
+  for (int i = 0; i < 1000; ++i) {
+    group.spawn([&] { done++; });
+  }
+  group.sync();
+  EXPECT_EQ(done.load(), 1000);
+  // Группу можно использовать снова, задачи можно порождать из задач
+  group.spawn([&] {
+    s21::task_group inner(pool);
+    for (int i = 0; i < 10; ++i) inner.spawn([&] { done++; });
+    inner.sync();
+  });
+  group.sync();
+  EXPECT_EQ(done.load(), 1010);
+}
+
+TEST(task_pool, exceptions) {
+  s21::task_pool pool(2);
+  s21::task_group group(pool);
+  std::atomic<int> done{0};
+  group.spawn([] { throw std::runtime_error("task"); });
+  group.spawn([&] { done++; });
+  EXPECT_THROW(group.sync(), std::runtime_error);
+  EXPECT_EQ(done.load(), 1);
+  group.sync();
+  EXPECT_THROW(pool.parallel_invoke([] { throw std::logic_error("inline"); },
+                                    [&] { done++; }),
+               std::logic_error);
+  EXPECT_EQ(done.load(), 2);
+}
+
+TEST(task_pool, outside_threads) {
+  s21::task_pool pool(2);
+  std::atomic<long> total{0};
+  std::vector<std::thread> clients;
+  for (int c = 0; c < 3; ++c) {
+    clients.emplace_back([&] { total += fib(pool, 18); });
+  }
+  for (auto &client : clients) client.join();
+  EXPECT_EQ(total.load(), 3 * 2584);
+}
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(timer_wheel, fires_in_deadline_order) {
+  s21::timer_wheel<> timers;
+  std::vector<int> fired;
+  timers.schedule(5, [&] { fired.push_back(5); });
+  timers.schedule(3, [&] { fired.push_back(3); });
+  timers.schedule(5, [&] { fired.push_back(50); });
+  timers.schedule_after(10, [&] { fired.push_back(10); });
+  EXPECT_EQ(timers.size(), 4U);
+  EXPECT_EQ(timers.advance(2), 0U);
+  EXPECT_EQ(timers.now(), 2U);
+  EXPECT_EQ(timers.advance(5), 3U);
+  EXPECT_EQ(fired, (std::vector<int>{3, 5, 50}));
+  EXPECT_EQ(timers.advance(100), 1U);
+  EXPECT_EQ(timers.now(), 100U);
+  EXPECT_TRUE(timers.empty());
+  // Прошедший срок переносится на следующий тик
+  timers.schedule(1, [&] { fired.push_back(1); });
+  EXPECT_EQ(timers.advance(100), 0U);
+  EXPECT_EQ(timers.advance(101), 1U);
+  EXPECT_EQ(fired.back(), 1);
+}
+
+TEST(timer_wheel, cancel) {
+  s21::timer_wheel<> timers;
+  int fired = 0;
+  auto first = timers.schedule(10, [&] { fired += 1; });
+  auto second = timers.schedule(10, [&] { fired += 10; });
+  s21::timer_wheel<>::handle none;
+  EXPECT_FALSE(timers.pending(none));
+  EXPECT_FALSE(timers.cancel(none));
+  EXPECT_TRUE(timers.pending(first));
+  EXPECT_TRUE(timers.cancel(first));
+  EXPECT_FALSE(timers.cancel(first));
+  EXPECT_EQ(timers.size(), 1U);
+  // Узел отменённого таймера переиспользуется, старая ручка не действует
+  auto third = timers.schedule(20, [&] { fired += 100; });
+  EXPECT_FALSE(timers.pending(first));
+  EXPECT_TRUE(timers.pending(third));
+  timers.advance(30);
+  EXPECT_EQ(fired, 110);
+  EXPECT_FALSE(timers.pending(second));
+  EXPECT_FALSE(timers.cancel(third));
+}
+
+// Сроки на всех уровнях колеса и за его пределами срабатывают точно в
+// свой тик
+TEST(timer_wheel, cascades_through_levels) {
+  s21::timer_wheel<> timers(1000);
+  const uint64_t deadlines[] = {
+      1255, 1256, 70000, (1ULL << 24) + 7, (1ULL << 32) + 1, (1ULL << 40) + 3};
+  std::vector<uint64_t> fired;
+  for (uint64_t when : deadlines) {
+    timers.schedule(when, [&timers, &fired] { fired.push_back(timers.now()); });
+  }
+  for (size_t i = 0; i < 6; ++i) {
+    timers.advance(deadlines[i] - 1);
+    EXPECT_EQ(fired.size(), i);
+    timers.advance(deadlines[i]);
+    ASSERT_EQ(fired.size(), i + 1);
+    EXPECT_EQ(fired.back(), deadlines[i]);
+  }
+  EXPECT_EQ(fired.size(), 6U);
+}
+
+// Обратные вызовы планируют и отменяют таймеры, в том числе из своей пачки
+TEST(timer_wheel, callbacks_reschedule_and_cancel) {
+  s21::timer_wheel<> timers;
+  std::vector<int> fired;
+  s21::timer_wheel<>::handle victim;
+  timers.schedule(1, [&] {
+    fired.push_back(1);
+    EXPECT_TRUE(timers.cancel(victim));
+    timers.schedule_after(0, [&] { fired.push_back(2); });
+  });
+  victim = timers.schedule(1, [&] { fired.push_back(-1); });
+  int repeats = 0;
+  std::function<void()> periodic = [&] {
+    if (++repeats < 5) timers.schedule_after(100, periodic);
+  };
+  timers.schedule(100, periodic);
+  EXPECT_EQ(timers.advance(1), 1U);
+  EXPECT_EQ(timers.advance(1000), 6U);
+  EXPECT_EQ(fired, (std::vector<int>{1, 2}));
+  EXPECT_EQ(repeats, 5);
+  EXPECT_TRUE(timers.empty());
+}
+
+TEST(timer_wheel, matches_reference) {
+  s21::timer_wheel<> timers;
+  std::multimap<uint64_t, int> reference;
+  std::vector<std::pair<s21::timer_wheel<>::handle, uint64_t>> handles;
+  std::vector<std::pair<uint64_t, int>> expected;
+  std::vector<std::pair<uint64_t, int>> fired;
+  std::mt19937 gen(21);
+  uint64_t now = 0;
+  for (int step = 0; step < 20000; ++step) {
+    uint64_t when = now + 1 + gen() % (step % 7 == 0 ? 200000 : 600);
+    int id = step;
+    handles.emplace_back(
+        timers.schedule(when,
+                        [&fired, &timers, id] {
+                          fired.emplace_back(timers.now(), id);
+                        }),
+        when);
+    reference.emplace(when, id);
+    if (gen() % 3 == 0) {
+      auto &victim = handles[gen() % handles.size()];
+      if (timers.cancel(victim.first)) {
+        auto range = reference.equal_range(victim.second);
+        for (auto it = range.first; it != range.second; ++it) {
+          if (&handles[static_cast<size_t>(it->second)] == &victim) {
+            reference.erase(it);
+            break;
+          }
+        }
+      }
+    }
+    if (step % 10 == 0) {
+      now += gen() % 300;
+      timers.advance(now);
+      while (!reference.empty() && reference.begin()->first <= now) {
+        expected.emplace_back(*reference.begin());
+        reference.erase(reference.begin());
+      }
+    }
+  }
+  timers.advance(now + 300000);
+  for (auto &item : reference) expected.push_back(item);
+  // Порядок таймеров одного тика не задан
+  EXPECT_TRUE(std::is_sorted(
+      fired.begin(), fired.end(),
+      [](const auto &a, const auto &b) { return a.first < b.first; }));
+  std::sort(fired.begin(), fired.end());
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(fired, expected);
+  EXPECT_TRUE(timers.empty());
+}
+
+TEST(timer_wheel, clear) {
+  s21::timer_wheel<> timers;
+  int fired = 0;
+  std::vector<s21::timer_wheel<>::handle> handles;
+  for (int i = 0; i < 3000; ++i) {
+    handles.push_back(timers.schedule(i * 997, [&] { ++fired; }));
+  }
+  timers.advance(10000);
+  size_t left = timers.size();
+  EXPECT_GT(left, 0U);
+  timers.clear();
+  EXPECT_TRUE(timers.empty());
+  for (auto &handle : handles) EXPECT_FALSE(timers.pending(handle));
+  EXPECT_EQ(timers.advance(1ULL << 33), 0U);
+  EXPECT_EQ(static_cast<size_t>(fired) + left, 3000U);
+}
@@ -0,0 +1,300 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "../s21_containersplus.h"
+
+namespace {
+struct string_hash {
+  using is_transparent = void;
+  size_t operator()(std::string_view str) const {
+    return std::hash<std::string_view>()(str);
+  }
+};
+
+// Копия бросает, пока поднят флаг или когда кончился запас copies_left
+// (отрицательный запас не ограничен)
+struct fragile {
+  static bool fail;
+  static int copies_left;
+  fragile() = default;
+  fragile(const fragile &other) : value(other.value) {
+    if (fail || copies_left == 0) throw std::runtime_error("copy");
+    if (copies_left > 0) --copies_left;
+  }
+  fragile &operator=(const fragile &) = default;
+  int value = 0;
+};
+bool fragile::fail = false;
+int fragile::copies_left = -1;
+
+// Хеш с состоянием и без конструктора по умолчанию
+struct seeded_hash {
+  explicit seeded_hash(size_t seed) : seed(seed) {}
+  size_t operator()(int key) const { return std::hash<int>()(key) ^ seed; }
+  size_t seed;
+};
+}  // namespace
+
+TEST(unordered_map, constructor_default) {
+  s21::unordered_map<int, int> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.size(), 0U);
+  EXPECT_TRUE(m.begin() == m.end());
+  EXPECT_EQ(m.load_factor(), 0.0f);
+}
+
+TEST(unordered_map, constructor_initializer_list) {
+  s21::unordered_map<int, std::string> m = {{1, "one"}, {2, "two"}, {1, "x"}};
+  EXPECT_EQ(m.size(), 2U);
+  EXPECT_EQ(m.at(1), "one");
+  EXPECT_EQ(m.at(2), "two");
+}
+
+TEST(unordered_map, constructor_copy) {
+  s21::unordered_map<int, std::string> m = {{1, "one"}, {2, "two"}};
+  s21::unordered_map<int, std::string> copy(m);
+  EXPECT_EQ(copy.size(), m.size());
+  EXPECT_EQ(copy.at(1), "one");
+  copy[1] = "uno";
+  EXPECT_EQ(m.at(1), "one");
+}
+
+TEST(unordered_map, constructor_move) {
+  s21::unordered_map<int, std::string> m = {{1, "one"}, {2, "two"}};
+  s21::unordered_map<int, std::string> moved(std::move(m));
+  EXPECT_EQ(moved.size(), 2U);
+  EXPECT_EQ(m.size(), 0U);
+  EXPECT_TRUE(m.find(1) == m.end());
+}
+
+TEST(unordered_map, assignment) {
+  s21::unordered_map<int, int> m = {{1, 10}, {2, 20}};
+  s21::unordered_map<int, int> other = {{3, 30}};
+  other = m;
+  EXPECT_EQ(other.size(), 2U);
+  EXPECT_FALSE(other.contains(3));
+  s21::unordered_map<int, int> moved;
+  moved = std::move(other);
+  EXPECT_EQ(moved.at(2), 20);
+}
+
+TEST(unordered_map, insert) {
+  s21::unordered_map<std::string, int> m;
+  auto res = m.insert({"a", 1});
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(res.first->second, 1);
+  res = m.insert("a", 2);
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(res.first->second, 1);
+  res = m.insert_or_assign("a", 3);
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(m.at("a"), 3);
+}
+
+TEST(unordered_map, operator_brackets) {
+  s21::unordered_map<std::string, int> m;
+  m["a"] += 5;
+  m["a"] += 5;
+  m["b"];
+  EXPECT_EQ(m.size(), 2U);
+  EXPECT_EQ(m["a"], 10);
+  EXPECT_EQ(m["b"], 0);
+}
+
+TEST(unordered_map, at_throw) {
+  s21::unordered_map<int, int> m = {{1, 1}};
+  EXPECT_THROW(m.at(2), std::out_of_range);
+  const s21::unordered_map<int, int> &cm = m;
+  EXPECT_EQ(cm.at(1), 1);
+  EXPECT_THROW(cm.at(2), std::out_of_range);
+}
+
+TEST(unordered_map, insert_throw_keeps_table) {
+  s21::unordered_map<int, fragile> m;
+  fragile item;
+  for (int i = 0; i < 20; ++i) {
+    item.value = i;
+    m.insert(i, item);
+  }
+  fragile::fail = true;
+  for (int i = 20; i < 40; ++i) {
+    EXPECT_THROW(m.insert(i, item), std::runtime_error);
+  }
+  fragile::fail = false;
+  EXPECT_EQ(m.size(), 20U);
+  EXPECT_FALSE(m.contains(25));
+  int sum = 0;
+  for (auto &entry : m) sum += entry.second.value;
+  EXPECT_EQ(sum, 190);
+  item.value = 7;
+  EXPECT_TRUE(m.insert(25, item).second);
+  EXPECT_EQ(m.at(25).value, 7);
+}
+
+// Копия, брошенная на середине, не оставляет недостроенных слотов, а
+// присваивание не меняет приёмник
+TEST(unordered_map, copy_throw_keeps_target) {
+  s21::unordered_map<int, fragile> m;
+  fragile item;
+  for (int i = 0; i < 20; ++i) {
+    item.value = i;
+    m.insert(i, item);
+  }
+  s21::unordered_map<int, fragile> target;
+  target.insert(100, item);
+  fragile::copies_left = 4;
+  using fragile_map = s21::unordered_map<int, fragile>;
+  EXPECT_THROW(fragile_map{m}, std::runtime_error);
+  fragile::copies_left = 4;
+  EXPECT_THROW(target = m, std::runtime_error);
+  fragile::copies_left = -1;
+  EXPECT_EQ(target.size(), 1U);
+  EXPECT_TRUE(target.contains(100));
+  target = m;
+  EXPECT_EQ(target.size(), 20U);
+  EXPECT_EQ(target.at(7).value, 7);
+}
+
+// Рост, на котором бросил перенос элемента, оставляет таблицу прежней
+TEST(unordered_map, resize_throw_keeps_table) {
+  s21::unordered_map<int, fragile> m;
+  fragile item;
+  for (int i = 0; i < 28; ++i) {
+    item.value = i;
+    m.insert(i, item);
+  }
+  size_t buckets = m.bucket_count();
+  fragile::copies_left = 10;
+  EXPECT_THROW(m.reserve(1000), std::runtime_error);
+  fragile::copies_left = 10;
+  EXPECT_THROW(m.insert(28, item), std::runtime_error);
+  fragile::copies_left = -1;
+  EXPECT_EQ(m.bucket_count(), buckets);
+  EXPECT_EQ(m.size(), 28U);
+  for (int i = 0; i < 28; ++i) EXPECT_EQ(m.at(i).value, i);
+  EXPECT_TRUE(m.insert(28, item).second);
+  EXPECT_GT(m.bucket_count(), buckets);
+}
+
+TEST(unordered_map, stateful_hash) {
+  s21::unordered_map<int, int, seeded_hash> m(64, seeded_hash(0x5bd1e995));
+  EXPECT_GE(m.bucket_count(), 64U);
+  for (int i = 0; i < 500; ++i) m.insert(i, -i);
+  s21::unordered_map<int, int, seeded_hash> copy(m);
+  EXPECT_EQ(copy.hash_function().seed, 0x5bd1e995U);
+  s21::unordered_map<int, int, seeded_hash> other(0, seeded_hash(7));
+  other.insert(1000, 1);
+  other.swap(copy);
+  EXPECT_EQ(other.hash_function().seed, 0x5bd1e995U);
+  EXPECT_EQ(copy.hash_function().seed, 7U);
+  for (int i = 0; i < 500; ++i) EXPECT_EQ(other.at(i), -i);
+  EXPECT_EQ(copy.at(1000), 1);
+}
+
+TEST(unordered_map, erase) {
+  s21::unordered_map<int, int> m = {{1, 1}, {2, 2}, {3, 3}};
+  EXPECT_EQ(m.erase(2), 1U);
+  EXPECT_EQ(m.erase(2), 0U);
+  m.erase(m.find(1));
+  EXPECT_EQ(m.size(), 1U);
+  EXPECT_FALSE(m.contains(1));
+  EXPECT_TRUE(m.contains(3));
+}
+
+TEST(unordered_map, iteration) {
+  s21::unordered_map<int, int> m;
+  for (int i = 0; i < 100; ++i) m.insert(i, i * i);
+  int count = 0;
+  long sum = 0;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    EXPECT_EQ(it->second, it->first * it->first);
+    sum += it->first;
+    ++count;
+  }
+  EXPECT_EQ(count, 100);
+  EXPECT_EQ(sum, 4950);
+}
+
+TEST(unordered_map, reserve_rehash) {
+  s21::unordered_map<int, int> m;
+  m.reserve(1000);
+  size_t buckets = m.bucket_count();
+  EXPECT_GE(buckets * m.max_load_factor(), 1000.0f);
+  for (int i = 0; i < 1000; ++i) m.insert(i, i);
+  EXPECT_EQ(m.bucket_count(), buckets);
+  EXPECT_LE(m.load_factor(), m.max_load_factor());
+  for (int i = 0; i < 990; ++i) m.erase(i);
+  m.rehash(0);
+  EXPECT_LT(m.bucket_count(), buckets);
+  EXPECT_EQ(m.size(), 10U);
+  for (int i = 990; i < 1000; ++i) EXPECT_EQ(m.at(i), i);
+}
+
+TEST(unordered_map, clear) {
+  s21::unordered_map<int, std::string> m = {{1, "a"}, {2, "b"}};
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.begin() == m.end());
+  m.insert(3, "c");
+  EXPECT_EQ(m.at(3), "c");
+}
+
+TEST(unordered_map, swap_merge) {
+  s21::unordered_map<int, int> a = {{1, 1}, {2, 2}};
+  s21::unordered_map<int, int> b = {{2, 20}, {3, 30}};
+  a.merge(b);
+  EXPECT_EQ(a.size(), 3U);
+  EXPECT_EQ(a.at(2), 2);
+  EXPECT_EQ(b.size(), 1U);
+  EXPECT_EQ(b.at(2), 20);
+  a.swap(b);
+  EXPECT_EQ(a.size(), 1U);
+  EXPECT_EQ(b.size(), 3U);
+}
+
+TEST(unordered_map, insert_many) {
+  s21::unordered_map<int, char> m;
+  auto res = m.insert_many(std::pair<const int, char>{1, 'a'},
+                           std::pair<const int, char>{2, 'b'},
+                           std::pair<const int, char>{1, 'c'});
+  EXPECT_EQ(res.size(), 3U);
+  EXPECT_TRUE(res[0].second);
+  EXPECT_TRUE(res[1].second);
+  EXPECT_FALSE(res[2].second);
+  EXPECT_EQ(m.at(1), 'a');
+}
+
+TEST(unordered_map, transparent_lookup) {
+  s21::unordered_map<std::string, int, string_hash, std::equal_to<>> m = {
+      {"hello", 1}, {"hi", 2}};
+  std::string_view key = "hi";
+  EXPECT_EQ(m.find(key)->second, 2);
+  EXPECT_TRUE(m.contains(key));
+  EXPECT_EQ(m.count(std::string_view("hey")), 0U);
+  const auto &cm = m;
+  EXPECT_EQ(cm.find(key)->second, 2);
+  EXPECT_TRUE(cm.contains(key));
+  EXPECT_EQ(cm.count(key), 1U);
+}
+
+TEST(unordered_map, random_against_std) {
+  s21::unordered_map<int, int> m;
+  std::unordered_map<int, int> ref;
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> key(0, 2000);
+  for (int i = 0; i < 50000; ++i) {
+    int k = key(gen);
+    if (gen() % 3 == 0) {
+      EXPECT_EQ(m.erase(k), ref.erase(k));
+    } else {
+      EXPECT_EQ(m.insert(k, i).second, ref.insert({k, i}).second);
+    }
+  }
+  EXPECT_EQ(m.size(), ref.size());
+  for (const auto &item : ref) EXPECT_EQ(m.at(item.first), item.second);
+}
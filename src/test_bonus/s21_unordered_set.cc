@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <unordered_set>
+
+#include "../s21_containersplus.h"
+
+TEST(unordered_set, constructor_default) {
+  s21::unordered_set<int> s;
+  EXPECT_TRUE(s.empty());
+  EXPECT_TRUE(s.begin() == s.end());
+}
+
+TEST(unordered_set, constructor_initializer_list) {
+  s21::unordered_set<std::string> s = {"a", "b", "a", "c"};
+  std::unordered_set<std::string> s2 = {"a", "b", "a", "c"};
+  EXPECT_EQ(s.size(), s2.size());
+  for (const auto &item : s2) EXPECT_TRUE(s.contains(item));
+}
+
+TEST(unordered_set, copy_move) {
+  s21::unordered_set<int> s = {1, 2, 3};
+  s21::unordered_set<int> copy(s);
+  s21::unordered_set<int> moved(std::move(s));
+  EXPECT_EQ(copy.size(), 3U);
+  EXPECT_EQ(moved.size(), 3U);
+  EXPECT_TRUE(s.empty());
+}
+
+TEST(unordered_set, insert_erase) {
+  s21::unordered_set<int> s;
+  EXPECT_TRUE(s.insert(5).second);
+  EXPECT_FALSE(s.insert(5).second);
+  EXPECT_EQ(*s.find(5), 5);
+  s.erase(s.find(5));
+  EXPECT_TRUE(s.find(5) == s.end());
+  EXPECT_EQ(s.count(5), 0U);
+}
+
+TEST(unordered_set, growth) {
+  s21::unordered_set<int> s;
+  for (int i = 0; i < 10000; ++i) s.insert(i * 7);
+  EXPECT_EQ(s.size(), 10000U);
+  EXPECT_LE(s.load_factor(), s.max_load_factor());
+  for (int i = 0; i < 10000; ++i) {
+    EXPECT_TRUE(s.contains(i * 7));
+    EXPECT_FALSE(s.contains(i * 7 + 1));
+  }
+}
+
+TEST(unordered_set, erase_reinsert) {
+  s21::unordered_set<int> s;
+  for (int round = 0; round < 50; ++round) {
+    for (int i = 0; i < 100; ++i) s.insert(round * 100 + i);
+    for (int i = 0; i < 100; ++i) s.erase(round * 100 + i);
+  }
+  EXPECT_TRUE(s.empty());
+  EXPECT_LE(s.bucket_count(), 255U);
+}
+
+TEST(unordered_set, insert_many) {
+  s21::unordered_set<int> s;
+  auto res = s.insert_many(1, 2, 2, 3);
+  EXPECT_EQ(res.size(), 4U);
+  EXPECT_FALSE(res[2].second);
+  EXPECT_EQ(s.size(), 3U);
+}
+
+TEST(unordered_set, transparent_lookup) {
+  struct string_hash {
+    using is_transparent = void;
+    size_t operator()(std::string_view str) const {
+      return std::hash<std::string_view>()(str);
+    }
+  };
+  s21::unordered_set<std::string, string_hash, std::equal_to<>> s = {"ab",
+                                                                     "cd"};
+  EXPECT_TRUE(s.find(std::string_view("ab")) != s.end());
+  EXPECT_TRUE(s.contains(std::string_view("cd")));
+  EXPECT_FALSE(s.contains(std::string_view("ef")));
+}
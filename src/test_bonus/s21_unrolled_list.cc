@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+template <typename List>
+std::vector<typename List::value_type> items(const List &l) {
+  return std::vector<typename List::value_type>(l.begin(), l.end());
+}
+
+struct no_default {
+  explicit no_default(int v) : value(v) {}
+  int value;
+};
+}  // namespace
+
+TEST(unrolled_list, constructor) {
+  s21::unrolled_list<int> l;
+  EXPECT_TRUE(l.empty());
+  EXPECT_EQ(l.begin(), l.end());
+  EXPECT_THROW(l.front(), std::out_of_range);
+  s21::unrolled_list<std::string> l2{"a", "b", "c"};
+  EXPECT_EQ(l2.size(), 3U);
+  EXPECT_EQ(l2.front(), "a");
+  EXPECT_EQ(l2.back(), "c");
+  s21::unrolled_list<std::string> l3(l2);
+  EXPECT_TRUE(l3 == l2);
+  s21::unrolled_list<std::string> l4(std::move(l3));
+  EXPECT_TRUE(l3.empty());
+  EXPECT_TRUE(l4 == l2);
+  l3 = l4;
+  l4 = std::move(l2);
+  EXPECT_TRUE(l2.empty());
+  EXPECT_TRUE(l3 == l4);
+  s21::unrolled_list<int> l5(5);
+  EXPECT_EQ(items(l5), std::vector<int>(5, 0));
+}
+
+TEST(unrolled_list, push_pop_both_ends) {
+  s21::unrolled_list<int, 4> l;
+  for (int i = 0; i < 20; ++i) l.push_back(i);
+  for (int i = 1; i <= 20; ++i) l.push_front(-i);
+  EXPECT_EQ(l.size(), 40U);
+  EXPECT_EQ(l.front(), -20);
+  EXPECT_EQ(l.back(), 19);
+  std::vector<int> backward;
+  for (auto it = l.end(); it != l.begin();) backward.push_back(*--it);
+  EXPECT_EQ(backward.front(), 19);
+  EXPECT_EQ(backward.back(), -20);
+  for (int i = 0; i < 10; ++i) {
+    l.pop_back();
+    l.pop_front();
+  }
+  EXPECT_EQ(l.front(), -10);
+  EXPECT_EQ(l.back(), 9);
+  while (!l.empty()) l.pop_front();
+  EXPECT_EQ(l.begin(), l.end());
+  l.pop_back();
+  l.push_back(1);
+  EXPECT_EQ(l.front(), 1);
+}
+
+TEST(unrolled_list, matches_std_list) {
+  s21::unrolled_list<int, 4> l;
+  std::list<int> expected;
+  unsigned seed = 7;
+  for (int step = 0; step < 3000; ++step) {
+    seed = seed * 1103515245 + 12345;
+    size_t index = expected.empty() ? 0 : (seed >> 8) % (expected.size() + 1);
+    auto it = l.begin();
+    auto expected_it = expected.begin();
+    std::advance(it, index);
+    std::advance(expected_it, index);
+    if ((seed >> 4) % 3 == 0 && expected_it != expected.end()) {
+      auto next = l.erase(it);
+      auto expected_next = expected.erase(expected_it);
+      if (expected_next != expected.end()) {
+        EXPECT_EQ(*next, *expected_next);
+      }
+    } else {
+      EXPECT_EQ(*l.insert(it, step), step);
+      expected.insert(expected_it, step);
+    }
+  }
+  EXPECT_EQ(l.size(), expected.size());
+  EXPECT_EQ(items(l), std::vector<int>(expected.begin(), expected.end()));
+}
+
+TEST(unrolled_list, splice_merge) {
+  s21::unrolled_list<int, 4> a{1, 2, 3, 4, 5, 6};
+  s21::unrolled_list<int, 4> b{10, 20, 30};
+  a.splice(std::next(a.begin(), 2), b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(items(a), (std::vector<int>{1, 2, 10, 20, 30, 3, 4, 5, 6}));
+  b.push_back(7);
+  a.splice(a.end(), b);
+  a.splice(a.begin(), b);
+  EXPECT_EQ(a.back(), 7);
+  EXPECT_EQ(a.size(), 10U);
+
+  s21::unrolled_list<int> c{1, 4, 9};
+  s21::unrolled_list<int> d{2, 4, 10};
+  c.merge(d);
+  EXPECT_TRUE(d.empty());
+  EXPECT_EQ(items(c), (std::vector<int>{1, 2, 4, 4, 9, 10}));
+  s21::unrolled_list<int> e{11, 3};
+  c.merge(e, [](int x, int y) { return x > y; });
+  EXPECT_EQ(c.size(), 8U);
+}
+
+TEST(unrolled_list, reverse_unique_sort) {
+  s21::unrolled_list<int, 4> l;
+  for (int i = 0; i < 30; ++i) l.push_back(i / 3);
+  l.unique();
+  EXPECT_EQ(l.size(), 10U);
+  l.reverse();
+  EXPECT_EQ(items(l), (std::vector<int>{9, 8, 7, 6, 5, 4, 3, 2, 1, 0}));
+  l.sort();
+  EXPECT_EQ(l.front(), 0);
+  EXPECT_EQ(l.back(), 9);
+
+  s21::unrolled_list<std::pair<int, int>> pairs;
+  for (int i = 0; i < 50; ++i) pairs.push_back({i % 5, i});
+  pairs.sort([](const std::pair<int, int> &x, const std::pair<int, int> &y) {
+    return x.first < y.first;
+  });
+  auto prev = pairs.front();
+  for (auto it = std::next(pairs.begin()); it != pairs.end(); ++it) {
+    if (prev.first == it->first) {
+      EXPECT_LT(prev.second, it->second);
+    }
+    prev = *it;
+  }
+}
+
+TEST(unrolled_list, insert_many) {
+  s21::unrolled_list<int, 4> l{1, 5};
+  auto it = l.insert_many(std::next(l.begin()), 2, 3, 4);
+  EXPECT_EQ(*it, 2);
+  l.insert_many_back(6, 7);
+  l.insert_many_front(-1, 0);
+  EXPECT_EQ(items(l), (std::vector<int>{-1, 0, 1, 2, 3, 4, 5, 6, 7}));
+  EXPECT_TRUE(l != (s21::unrolled_list<int, 4>{}));
+}
+
+TEST(unrolled_list, non_default_constructible) {
+  s21::unrolled_list<no_default, 4> l;
+  for (int i = 0; i < 10; ++i) l.push_back(no_default(i));
+  l.erase(l.begin());
+  l.insert(l.begin(), no_default(42));
+  EXPECT_EQ(l.front().value, 42);
+  EXPECT_EQ(l.back().value, 9);
+  EXPECT_EQ(l.size(), 10U);
+}
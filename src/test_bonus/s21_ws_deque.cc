@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(ws_deque, owner_is_lifo_thief_is_fifo) {
+  s21::ws_deque<int> d(4);
+  EXPECT_TRUE(d.empty());
+  EXPECT_FALSE(d.take().has_value());
+  EXPECT_FALSE(d.steal().has_value());
+  for (int i = 0; i < 4; ++i) d.push(i);
+  EXPECT_EQ(d.size_approx(), 4U);
+  EXPECT_EQ(*d.take(), 3);
+  EXPECT_EQ(*d.steal(), 0);
+  EXPECT_EQ(*d.take(), 2);
+  EXPECT_EQ(*d.steal(), 1);
+  EXPECT_FALSE(d.take().has_value());
+  EXPECT_TRUE(d.empty());
+}
+
+TEST(ws_deque, grows) {
+  s21::ws_deque<int> d(2);
+  EXPECT_EQ(d.capacity(), 2U);
+  // Кражи сдвигают начало, чтобы рост копировал кольцо с переходом
+  for (int i = 0; i < 3; ++i) d.push(i);
+  EXPECT_EQ(*d.steal(), 0);
+  for (int i = 3; i < 100; ++i) d.push(i);
+  EXPECT_GE(d.capacity(), 128U);
+  EXPECT_EQ(d.size_approx(), 99U);
+  for (int i = 1; i < 50; ++i) EXPECT_EQ(*d.steal(), i);
+  for (int i = 99; i >= 50; --i) EXPECT_EQ(*d.take(), i);
+  EXPECT_TRUE(d.empty());
+}
+
+// Владелец кладёт и забирает, воры крадут: каждый элемент должен быть
+// получен ровно один раз
+TEST(ws_deque, owner_and_thieves) {
+  constexpr int kItems = 100000;
+  constexpr int kThieves = 3;
+  s21::ws_deque<int> d(8);
+  std::vector<std::atomic<int>> seen(kItems);
+  std::atomic<int> received{0};
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kThieves; ++t) {
+    thieves.emplace_back([&] {
+      while (received.load() < kItems) {
+        if (auto value = d.steal()) {
+          seen[*value]++;
+          received++;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (int i = 0; i < kItems; ++i) {
+    d.push(i);
+    if (i % 3 == 0) {
+      if (auto value = d.take()) {
+        seen[*value]++;
+        received++;
+      }
+    }
+  }
+  while (auto value = d.take()) {
+    seen[*value]++;
+    received++;
+  }
+  for (auto &thief : thieves) thief.join();
+  for (auto &count : seen) EXPECT_EQ(count.load(), 1);
+}